@@ -0,0 +1,221 @@
+/*
+  Copyright 2010-202x held jointly by participating institutions.
+  ATS is released under the three-clause BSD License.
+  The terms of use and "as is" disclaimer for this license are
+  provided in the top-level COPYRIGHT file.
+
+  Authors:
+*/
+
+#include "ColumnSumEvaluator.hh"
+#include "activelayer_average_temp_evaluator.hh"
+#include "thaw_depth_evaluator.hh"
+#include "water_table_depth_evaluator.hh"
+
+#include "ColumnIntegratorsEvaluator.hh"
+
+namespace Amanzi {
+namespace Relations {
+
+namespace Impl {
+
+template <class Integrator>
+class ColumnScannerT : public ColumnScanner {
+ public:
+  ColumnScannerT(Teuchos::ParameterList& plist,
+                 std::vector<const Epetra_MultiVector*>& deps,
+                 const AmanziMesh::Mesh* mesh)
+    : integrator_(plist, deps, mesh)
+  {}
+
+  int scan(AmanziMesh::Entity_ID col, AmanziMesh::Entity_ID c, AmanziGeometry::Point& p) override
+  {
+    return integrator_.scan(col, c, p);
+  }
+  double coefficient(AmanziMesh::Entity_ID col) override { return integrator_.coefficient(col); }
+
+ private:
+  Integrator integrator_;
+};
+
+
+template <class Parser>
+std::vector<KeyTag>
+parseDependencies(Teuchos::ParameterList& plist, const KeyTag& key_tag)
+{
+  Parser parser(plist, key_tag);
+  return std::vector<KeyTag>(parser.dependencies.begin(), parser.dependencies.end());
+}
+
+
+std::vector<KeyTag>
+parseColumnIntegrator(const std::string& type, Teuchos::ParameterList& plist, const KeyTag& key_tag)
+{
+  if (type == "thaw depth") {
+    return parseDependencies<ParserThawDepth>(plist, key_tag);
+  } else if (type == "water table depth") {
+    return parseDependencies<ParserWaterTableDepth>(plist, key_tag);
+  } else if (type == "active layer average temperature") {
+    return parseDependencies<ParserActiveLayerAverageTemp>(plist, key_tag);
+  } else if (type == "column sum evaluator") {
+    return parseDependencies<ParserColumnSum>(plist, key_tag);
+  }
+  Errors::Message msg;
+  msg << "ColumnIntegratorsEvaluator for \"" << key_tag.first
+      << "\": unknown \"integrator type\" \"" << type << "\".";
+  Exceptions::amanzi_throw(msg);
+  return std::vector<KeyTag>();
+}
+
+
+std::unique_ptr<ColumnScanner>
+createColumnIntegrator(const std::string& type,
+                       Teuchos::ParameterList& plist,
+                       std::vector<const Epetra_MultiVector*>& deps,
+                       const AmanziMesh::Mesh* mesh)
+{
+  if (type == "thaw depth") {
+    return std::make_unique<ColumnScannerT<IntegratorThawDepth>>(plist, deps, mesh);
+  } else if (type == "water table depth") {
+    return std::make_unique<ColumnScannerT<IntegratorWaterTableDepth>>(plist, deps, mesh);
+  } else if (type == "active layer average temperature") {
+    return std::make_unique<ColumnScannerT<IntegratorActiveLayerAverageTemp>>(plist, deps, mesh);
+  } else {
+    AMANZI_ASSERT(type == "column sum evaluator");
+    return std::make_unique<ColumnScannerT<IntegratorColumnSum>>(plist, deps, mesh);
+  }
+}
+
+} // namespace Impl
+
+
+ColumnIntegratorsEvaluator::ColumnIntegratorsEvaluator(Teuchos::ParameterList& plist)
+  : EvaluatorSecondaryMonotypeCV(plist)
+{
+  Key domain = Keys::getDomain(my_keys_.front().first);
+  Tag tag = my_keys_.front().second;
+  my_keys_.clear();
+
+  if (!plist_.isSublist("integrated quantities")) {
+    Errors::Message msg;
+    msg << "ColumnIntegratorsEvaluator for \"" << plist_.name()
+        << "\": missing sublist \"integrated quantities\".";
+    Exceptions::amanzi_throw(msg);
+  }
+
+  auto& quantities_list = plist_.sublist("integrated quantities");
+  for (const auto& entry : quantities_list) {
+    if (!quantities_list.isSublist(entry.first)) continue;
+
+    Quantity q;
+    q.plist = quantities_list.sublist(entry.first);
+
+    // parameters of this list are defaults for each quantity
+    for (const auto& param : plist_) {
+      if (!plist_.isSublist(param.first) && !q.plist.isParameter(param.first))
+        q.plist.setEntry(param.first, param.second);
+    }
+    q.type = q.plist.get<std::string>("integrator type");
+
+    KeyTag key_tag{ Keys::getKey(domain, entry.first), tag };
+    q.dependencies = Impl::parseColumnIntegrator(q.type, q.plist, key_tag);
+    for (const auto& dep : q.dependencies) dependencies_.insert(dep);
+
+    my_keys_.emplace_back(key_tag);
+    quantities_.emplace_back(std::move(q));
+  }
+
+  if (my_keys_.size() == 0) {
+    Errors::Message msg;
+    msg << "ColumnIntegratorsEvaluator for \"" << plist_.name()
+        << "\": \"integrated quantities\" has no quantities.";
+    Exceptions::amanzi_throw(msg);
+  }
+}
+
+
+Teuchos::RCP<Evaluator>
+ColumnIntegratorsEvaluator::Clone() const
+{
+  return Teuchos::rcp(new ColumnIntegratorsEvaluator(*this));
+}
+
+
+// Implements custom EC to use dependencies from subsurface for surface
+// vector.
+void
+ColumnIntegratorsEvaluator::EnsureCompatibility_ToDeps_(State& S)
+{
+  const auto& fac = S.Require<CompositeVector, CompositeVectorSpace>(my_keys_.front().first,
+                                                                     my_keys_.front().second);
+  if (fac.Mesh() != Teuchos::null) {
+    CompositeVectorSpace dep_fac;
+    dep_fac.SetMesh(fac.Mesh()->parent())
+      ->SetGhosted(true)
+      ->AddComponent("cell", AmanziMesh::CELL, 1);
+
+    for (const auto& dep : dependencies_) {
+      if (Keys::getDomain(dep.first) == Keys::getDomain(my_keys_.front().first)) {
+        S.Require<CompositeVector, CompositeVectorSpace>(dep.first, dep.second).Update(fac);
+      } else {
+        S.Require<CompositeVector, CompositeVectorSpace>(dep.first, dep.second).Update(dep_fac);
+      }
+    }
+  }
+}
+
+
+void
+ColumnIntegratorsEvaluator::Evaluate_(const State& S, const std::vector<CompositeVector*>& result)
+{
+  auto mesh = result[0]->Mesh()->parent();
+  int n_quantities = quantities_.size();
+
+  // instantiate the integrator functors
+  std::vector<std::unique_ptr<Impl::ColumnScanner>> integrators;
+  std::vector<Epetra_MultiVector*> res(n_quantities);
+  for (int q = 0; q != n_quantities; ++q) {
+    std::vector<const Epetra_MultiVector*> deps;
+    for (const auto& dep : quantities_[q].dependencies) {
+      deps.emplace_back(
+        S.Get<CompositeVector>(dep.first, dep.second).ViewComponent("cell", false).get());
+    }
+    integrators.emplace_back(
+      Impl::createColumnIntegrator(quantities_[q].type, quantities_[q].plist, deps, &*mesh));
+    res[q] = result[q]->ViewComponent("cell", false).get();
+  }
+
+  std::vector<AmanziGeometry::Point> vals(n_quantities);
+  std::vector<bool> completed(n_quantities);
+  int ncols = res[0]->MyLength();
+  for (int col = 0; col != ncols; ++col) {
+    // walk the column once, scanning each quantity until it requests a stop
+    for (int q = 0; q != n_quantities; ++q) {
+      vals[q] = AmanziGeometry::Point(0., 0.);
+      completed[q] = false;
+    }
+    int n_scanning = n_quantities;
+
+    auto& col_cell = mesh->cells_of_column(col);
+    for (int i = 0; i != col_cell.size() && n_scanning > 0; ++i) {
+      for (int q = 0; q != n_quantities; ++q) {
+        if (!completed[q] && integrators[q]->scan(col, col_cell[i], vals[q])) {
+          completed[q] = true;
+          n_scanning--;
+        }
+      }
+    }
+
+    // as in EvaluatorColumnIntegrator, val[1] is an optional denominator
+    for (int q = 0; q != n_quantities; ++q) {
+      double coef = integrators[q]->coefficient(col);
+      if (vals[q][1] > 0.)
+        (*res[q])[0][col] = coef * vals[q][0] / vals[q][1];
+      else
+        (*res[q])[0][col] = coef * vals[q][0];
+    }
+  }
+}
+
+} // namespace Relations
+} // namespace Amanzi
@@ -0,0 +1,125 @@
+/*
+  Copyright 2010-202x held jointly by participating institutions.
+  ATS is released under the three-clause BSD License.
+  The terms of use and "as is" disclaimer for this license are
+  provided in the top-level COPYRIGHT file.
+
+  Authors:
+*/
+
+//! Computes several column-integrated quantities in one pass over the columns.
+/*!
+
+Each column integrator (thaw depth, water table depth, active layer average
+temperature, column sum) walks every column of the subsurface mesh.  When
+several of them are needed on the same surface, this evaluator computes them
+all together: each column is walked once, each quantity stops scanning when
+its own integrator requests it, and the walk ends once all have stopped.
+
+The evaluator provides one key per sublist of `"integrated quantities`".  Each
+sublist is named by the variable name (in this evaluator's surface domain) of
+the quantity it computes, and holds that quantity's `"integrator type`" and
+the parameters of the corresponding evaluator.  Parameters set directly in
+this evaluator's list (e.g. domain names) are defaults for all quantities.
+
+Evaluator name: `"column integrators`"
+
+.. _column-integrators-evaluator-spec:
+.. admonition:: column-integrators-evaluator-spec
+
+    * `"integrated quantities`" ``[column-integrator-spec-list]`` One per key.
+
+.. _column-integrator-spec:
+.. admonition:: column-integrator-spec
+
+    * `"integrator type`" ``[string]`` One of `"thaw depth`", `"water table
+      depth`", `"active layer average temperature`", or `"column sum
+      evaluator`".
+
+    INCLUDES:
+    - the spec of the evaluator of that type.
+
+Example:
+
+.. code-block:: xml
+
+   <ParameterList name="surface-thaw_depth">
+     <Parameter name="evaluator type" type="string" value="column integrators"/>
+     <ParameterList name="integrated quantities">
+       <ParameterList name="thaw_depth">
+         <Parameter name="integrator type" type="string" value="thaw depth"/>
+       </ParameterList>
+       <ParameterList name="water_table_depth">
+         <Parameter name="integrator type" type="string" value="water table depth"/>
+       </ParameterList>
+     </ParameterList>
+   </ParameterList>
+
+*/
+
+#pragma once
+
+#include <memory>
+
+#include "Factory.hh"
+#include "EvaluatorSecondaryMonotype.hh"
+
+namespace Amanzi {
+namespace Relations {
+
+namespace Impl {
+
+// Type-erased column integrator, see EvaluatorColumnIntegrator.hh for the
+// interface of the wrapped integrators.
+class ColumnScanner {
+ public:
+  virtual ~ColumnScanner() = default;
+  virtual int scan(AmanziMesh::Entity_ID col, AmanziMesh::Entity_ID c, AmanziGeometry::Point& p) = 0;
+  virtual double coefficient(AmanziMesh::Entity_ID col) = 0;
+};
+
+} // namespace Impl
+
+
+class ColumnIntegratorsEvaluator : public EvaluatorSecondaryMonotypeCV {
+ public:
+  explicit ColumnIntegratorsEvaluator(Teuchos::ParameterList& plist);
+  ColumnIntegratorsEvaluator(const ColumnIntegratorsEvaluator& other) = default;
+  Teuchos::RCP<Evaluator> Clone() const override;
+
+  // Disables derivatives
+  virtual bool
+  IsDifferentiableWRT(const State& S, const Key& wrt_key, const Tag& wrt_tag) const override
+  {
+    return false;
+  }
+
+ protected:
+  // Implements custom EC to use dependencies from subsurface for surface
+  // vector.
+  virtual void EnsureCompatibility_ToDeps_(State& S) override;
+
+  // Required methods from EvaluatorSecondaryMonotypeCV
+  virtual void Evaluate_(const State& S, const std::vector<CompositeVector*>& result) override;
+
+  virtual void EvaluatePartialDerivative_(const State& S,
+                                          const Key& wrt_key,
+                                          const Tag& wrt_tag,
+                                          const std::vector<CompositeVector*>& result) override
+  {
+    AMANZI_ASSERT(false); // not reachable, IsDifferentiableWRT() always false
+  }
+
+ private:
+  struct Quantity {
+    std::string type;
+    Teuchos::ParameterList plist;
+    std::vector<KeyTag> dependencies; // in the order the integrator expects
+  };
+  std::vector<Quantity> quantities_;
+
+  static Utils::RegisteredFactory<Evaluator, ColumnIntegratorsEvaluator> reg_;
+};
+
+} // namespace Relations
+} // namespace Amanzi
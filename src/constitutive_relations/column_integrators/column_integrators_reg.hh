@@ -11,6 +11,7 @@
 #include "activelayer_average_temp_evaluator.hh"
 #include "thaw_depth_evaluator.hh"
 #include "water_table_depth_evaluator.hh"
+#include "ColumnIntegratorsEvaluator.hh"
 
 
 namespace Amanzi {
@@ -28,6 +29,8 @@ Utils::RegisteredFactory<Evaluator, ThawDepthEvaluator> ThawDepthEvaluator::reg_
 template <>
 Utils::RegisteredFactory<Evaluator, WaterTableDepthEvaluator>
   WaterTableDepthEvaluator::reg_("water table depth");
+Utils::RegisteredFactory<Evaluator, ColumnIntegratorsEvaluator>
+  ColumnIntegratorsEvaluator::reg_("column integrators");
 
 } // namespace Relations
 } // namespace Amanzi
@@ -11,6 +11,9 @@
   EOS -- purely virtual base class for an EOS.
   std::vector<double> params contains parameters which define EOS.
 
+  Evaluators should prefer the *Batch() methods, which evaluate a whole mesh
+  component in one virtual call.
+
 */
 
 #ifndef AMANZI_RELATIONS_EOS_HH_
@@ -44,6 +47,61 @@ class EOS {
   virtual bool IsTemperature() = 0;
   virtual bool IsPressure() = 0;
   virtual bool IsConcentration() = 0;
+
+  int NumDependencies() { return IsConcentration() + IsTemperature() + IsPressure(); }
+
+  // Batch versions of the above, evaluated at n points.  deps[k] is an array
+  // of length n holding the k-th dependency, in the same order as params.
+  // The defaults pack params and call the pointwise methods; EOS which are
+  // evaluated on every cell should override these with an inlined kernel.
+  virtual void MassDensityBatch(int n, const double* const* deps, double* result)
+  {
+    evaluateBatch_(n, deps, result, [this](std::vector<double>& p) { return MassDensity(p); });
+  }
+  virtual void DMassDensityDTBatch(int n, const double* const* deps, double* result)
+  {
+    evaluateBatch_(n, deps, result, [this](std::vector<double>& p) { return DMassDensityDT(p); });
+  }
+  virtual void DMassDensityDpBatch(int n, const double* const* deps, double* result)
+  {
+    evaluateBatch_(n, deps, result, [this](std::vector<double>& p) { return DMassDensityDp(p); });
+  }
+  virtual void DMassDensityDCBatch(int n, const double* const* deps, double* result)
+  {
+    evaluateBatch_(n, deps, result, [this](std::vector<double>& p) { return DMassDensityDC(p); });
+  }
+
+  virtual void MolarDensityBatch(int n, const double* const* deps, double* result)
+  {
+    evaluateBatch_(n, deps, result, [this](std::vector<double>& p) { return MolarDensity(p); });
+  }
+  virtual void DMolarDensityDTBatch(int n, const double* const* deps, double* result)
+  {
+    evaluateBatch_(
+      n, deps, result, [this](std::vector<double>& p) { return DMolarDensityDT(p); });
+  }
+  virtual void DMolarDensityDpBatch(int n, const double* const* deps, double* result)
+  {
+    evaluateBatch_(
+      n, deps, result, [this](std::vector<double>& p) { return DMolarDensityDp(p); });
+  }
+  virtual void DMolarDensityDCBatch(int n, const double* const* deps, double* result)
+  {
+    evaluateBatch_(
+      n, deps, result, [this](std::vector<double>& p) { return DMolarDensityDC(p); });
+  }
+
+ protected:
+  template <typename F>
+  void evaluateBatch_(int n, const double* const* deps, double* result, const F& f)
+  {
+    int n_deps = NumDependencies();
+    std::vector<double> params(n_deps);
+    for (int i = 0; i != n; ++i) {
+      for (int k = 0; k != n_deps; ++k) params[k] = deps[k][i];
+      result[i] = f(params);
+    }
+  }
 };
 
 } // namespace Relations
@@ -39,41 +39,69 @@ EOSWater::EOSWater(Teuchos::ParameterList& eos_plist)
 double
 EOSWater::MassDensity(std::vector<double>& params)
 {
-  double T = params[0];
-  double p = std::max(params[1], 101325.);
-
-  double dT = T - kT0_;
-  double rho1bar = ka_ + (kb_ + (kc_ + kd_ * dT) * dT) * dT;
-  return rho1bar * (1.0 + kalpha_ * (p - kp0_));
+  return massDensity_(params[0], params[1]);
 };
 
-
 double
 EOSWater::DMassDensityDT(std::vector<double>& params)
 {
-  double T = params[0];
-  double p = std::max(params[1], 101325.);
-
-  double dT = T - kT0_;
-  double rho1bar = kb_ + (2.0 * kc_ + 3.0 * kd_ * dT) * dT;
-  return rho1bar * (1.0 + kalpha_ * (p - kp0_));
+  return dMassDensityDT_(params[0], params[1]);
 };
 
-
 double
 EOSWater::DMassDensityDp(std::vector<double>& params)
 {
-  double T = params[0];
-  double p = params[1];
-
-  if (p < 101325.) {
-    return 0.;
-  } else {
-    double dT = T - kT0_;
-    double rho1bar = ka_ + (kb_ + (kc_ + kd_ * dT) * dT) * dT;
-    return rho1bar * kalpha_;
-  }
+  return dMassDensityDp_(params[0], params[1]);
 };
 
+
+void
+EOSWater::MassDensityBatch(int n, const double* const* deps, double* result)
+{
+  const double* T = deps[0];
+  const double* p = deps[1];
+  for (int i = 0; i != n; ++i) result[i] = massDensity_(T[i], p[i]);
+}
+
+void
+EOSWater::DMassDensityDTBatch(int n, const double* const* deps, double* result)
+{
+  const double* T = deps[0];
+  const double* p = deps[1];
+  for (int i = 0; i != n; ++i) result[i] = dMassDensityDT_(T[i], p[i]);
+}
+
+void
+EOSWater::DMassDensityDpBatch(int n, const double* const* deps, double* result)
+{
+  const double* T = deps[0];
+  const double* p = deps[1];
+  for (int i = 0; i != n; ++i) result[i] = dMassDensityDp_(T[i], p[i]);
+}
+
+void
+EOSWater::MolarDensityBatch(int n, const double* const* deps, double* result)
+{
+  const double* T = deps[0];
+  const double* p = deps[1];
+  for (int i = 0; i != n; ++i) result[i] = massDensity_(T[i], p[i]) / M_;
+}
+
+void
+EOSWater::DMolarDensityDTBatch(int n, const double* const* deps, double* result)
+{
+  const double* T = deps[0];
+  const double* p = deps[1];
+  for (int i = 0; i != n; ++i) result[i] = dMassDensityDT_(T[i], p[i]) / M_;
+}
+
+void
+EOSWater::DMolarDensityDpBatch(int n, const double* const* deps, double* result)
+{
+  const double* T = deps[0];
+  const double* p = deps[1];
+  for (int i = 0; i != n; ++i) result[i] = dMassDensityDp_(T[i], p[i]) / M_;
+}
+
 } // namespace Relations
 } // namespace Amanzi
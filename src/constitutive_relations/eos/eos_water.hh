@@ -20,6 +20,8 @@
 #ifndef AMANZI_RELATIONS_EOS_WATER_HH_
 #define AMANZI_RELATIONS_EOS_WATER_HH_
 
+#include <algorithm>
+
 #include "Teuchos_ParameterList.hpp"
 
 #include "Factory.hh"
@@ -42,6 +44,38 @@ class EOSWater : public EOSConstantMolarMass {
   virtual bool IsTemperature() override { return true; }
   virtual bool IsPressure() override { return true; }
 
+  // deps = { T, p }
+  virtual void MassDensityBatch(int n, const double* const* deps, double* result) override;
+  virtual void DMassDensityDTBatch(int n, const double* const* deps, double* result) override;
+  virtual void DMassDensityDpBatch(int n, const double* const* deps, double* result) override;
+  virtual void MolarDensityBatch(int n, const double* const* deps, double* result) override;
+  virtual void DMolarDensityDTBatch(int n, const double* const* deps, double* result) override;
+  virtual void DMolarDensityDpBatch(int n, const double* const* deps, double* result) override;
+
+ private:
+  // pointwise kernels, shared by the scalar and batch methods
+  double massDensity_(double T, double p) const
+  {
+    p = std::max(p, 101325.);
+    double dT = T - kT0_;
+    double rho1bar = ka_ + (kb_ + (kc_ + kd_ * dT) * dT) * dT;
+    return rho1bar * (1.0 + kalpha_ * (p - kp0_));
+  }
+  double dMassDensityDT_(double T, double p) const
+  {
+    p = std::max(p, 101325.);
+    double dT = T - kT0_;
+    double rho1bar = kb_ + (2.0 * kc_ + 3.0 * kd_ * dT) * dT;
+    return rho1bar * (1.0 + kalpha_ * (p - kp0_));
+  }
+  double dMassDensityDp_(double T, double p) const
+  {
+    if (p < 101325.) return 0.;
+    double dT = T - kT0_;
+    double rho1bar = ka_ + (kb_ + (kc_ + kd_ * dT) * dT) * dT;
+    return rho1bar * kalpha_;
+  }
+
  private:
   Teuchos::ParameterList eos_plist_;
 
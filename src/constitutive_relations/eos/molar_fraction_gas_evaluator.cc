@@ -53,10 +53,9 @@ MolarFractionGasEvaluator::Evaluate_(const State& S, const std::vector<Composite
     Epetra_MultiVector& result_v = *(result[0]->ViewComponent(*comp, false));
 
     int count = result[0]->size(*comp);
-    for (int id = 0; id != count; ++id) {
-      AMANZI_ASSERT(temp_v[0][id] > 200.);
-      result_v[0][id] = sat_vapor_model_->SaturatedVaporPressure(temp_v[0][id]) / p_atm;
-    }
+    for (int id = 0; id != count; ++id) AMANZI_ASSERT(temp_v[0][id] > 200.);
+    sat_vapor_model_->SaturatedVaporPressureBatch(count, temp_v[0], result_v[0]);
+    for (int id = 0; id != count; ++id) result_v[0][id] /= p_atm;
   }
 }
 
@@ -80,9 +79,8 @@ MolarFractionGasEvaluator::EvaluatePartialDerivative_(const State& S,
     Epetra_MultiVector& result_v = *(result[0]->ViewComponent(*comp, false));
 
     int count = result[0]->size(*comp);
-    for (int id = 0; id != count; ++id) {
-      result_v[0][id] = sat_vapor_model_->DSaturatedVaporPressureDT(temp_v[0][id]) / p_atm;
-    }
+    sat_vapor_model_->DSaturatedVaporPressureDTBatch(count, temp_v[0], result_v[0]);
+    for (int id = 0; id != count; ++id) result_v[0][id] /= p_atm;
   }
 }
 
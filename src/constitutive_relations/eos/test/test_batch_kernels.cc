@@ -0,0 +1,264 @@
+/*
+  Copyright 2010-202x held jointly by participating institutions.
+  ATS is released under the three-clause BSD License.
+  The terms of use and "as is" disclaimer for this license are
+  provided in the top-level COPYRIGHT file.
+
+  Authors:
+*/
+
+// The batch methods of relations must match their pointwise methods, the
+// kernels shared by both must match reference values, and derivatives must
+// match finite differences.
+
+#include <cmath>
+#include <vector>
+#include "UnitTest++.h"
+
+#include "errors.hh"
+
+#include "Teuchos_ParameterList.hpp"
+
+#include "eos_water.hh"
+#include "eos_ideal_gas.hh"
+#include "viscosity_water.hh"
+#include "vapor_pressure_water.hh"
+
+using namespace Amanzi::Relations;
+
+namespace {
+
+// temperatures on both sides of freezing and of the viscosity fit's T1, and
+// pressures on both sides of the 1 atm floor
+struct BatchPoints {
+  BatchPoints()
+  {
+    for (double t : { 250., 273.15, 280., 293.15, 300., 350., 370. }) {
+      for (double p : { 90000., 101325., 2.e5, 1.e7 }) {
+        T.push_back(t);
+        p_.push_back(p);
+      }
+    }
+    n = T.size();
+    deps[0] = T.data();
+    deps[1] = p_.data();
+  }
+
+  int n;
+  std::vector<double> T, p_;
+  const double* deps[2];
+};
+
+void
+checkSame(const std::vector<double>& batch, const std::vector<double>& pointwise)
+{
+  CHECK_EQUAL(pointwise.size(), batch.size());
+  for (int i = 0; i != batch.size(); ++i)
+    CHECK_CLOSE(pointwise[i], batch[i], 1.e-14 * std::abs(pointwise[i]));
+}
+
+// compares an EOS's batch method against its pointwise method
+template <typename Batch, typename Pointwise>
+void
+checkEOS(const BatchPoints& pts, const Batch& batch, const Pointwise& pointwise)
+{
+  std::vector<double> result(pts.n), expected(pts.n);
+  batch(pts.n, pts.deps, result.data());
+  std::vector<double> params(2);
+  for (int i = 0; i != pts.n; ++i) {
+    params[0] = pts.T[i];
+    params[1] = pts.p_[i];
+    expected[i] = pointwise(params);
+  }
+  checkSame(result, expected);
+}
+
+// checks df against a centered difference of f at x
+template <typename F, typename DF>
+void
+checkDerivative(const F& f, const DF& df, double x, double h)
+{
+  double fd = (f(x + h) - f(x - h)) / (2 * h);
+  CHECK_CLOSE(fd, df(x), 1.e-6 * std::abs(fd));
+}
+
+// temperatures away from freezing and from the viscosity fit's T1, and
+// pressures above the 1 atm floor, where relations are smooth
+const std::vector<double> smooth_T = { 260., 280., 290., 300., 330., 360. };
+const std::vector<double> smooth_p = { 2.e5, 1.e7 };
+
+} // namespace
+
+
+TEST_FIXTURE(BatchPoints, EOS_WATER_BATCH)
+{
+  Teuchos::ParameterList plist;
+  EOSWater eos(plist);
+  using V = std::vector<double>;
+  using D = const double* const*;
+
+  checkEOS(
+    *this,
+    [&](int n, D deps, double* r) { eos.MassDensityBatch(n, deps, r); },
+    [&](V& params) { return eos.MassDensity(params); });
+  checkEOS(
+    *this,
+    [&](int n, D deps, double* r) { eos.DMassDensityDTBatch(n, deps, r); },
+    [&](V& params) { return eos.DMassDensityDT(params); });
+  checkEOS(
+    *this,
+    [&](int n, D deps, double* r) { eos.DMassDensityDpBatch(n, deps, r); },
+    [&](V& params) { return eos.DMassDensityDp(params); });
+  checkEOS(
+    *this,
+    [&](int n, D deps, double* r) { eos.MolarDensityBatch(n, deps, r); },
+    [&](V& params) { return eos.MolarDensity(params); });
+  checkEOS(
+    *this,
+    [&](int n, D deps, double* r) { eos.DMolarDensityDTBatch(n, deps, r); },
+    [&](V& params) { return eos.DMolarDensityDT(params); });
+  checkEOS(
+    *this,
+    [&](int n, D deps, double* r) { eos.DMolarDensityDpBatch(n, deps, r); },
+    [&](V& params) { return eos.DMolarDensityDp(params); });
+}
+
+
+// the ideal gas uses the base class's default batch methods
+TEST_FIXTURE(BatchPoints, EOS_IDEAL_GAS_DEFAULT_BATCH)
+{
+  Teuchos::ParameterList plist;
+  EOSIdealGas eos(plist);
+  using V = std::vector<double>;
+  using D = const double* const*;
+
+  checkEOS(
+    *this,
+    [&](int n, D deps, double* r) { eos.MolarDensityBatch(n, deps, r); },
+    [&](V& params) { return eos.MolarDensity(params); });
+  checkEOS(
+    *this,
+    [&](int n, D deps, double* r) { eos.DMolarDensityDTBatch(n, deps, r); },
+    [&](V& params) { return eos.DMolarDensityDT(params); });
+  checkEOS(
+    *this,
+    [&](int n, D deps, double* r) { eos.DMolarDensityDpBatch(n, deps, r); },
+    [&](V& params) { return eos.DMolarDensityDp(params); });
+}
+
+
+TEST_FIXTURE(BatchPoints, VISCOSITY_WATER_BATCH)
+{
+  Teuchos::ParameterList plist;
+  ViscosityWater visc(plist);
+
+  std::vector<double> result(n), expected(n);
+  visc.ViscosityBatch(n, T.data(), result.data());
+  for (int i = 0; i != n; ++i) expected[i] = visc.Viscosity(T[i]);
+  checkSame(result, expected);
+
+  visc.DViscosityDTBatch(n, T.data(), result.data());
+  for (int i = 0; i != n; ++i) expected[i] = visc.DViscosityDT(T[i]);
+  checkSame(result, expected);
+}
+
+
+// The fit as written before the batch kernels, with std::pow.
+TEST(VISCOSITY_WATER_REFERENCE)
+{
+  Teuchos::ParameterList plist;
+  ViscosityWater visc(plist);
+
+  for (double T = 250.; T <= 373.; T += 0.5) {
+    double dT = 293.15 - T;
+    double xi;
+    if (T < 293.15) {
+      double A = 998.333 + (-8.1855 + 0.00585 * dT) * dT;
+      xi = 1301.0 * (1.0 / A - 1.0 / 998.333);
+    } else {
+      double A = (1.3272 - 0.001053 * dT) * dT;
+      xi = A / (T - 168.15);
+    }
+    double expected = 0.001 * std::pow(10.0, xi);
+    CHECK_CLOSE(expected, visc.Viscosity(T), 1.e-14 * expected);
+  }
+}
+
+
+TEST(VISCOSITY_WATER_DERIVATIVES)
+{
+  Teuchos::ParameterList plist;
+  ViscosityWater visc(plist);
+  for (double T : smooth_T) {
+    checkDerivative([&](double x) { return visc.Viscosity(x); },
+                    [&](double x) { return visc.DViscosityDT(x); },
+                    T,
+                    1.e-4);
+  }
+}
+
+
+TEST(EOS_WATER_DERIVATIVES)
+{
+  Teuchos::ParameterList plist;
+  EOSWater eos(plist);
+  std::vector<double> params(2);
+  for (double T : smooth_T) {
+    for (double p : smooth_p) {
+      auto at = [&](double t, double pp) -> std::vector<double>& {
+        params[0] = t;
+        params[1] = pp;
+        return params;
+      };
+      checkDerivative([&](double x) { return eos.MassDensity(at(x, p)); },
+                      [&](double x) { return eos.DMassDensityDT(at(x, p)); },
+                      T,
+                      1.e-4);
+      checkDerivative([&](double x) { return eos.MolarDensity(at(x, p)); },
+                      [&](double x) { return eos.DMolarDensityDT(at(x, p)); },
+                      T,
+                      1.e-4);
+      checkDerivative([&](double x) { return eos.MassDensity(at(T, x)); },
+                      [&](double x) { return eos.DMassDensityDp(at(T, x)); },
+                      p,
+                      1.e-3 * p);
+      checkDerivative([&](double x) { return eos.MolarDensity(at(T, x)); },
+                      [&](double x) { return eos.DMolarDensityDp(at(T, x)); },
+                      p,
+                      1.e-3 * p);
+    }
+  }
+}
+
+
+TEST(VAPOR_PRESSURE_WATER_DERIVATIVES)
+{
+  Teuchos::ParameterList plist;
+  VaporPressureWater vp(plist);
+  for (double T : smooth_T) {
+    checkDerivative([&](double x) { return vp.SaturatedVaporPressure(x); },
+                    [&](double x) { return vp.DSaturatedVaporPressureDT(x); },
+                    T,
+                    1.e-4);
+  }
+}
+
+
+TEST_FIXTURE(BatchPoints, VAPOR_PRESSURE_WATER_BATCH)
+{
+  Teuchos::ParameterList plist;
+  VaporPressureWater vp(plist);
+
+  std::vector<double> result(n), expected(n);
+  vp.SaturatedVaporPressureBatch(n, T.data(), result.data());
+  for (int i = 0; i != n; ++i) expected[i] = vp.SaturatedVaporPressure(T[i]);
+  checkSame(result, expected);
+
+  vp.DSaturatedVaporPressureDTBatch(n, T.data(), result.data());
+  for (int i = 0; i != n; ++i) expected[i] = vp.DSaturatedVaporPressureDT(T[i]);
+  checkSame(result, expected);
+
+  // out of the fit's range, the batch throws as the pointwise method does
+  T[n / 2] = 400.;
+  CHECK_THROW(vp.SaturatedVaporPressureBatch(n, T.data(), result.data()), Errors::CutTimeStep);
+}
@@ -26,6 +26,16 @@ class VaporPressureRelation {
 
   virtual double SaturatedVaporPressure(double T) = 0;
   virtual double DSaturatedVaporPressureDT(double T) = 0;
+
+  // Batch versions, evaluated at n temperatures.
+  virtual void SaturatedVaporPressureBatch(int n, const double* T, double* result)
+  {
+    for (int i = 0; i != n; ++i) result[i] = SaturatedVaporPressure(T[i]);
+  }
+  virtual void DSaturatedVaporPressureDTBatch(int n, const double* T, double* result)
+  {
+    for (int i = 0; i != n; ++i) result[i] = DSaturatedVaporPressureDT(T[i]);
+  }
 };
 
 } // namespace Relations
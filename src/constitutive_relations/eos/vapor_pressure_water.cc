@@ -30,27 +30,51 @@ VaporPressureWater::VaporPressureWater(Teuchos::ParameterList& plist)
     kd_(2.433502)
 {}
 
-double
-VaporPressureWater::SaturatedVaporPressure(double T)
+
+void
+VaporPressureWater::CheckTemperature_(double T, bool cut) const
 {
   if (T < 100. || T > 373.0) {
     std::cout << "Invalid temperature, T = " << T << std::endl;
-    Exceptions::amanzi_throw(Errors::CutTimeStep());
+    if (cut) {
+      Exceptions::amanzi_throw(Errors::CutTimeStep());
+    } else {
+      Errors::Message m("Cut time step");
+      Exceptions::amanzi_throw(m);
+    }
   }
-  return 100.0 * exp(ka0_ + ka_ / T + (kb_ + kc_ * T) * T + kd_ * log(T));
+}
+
+
+double
+VaporPressureWater::SaturatedVaporPressure(double T)
+{
+  CheckTemperature_(T, true);
+  return pressure_(T);
 };
 
 double
 VaporPressureWater::DSaturatedVaporPressureDT(double T)
 {
-  if (T < 100. || T > 373.0) {
-    std::cout << "Invalid temperature, T = " << T << std::endl;
-    Errors::Message m("Cut time step");
-    Exceptions::amanzi_throw(m);
-  }
-  return SaturatedVaporPressure(T) * (-ka_ / (T * T) + kb_ + 2.0 * kc_ * T + kd_ / T);
+  CheckTemperature_(T, false);
+  return dPressureDT_(T);
 };
 
 
+void
+VaporPressureWater::SaturatedVaporPressureBatch(int n, const double* T, double* result)
+{
+  for (int i = 0; i != n; ++i) CheckTemperature_(T[i], true);
+  for (int i = 0; i != n; ++i) result[i] = pressure_(T[i]);
+}
+
+void
+VaporPressureWater::DSaturatedVaporPressureDTBatch(int n, const double* T, double* result)
+{
+  for (int i = 0; i != n; ++i) CheckTemperature_(T[i], false);
+  for (int i = 0; i != n; ++i) result[i] = dPressureDT_(T[i]);
+}
+
+
 } // namespace Relations
 } // namespace Amanzi
@@ -18,6 +18,8 @@
 #define AMANZI_RELATIONS_EOS_WATER_VAPOR_PRESSURE_HH_
 
 
+#include <cmath>
+
 #include "Teuchos_ParameterList.hpp"
 #include "Factory.hh"
 #include "vapor_pressure_relation.hh"
@@ -32,7 +34,23 @@ class VaporPressureWater : public VaporPressureRelation {
   virtual double SaturatedVaporPressure(double T);
   virtual double DSaturatedVaporPressureDT(double T);
 
+  virtual void SaturatedVaporPressureBatch(int n, const double* T, double* result);
+  virtual void DSaturatedVaporPressureDTBatch(int n, const double* T, double* result);
+
  private:
+  // the fit is valid on [100, 373] K
+  void CheckTemperature_(double T, bool cut) const;
+
+  double pressure_(double T) const
+  {
+    return 100.0 * std::exp(ka0_ + ka_ / T + (kb_ + kc_ * T) * T + kd_ * std::log(T));
+  }
+  double dPressureDT_(double T) const
+  {
+    return pressure_(T) * (-ka_ / (T * T) + kb_ + 2.0 * kc_ * T + kd_ / T);
+  }
+
+
   Teuchos::ParameterList plist_;
   const double ka0_;
   const double ka_, kb_, kc_, kd_;
@@ -56,10 +56,8 @@ ViscosityEvaluator::Evaluate_(const State& S, const std::vector<CompositeVector*
     Epetra_MultiVector& result_v = *(result[0]->ViewComponent(*comp, false));
 
     int count = result[0]->size(*comp);
-    for (int id = 0; id != count; ++id) {
-      AMANZI_ASSERT(temp_v[0][id] > 200.);
-      result_v[0][id] = visc_->Viscosity(temp_v[0][id]);
-    }
+    for (int id = 0; id != count; ++id) AMANZI_ASSERT(temp_v[0][id] > 200.);
+    visc_->ViscosityBatch(count, temp_v[0], result_v[0]);
   }
 }
 
@@ -82,7 +80,7 @@ ViscosityEvaluator::EvaluatePartialDerivative_(const State& S,
     Epetra_MultiVector& result_v = *(result[0]->ViewComponent(*comp, false));
 
     int count = result[0]->size(*comp);
-    for (int id = 0; id != count; ++id) { result_v[0][id] = visc_->DViscosityDT(temp_v[0][id]); }
+    visc_->DViscosityDTBatch(count, temp_v[0], result_v[0]);
   }
 }
 
@@ -26,6 +26,17 @@ class ViscosityRelation {
   // Virtual methods that form the Viscosity
   virtual double Viscosity(double T) = 0;
   virtual double DViscosityDT(double T) = 0;
+
+  // Batch versions, evaluated at n temperatures.  Relations evaluated on
+  // every cell should override these with an inlined kernel.
+  virtual void ViscosityBatch(int n, const double* T, double* result)
+  {
+    for (int i = 0; i != n; ++i) result[i] = Viscosity(T[i]);
+  }
+  virtual void DViscosityDTBatch(int n, const double* T, double* result)
+  {
+    for (int i = 0; i != n; ++i) result[i] = DViscosityDT(T[i]);
+  }
 };
 
 } // namespace Relations
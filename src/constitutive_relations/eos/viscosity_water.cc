@@ -17,6 +17,8 @@
 
 */
 
+#include <cmath>
+
 #include "errors.hh"
 #include "viscosity_water.hh"
 
@@ -33,53 +35,72 @@ ViscosityWater::ViscosityWater(Teuchos::ParameterList& eos_plist)
     kT1_(293.15){};
 
 
+// 10^xi is evaluated as exp(xi ln 10), which is cheaper than std::pow
+static const double kLn10 = std::log(10.);
+
+
 double
-ViscosityWater::Viscosity(double T)
+ViscosityWater::viscosity_(double T) const
 {
-  double dT = kT1_ - T;
-  double xi;
-  if (T < kT1_) {
-    double A = kav1_ + (kbv1_ + kcv1_ * dT) * dT;
-    xi = 1301.0 * (1.0 / A - 1.0 / kav1_);
-  } else {
-    double A = (kbv2_ + kcv2_ * dT) * dT;
-    xi = A / (T - 168.15);
-  }
-  double visc = 0.001 * std::pow(10.0, xi);
+  double visc = 0.001 * std::exp(xi_(T) * kLn10);
 
   if (visc < 1.e-16) {
     std::cout << "Invalid temperature, T = " << T << std::endl;
     Exceptions::amanzi_throw(Errors::CutTimeStep());
   }
   return visc;
-};
+}
+
 
 double
-ViscosityWater::DViscosityDT(double T)
+ViscosityWater::dViscosityDT_(double T) const
 {
   double dT = kT1_ - T;
-  double xi;
   double dxi_dT;
 
   if (T < kT1_) {
     double A = kav1_ + (kbv1_ + kcv1_ * dT) * dT;
-    double dxi_dA = -1301. * std::pow(A, -2);
+    double dxi_dA = -1301. / (A * A);
     double dA_dT = -(kbv1_ + 2 * kcv1_ * dT);
-    xi = 1301.0 * (1.0 / A - 1.0 / kav1_);
     dxi_dT = dxi_dA * dA_dT;
 
   } else {
     double A = (kbv2_ + kcv2_ * dT) * dT;
-    double dA_dT = kbv2_ + 2 * kcv2_ * dT;
-    xi = A / (T - 168.15);
-    dxi_dT = dA_dT / (T - 168.15) - A * std::pow(T - 168.15, -2);
+    double dA_dT = -(kbv2_ + 2 * kcv2_ * dT);
+    double Tc = T - 168.15;
+    dxi_dT = dA_dT / Tc - A / (Tc * Tc);
   }
 
-
-  double dvisc_dxi = 0.001 * std::pow(10.0, xi) * std::log(10.);
+  double dvisc_dxi = 0.001 * std::exp(xi_(T) * kLn10) * kLn10;
   return dvisc_dxi * dxi_dT;
+}
+
+
+double
+ViscosityWater::Viscosity(double T)
+{
+  return viscosity_(T);
+};
+
+double
+ViscosityWater::DViscosityDT(double T)
+{
+  return dViscosityDT_(T);
 };
 
 
+void
+ViscosityWater::ViscosityBatch(int n, const double* T, double* result)
+{
+  for (int i = 0; i != n; ++i) result[i] = viscosity_(T[i]);
+}
+
+void
+ViscosityWater::DViscosityDTBatch(int n, const double* T, double* result)
+{
+  for (int i = 0; i != n; ++i) result[i] = dViscosityDT_(T[i]);
+}
+
+
 } // namespace Relations
 } // namespace Amanzi
@@ -43,7 +43,26 @@ class ViscosityWater : public ViscosityRelation {
   virtual double Viscosity(double T);
   virtual double DViscosityDT(double T);
 
+  virtual void ViscosityBatch(int n, const double* T, double* result);
+  virtual void DViscosityDTBatch(int n, const double* T, double* result);
+
  protected:
+  // exponent of the fit, visc = 1e-3 * 10^xi
+  double xi_(double T) const
+  {
+    double dT = kT1_ - T;
+    if (T < kT1_) {
+      double A = kav1_ + (kbv1_ + kcv1_ * dT) * dT;
+      return 1301.0 * (1.0 / A - 1.0 / kav1_);
+    } else {
+      double A = (kbv2_ + kcv2_ * dT) * dT;
+      return A / (T - 168.15);
+    }
+  }
+  double viscosity_(double T) const;
+  double dViscosityDT_(double T) const;
+
+
   Teuchos::ParameterList eos_plist_;
 
   // constants for water, hard-coded because it would be crazy to try to come
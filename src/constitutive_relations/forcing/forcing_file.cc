@@ -0,0 +1,193 @@
+/*
+  Copyright 2010-202x held jointly by participating institutions.
+  ATS is released under the three-clause BSD License.
+  The terms of use and "as is" disclaimer for this license are
+  provided in the top-level COPYRIGHT file.
+
+  Authors:
+*/
+
+#include <algorithm>
+#include <cerrno>
+#include <cmath>
+#include <cstring>
+#include <map>
+#include <mutex>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "errors.hh"
+#include "forcing_file.hh"
+
+namespace Amanzi {
+namespace Relations {
+
+namespace {
+
+const char magic[] = "ATSFRC01";
+const std::size_t name_length = 64;
+
+} // namespace
+
+
+ForcingFile::ForcingFile(const std::string& filename)
+  : filename_(filename), data_(nullptr), size_(0)
+{
+  int fd = open(filename.c_str(), O_RDONLY);
+  struct stat st;
+  if (fd < 0 || fstat(fd, &st) != 0) {
+    if (fd >= 0) close(fd);
+    Errors::Message msg;
+    msg << "ForcingFile: cannot open \"" << filename << "\": " << std::strerror(errno);
+    Exceptions::amanzi_throw(msg);
+  }
+  size_ = st.st_size;
+
+  std::size_t header_size = 8 + 4 * sizeof(std::int64_t) + 4 * sizeof(double);
+  if (size_ >= header_size) {
+    data_ = mmap(nullptr, size_, PROT_READ, MAP_SHARED, fd, 0);
+    if (data_ == MAP_FAILED) data_ = nullptr;
+  }
+  close(fd);
+  if (data_ == nullptr || std::memcmp(data_, magic, 8) != 0) {
+    if (data_) munmap(data_, size_);
+    Errors::Message msg;
+    msg << "ForcingFile: \"" << filename << "\" is not a valid ATS binary forcing file.";
+    Exceptions::amanzi_throw(msg);
+  }
+
+  const char* p = static_cast<const char*>(data_) + 8;
+  std::int64_t dims[4];
+  std::memcpy(dims, p, sizeof(dims));
+  p += sizeof(dims);
+  double grid[4];
+  std::memcpy(grid, p, sizeof(grid));
+  p += sizeof(grid);
+
+  n_vars_ = dims[0];
+  n_times_ = dims[1];
+  nx_ = dims[2];
+  ny_ = dims[3];
+  x0_ = grid[0];
+  y0_ = grid[1];
+  dx_ = grid[2];
+  dy_ = grid[3];
+
+  header_size += n_vars_ * name_length + n_times_ * sizeof(double);
+  std::size_t expected =
+    header_size + (std::size_t)n_vars_ * n_times_ * nx_ * ny_ * sizeof(double);
+  if (n_vars_ < 1 || n_times_ < 1 || nx_ < 1 || ny_ < 1 || size_ < expected) {
+    munmap(data_, size_);
+    Errors::Message msg;
+    msg << "ForcingFile: \"" << filename << "\" is truncated or has invalid dimensions.";
+    Exceptions::amanzi_throw(msg);
+  }
+
+  for (int v = 0; v != n_vars_; ++v) {
+    names_.emplace_back(p, strnlen(p, name_length));
+    p += name_length;
+  }
+  times_ = reinterpret_cast<const double*>(p);
+  values_ = times_ + n_times_;
+}
+
+
+ForcingFile::~ForcingFile()
+{
+  if (data_) munmap(data_, size_);
+}
+
+
+Teuchos::RCP<const ForcingFile>
+ForcingFile::Get(const std::string& filename)
+{
+  // Files are cached by name.  Only weak references are kept, so that a file
+  // is unmapped once its last user is destroyed.  Evaluators may be updated on
+  // multiple threads, so access is serialized.
+  static std::map<std::string, Teuchos::RCP<const ForcingFile>> cache;
+  static std::mutex mutex;
+  std::lock_guard<std::mutex> lock(mutex);
+
+  auto entry = cache.find(filename);
+  if (entry != cache.end() && entry->second.is_valid_ptr()) return entry->second.create_strong();
+
+  // a new file is mapped, so drop the entries of files since unmapped
+  for (auto it = cache.begin(); it != cache.end();) {
+    if (it->second.is_valid_ptr()) {
+      ++it;
+    } else {
+      it = cache.erase(it);
+    }
+  }
+
+  auto file = Teuchos::rcp(new ForcingFile(filename));
+  cache[filename] = file.create_weak();
+  return file;
+}
+
+
+int
+ForcingFile::VariableIndex(const std::string& name) const
+{
+  auto it = std::find(names_.begin(), names_.end(), name);
+  if (it == names_.end()) {
+    Errors::Message msg;
+    msg << "ForcingFile: variable \"" << name << "\" is not in \"" << filename_
+        << "\", valid are:";
+    for (const auto& n : names_) msg << " \"" << n << "\"";
+    Exceptions::amanzi_throw(msg);
+  }
+  return it - names_.begin();
+}
+
+
+int
+ForcingFile::CellIndex(double x, double y) const
+{
+  int i = dx_ > 0. ? (int)std::lround((x - x0_) / dx_) : 0;
+  int j = dy_ > 0. ? (int)std::lround((y - y0_) / dy_) : 0;
+  if (i < 0 || i >= nx_ || j < 0 || j >= ny_) {
+    Errors::Message msg;
+    msg << "ForcingFile: point (" << x << ", " << y << ") is outside of the forcing grid of \""
+        << filename_ << "\", which covers [" << x0_ - dx_ / 2 << ", " << x0_ + (nx_ - 0.5) * dx_
+        << "] x [" << y0_ - dy_ / 2 << ", " << y0_ + (ny_ - 0.5) * dy_ << "].";
+    Exceptions::amanzi_throw(msg);
+  }
+  return i * ny_ + j;
+}
+
+
+int
+ForcingFile::TimeIndex(double t) const
+{
+  return (std::upper_bound(times_, times_ + n_times_, t) - times_) - 1;
+}
+
+
+const double*
+ForcingFile::Snapshot(int var, int k) const
+{
+  AMANZI_ASSERT(0 <= var && var < n_vars_ && 0 <= k && k < n_times_);
+  return values_ + ((std::size_t)var * n_times_ + k) * num_cells();
+}
+
+
+void
+ForcingFile::Prefetch(int var, int k) const
+{
+  if (k < 0 || k >= n_times_) return;
+
+  // advice must start on a page boundary
+  std::size_t page = sysconf(_SC_PAGESIZE);
+  std::size_t begin = reinterpret_cast<const char*>(Snapshot(var, k)) -
+                      static_cast<const char*>(data_);
+  std::size_t end = begin + num_cells() * sizeof(double);
+  begin -= begin % page;
+  posix_madvise(static_cast<char*>(data_) + begin, end - begin, POSIX_MADV_WILLNEED);
+}
+
+} // namespace Relations
+} // namespace Amanzi
@@ -0,0 +1,103 @@
+/*
+  Copyright 2010-202x held jointly by participating institutions.
+  ATS is released under the three-clause BSD License.
+  The terms of use and "as is" disclaimer for this license are
+  provided in the top-level COPYRIGHT file.
+
+  Authors:
+*/
+
+/*
+  ForcingFile is a read-only, memory-mapped view of a binary file of gridded
+  time-series forcing (e.g. DayMet meteorological data), as written by
+  tools/utils/met_to_binary.py.
+
+  The file is, in native (little-endian) byte order:
+
+    char[8]               magic, "ATSFRC01"
+    int64[4]              n_vars, n_times, nx, ny
+    double[4]             x0, y0, dx, dy
+    char[64] * n_vars     variable names, NUL-padded
+    double * n_times      times [s], increasing
+    double * n_vars * n_times * nx * ny
+                          data, by variable, then time, then forcing cell
+
+  Forcing cells are the cells of a regular grid whose cell (i,j) is centered
+  at (x0 + i*dx, y0 + j*dy), and are indexed i*ny + j.  A grid with nx = ny =
+  1 is point (spatially uniform) forcing.
+
+  Nothing is read at construction beyond the header; the snapshots are paged
+  in by the OS as they are used, and Prefetch() asks it to do so ahead of
+  time, asynchronously.  Files are shared: Get() returns the same object for
+  the same filename, so many forcing variables in one file map it once.  The
+  file is unmapped when the last of them is destroyed.
+*/
+
+#ifndef AMANZI_RELATIONS_FORCING_FILE_HH_
+#define AMANZI_RELATIONS_FORCING_FILE_HH_
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "Teuchos_RCP.hpp"
+
+namespace Amanzi {
+namespace Relations {
+
+class ForcingFile {
+ public:
+  explicit ForcingFile(const std::string& filename);
+  ~ForcingFile();
+
+  ForcingFile(const ForcingFile& other) = delete;
+  ForcingFile& operator=(const ForcingFile& other) = delete;
+
+  // Returns the shared file of this name, mapping it if it is not in use.
+  // Thread-safe.
+  static Teuchos::RCP<const ForcingFile> Get(const std::string& filename);
+
+  const std::string& filename() const { return filename_; }
+
+  // Index of the variable of this name.  Throws if it is not in the file.
+  int VariableIndex(const std::string& name) const;
+  const std::vector<std::string>& variables() const { return names_; }
+
+  int num_times() const { return n_times_; }
+  const double* times() const { return times_; }
+
+  // grid of forcing cells
+  int nx() const { return nx_; }
+  int ny() const { return ny_; }
+  int num_cells() const { return nx_ * ny_; }
+
+  // Index of the forcing cell containing the point (x,y).  Throws if the
+  // point is outside of the grid.
+  int CellIndex(double x, double y) const;
+
+  // Index of the last time <= t, or -1 if t < times()[0].
+  int TimeIndex(double t) const;
+
+  // Snapshot of variable var at time index k, of length num_cells().
+  const double* Snapshot(int var, int k) const;
+
+  // Asks the OS to asynchronously read the snapshot into memory.
+  void Prefetch(int var, int k) const;
+
+ private:
+  std::string filename_;
+  void* data_;
+  std::size_t size_;
+
+  int n_vars_, n_times_, nx_, ny_;
+  double x0_, y0_, dx_, dy_;
+  std::vector<std::string> names_;
+  const double* times_;
+  const double* values_;
+};
+
+} // namespace Relations
+} // namespace Amanzi
+
+#endif
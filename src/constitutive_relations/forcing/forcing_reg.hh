@@ -0,0 +1,20 @@
+/*
+  Copyright 2010-202x held jointly by participating institutions.
+  ATS is released under the three-clause BSD License.
+  The terms of use and "as is" disclaimer for this license are
+  provided in the top-level COPYRIGHT file.
+
+  Authors:
+*/
+
+#include "gridded_forcing_evaluator.hh"
+
+namespace Amanzi {
+namespace Relations {
+
+// registry of method
+Utils::RegisteredFactory<Evaluator, GriddedForcingEvaluator>
+  GriddedForcingEvaluator::reg_("gridded forcing");
+
+} // namespace Relations
+} // namespace Amanzi
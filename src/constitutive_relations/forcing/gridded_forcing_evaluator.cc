@@ -0,0 +1,146 @@
+/*
+  Copyright 2010-202x held jointly by participating institutions.
+  ATS is released under the three-clause BSD License.
+  The terms of use and "as is" disclaimer for this license are
+  provided in the top-level COPYRIGHT file.
+
+  Authors:
+*/
+
+#include <algorithm>
+
+#include "gridded_forcing_evaluator.hh"
+
+namespace Amanzi {
+namespace Relations {
+
+
+GriddedForcingEvaluator::GriddedForcingEvaluator(Teuchos::ParameterList& plist)
+  : EvaluatorIndependentCV(plist), window_(-1)
+{
+  if (!plist_.isParameter("forcing file") || !plist_.isParameter("variable name")) {
+    Errors::Message msg;
+    msg << "In evaluator GriddedForcingEvaluator for \"" << my_key_
+        << "\": \"forcing file\" and \"variable name\" are required.";
+    Exceptions::amanzi_throw(msg);
+  }
+  file_ = ForcingFile::Get(plist_.get<std::string>("forcing file"));
+  var_ = file_->VariableIndex(plist_.get<std::string>("variable name"));
+
+  auto interp = plist_.get<std::string>("interpolation", "linear");
+  if (interp != "linear" && interp != "constant") {
+    Errors::Message msg;
+    msg << "In evaluator GriddedForcingEvaluator for \"" << my_key_ << "\": invalid interpolation \""
+        << interp << "\", valid are \"linear\" and \"constant\"";
+    Exceptions::amanzi_throw(msg);
+  }
+  linear_ = interp == "linear";
+  temporally_variable_ = true;
+}
+
+
+Teuchos::RCP<Evaluator>
+GriddedForcingEvaluator::Clone() const
+{
+  return Teuchos::rcp(new GriddedForcingEvaluator(*this));
+}
+
+
+void
+GriddedForcingEvaluator::BuildMap_(const AmanziMesh::Mesh& mesh, int ncells)
+{
+  std::vector<int> index(file_->num_cells(), -1);
+  std::vector<int> forcing_cell(ncells);
+  for (int c = 0; c != ncells; ++c) {
+    const auto& xc = mesh.cell_centroid(c);
+    forcing_cell[c] = file_->CellIndex(xc[0], xc[1]);
+    index[forcing_cell[c]] = 0;
+  }
+
+  // number the used forcing cells in file order, so gathers walk forward
+  used_.clear();
+  for (int f = 0; f != (int)index.size(); ++f) {
+    if (index[f] == 0) {
+      index[f] = used_.size();
+      used_.push_back(f);
+    }
+  }
+
+  cell_index_.resize(ncells);
+  for (int c = 0; c != ncells; ++c) cell_index_[c] = index[forcing_cell[c]];
+
+  lo_.resize(used_.size());
+  hi_.resize(used_.size());
+  values_.resize(used_.size());
+  window_ = -1;
+}
+
+
+void
+GriddedForcingEvaluator::LoadWindow_(int k0, int k1)
+{
+  const double* lo = file_->Snapshot(var_, k0);
+  const double* hi = file_->Snapshot(var_, k1);
+  int n = used_.size();
+  for (int i = 0; i != n; ++i) {
+    lo_[i] = lo[used_[i]];
+    hi_[i] = hi[used_[i]];
+  }
+  window_ = k0;
+
+  // the next window will need the following snapshot
+  file_->Prefetch(var_, k1 + 1);
+}
+
+
+void
+GriddedForcingEvaluator::Update_(State& S)
+{
+  CompositeVector& result = S.GetW<CompositeVector>(my_key_, my_tag_, my_key_);
+  for (const auto& comp : result) {
+    if (comp != "cell") {
+      Errors::Message msg;
+      msg << "GriddedForcingEvaluator: forcing on mesh entities named \"" << comp
+          << "\" is not supported.";
+      Exceptions::amanzi_throw(msg);
+    }
+  }
+  Epetra_MultiVector& res = *result.ViewComponent("cell", false);
+  int ncells = res.MyLength();
+  if ((int)cell_index_.size() != ncells) BuildMap_(*result.Mesh(), ncells);
+
+  // find the window containing t, holding the end values outside of the data;
+  // each k0 always pairs with the same k1
+  double t = S.get_time(my_tag_);
+  int ntimes = file_->num_times();
+  int k0 = file_->TimeIndex(t);
+  int k1 = k0 + 1;
+  double w = 0.;
+  if (k0 < 0) {
+    k0 = 0;
+    k1 = std::min(1, ntimes - 1);
+  } else if (k1 >= ntimes) {
+    k0 = k1 = ntimes - 1;
+  } else if (linear_) {
+    const double* times = file_->times();
+    w = (t - times[k0]) / (times[k1] - times[k0]);
+  }
+  if (k0 != window_) LoadWindow_(k0, k1);
+
+  // interpolate on the forcing cells, then gather to mesh cells
+  const double* vals = lo_.data();
+  if (w > 0.) {
+    int n = values_.size();
+    const double* lo = lo_.data();
+    const double* hi = hi_.data();
+    double* v = values_.data();
+    for (int i = 0; i < n; ++i) v[i] = lo[i] + w * (hi[i] - lo[i]);
+    vals = v;
+  }
+  double* r = res[0];
+  const int* index = cell_index_.data();
+  for (int c = 0; c < ncells; ++c) r[c] = vals[index[c]];
+}
+
+} // namespace Relations
+} // namespace Amanzi
@@ -0,0 +1,96 @@
+/*
+  Copyright 2010-202x held jointly by participating institutions.
+  ATS is released under the three-clause BSD License.
+  The terms of use and "as is" disclaimer for this license are
+  provided in the top-level COPYRIGHT file.
+
+  Authors:
+*/
+
+//! Reads a forcing variable from a memory-mapped, gridded binary forcing file.
+/*!
+
+An independent variable, typically meteorological forcing on the surface mesh,
+whose values are read from a binary forcing file (see
+`tools/utils/met_to_binary.py`, which converts the HDF5 files written by
+`daymet_to_ats.py` and `daymet_to_ats_box.py`).
+
+Compared to a function-based independent variable, which reads (and, for
+gridded data, interpolates) a full snapshot of the forcing for every cell at
+every time step:
+
+- The file is memory-mapped and shared by all variables read from it.  Only
+  the two snapshots bracketing the current time are touched, and the next
+  one is prefetched asynchronously when the time window advances.
+- The map from mesh cells to forcing cells is computed once, from the cell
+  centroids, by the first evaluation.
+- Interpolation in time is done once per forcing cell used by this process
+  (rather than per mesh cell), and then gathered to the mesh cells.
+
+The mesh and the forcing grid must share coordinates, and the grid must cover
+the mesh: a mesh cell whose centroid is outside of the forcing grid is an
+error.  Before the first and after the last time in the file, the first and
+last values are used.
+
+`"evaluator type`" = `"gridded forcing`"
+
+.. _gridded-forcing-evaluator-spec:
+.. admonition:: gridded-forcing-evaluator-spec
+
+   * `"forcing file`" ``[string]`` Path to the binary forcing file.
+
+   * `"variable name`" ``[string]`` Name of the variable in the file,
+     e.g. `"air temperature [K]`".
+
+   * `"interpolation`" ``[string]`` **linear** One of `"linear`" or
+     `"constant`" (the last value at or before the current time is used,
+     e.g. for daily data).
+
+*/
+
+#pragma once
+
+#include <vector>
+
+#include "Factory.hh"
+#include "EvaluatorIndependent.hh"
+#include "forcing_file.hh"
+
+namespace Amanzi {
+namespace Relations {
+
+class GriddedForcingEvaluator : public EvaluatorIndependentCV {
+ public:
+  explicit GriddedForcingEvaluator(Teuchos::ParameterList& plist);
+  GriddedForcingEvaluator(const GriddedForcingEvaluator& other) = default;
+
+  virtual Teuchos::RCP<Evaluator> Clone() const override;
+
+ protected:
+  // Required methods from IndependentVariableEvaluator
+  virtual void Update_(State& S) override;
+
+  // Maps the owned cells of mesh to the forcing cells used.
+  void BuildMap_(const AmanziMesh::Mesh& mesh, int ncells);
+
+  // Gathers the snapshots k0 and k1 of the forcing cells used.
+  void LoadWindow_(int k0, int k1);
+
+ protected:
+  Teuchos::RCP<const ForcingFile> file_;
+  int var_;
+  bool linear_;
+
+  std::vector<int> used_;       // forcing cells used, in file order
+  std::vector<int> cell_index_; // index into used_, by mesh cell
+
+  int window_; // time index of lo_, or -1 if not loaded
+  std::vector<double> lo_, hi_;
+  std::vector<double> values_;
+
+ private:
+  static Utils::RegisteredFactory<Evaluator, GriddedForcingEvaluator> reg_;
+};
+
+} // namespace Relations
+} // namespace Amanzi
@@ -0,0 +1,149 @@
+/*
+  Copyright 2010-202x held jointly by participating institutions.
+  ATS is released under the three-clause BSD License.
+  The terms of use and "as is" disclaimer for this license are
+  provided in the top-level COPYRIGHT file.
+
+  Authors:
+*/
+
+#include <cstdint>
+#include <cstdio>
+#include <fstream>
+#include <string>
+#include <vector>
+
+#include "UnitTest++.h"
+
+#include "errors.hh"
+#include "forcing_file.hh"
+
+using namespace Amanzi::Relations;
+
+namespace {
+
+// Writes a binary forcing file as tools/utils/met_to_binary.py's
+// write_binary() does, with variables in sorted order.  The value of variable
+// v at time k in forcing cell c is value(v, k, c).
+double
+value(int v, int k, int c)
+{
+  return 100. * v + 10. * k + c;
+}
+
+void
+writeForcingFile(const std::string& filename,
+                 const std::vector<std::string>& names,
+                 const std::vector<double>& times,
+                 std::int64_t nx,
+                 std::int64_t ny,
+                 const std::vector<double>& grid)
+{
+  std::ofstream fid(filename, std::ios::binary);
+  fid.write("ATSFRC01", 8);
+  std::int64_t dims[4] = { (std::int64_t)names.size(), (std::int64_t)times.size(), nx, ny };
+  fid.write(reinterpret_cast<const char*>(dims), sizeof(dims));
+  fid.write(reinterpret_cast<const char*>(grid.data()), 4 * sizeof(double));
+  for (const auto& name : names) {
+    std::string padded(name);
+    padded.resize(64, '\0');
+    fid.write(padded.data(), 64);
+  }
+  fid.write(reinterpret_cast<const char*>(times.data()), times.size() * sizeof(double));
+  for (int v = 0; v != names.size(); ++v) {
+    for (int k = 0; k != times.size(); ++k) {
+      for (int c = 0; c != nx * ny; ++c) {
+        double val = value(v, k, c);
+        fid.write(reinterpret_cast<const char*>(&val), sizeof(double));
+      }
+    }
+  }
+}
+
+struct ForcingFileTest {
+  ForcingFileTest()
+  {
+    writeForcingFile(filename,
+                     { "air temperature [K]", "precipitation rain [m s^-1]" },
+                     { 0., 86400., 172800. },
+                     3,
+                     2,
+                     { 100., 200., 10., 20. });
+  }
+  ~ForcingFileTest() { std::remove(filename.c_str()); }
+
+  std::string filename = "test_forcing_file.atsf";
+};
+
+} // namespace
+
+
+SUITE(FORCING_FILE)
+{
+  TEST_FIXTURE(ForcingFileTest, READ)
+  {
+    auto file = ForcingFile::Get(filename);
+    CHECK_EQUAL(2, file->variables().size());
+    CHECK_EQUAL("precipitation rain [m s^-1]", file->variables()[1]);
+    CHECK_EQUAL(1, file->VariableIndex("precipitation rain [m s^-1]"));
+    CHECK_THROW(file->VariableIndex("snow"), Errors::Message);
+
+    CHECK_EQUAL(3, file->num_times());
+    CHECK_EQUAL(86400., file->times()[1]);
+    CHECK_EQUAL(-1, file->TimeIndex(-1.));
+    CHECK_EQUAL(0, file->TimeIndex(0.));
+    CHECK_EQUAL(1, file->TimeIndex(100000.));
+    CHECK_EQUAL(2, file->TimeIndex(1.e6));
+
+    // cells are centered at (100 + 10 i, 200 + 20 j), indexed i*ny + j, and
+    // points outside of the grid are an error
+    CHECK_EQUAL(3, file->nx());
+    CHECK_EQUAL(2, file->ny());
+    CHECK_EQUAL(0, file->CellIndex(100., 200.));
+    CHECK_EQUAL(3, file->CellIndex(111., 219.));
+    CHECK_EQUAL(0, file->CellIndex(96., 191.));
+    CHECK_EQUAL(5, file->CellIndex(124., 229.));
+    CHECK_THROW(file->CellIndex(1.e4, 200.), Errors::Message);
+    CHECK_THROW(file->CellIndex(100., -1.e4), Errors::Message);
+
+    for (int v = 0; v != 2; ++v) {
+      for (int k = 0; k != 3; ++k) {
+        const double* snapshot = file->Snapshot(v, k);
+        for (int c = 0; c != 6; ++c) CHECK_EQUAL(value(v, k, c), snapshot[c]);
+      }
+    }
+  }
+
+
+  // Users of a file share one map, which is released with the last user.
+  TEST_FIXTURE(ForcingFileTest, SHARED_AND_UNMAPPED)
+  {
+    auto file1 = ForcingFile::Get(filename);
+    auto file2 = ForcingFile::Get(filename);
+    CHECK(file1.get() == file2.get());
+
+    auto weak = file1.create_weak();
+    file1 = Teuchos::null;
+    CHECK(weak.is_valid_ptr());
+    file2 = Teuchos::null;
+    CHECK(!weak.is_valid_ptr());
+
+    // a rewritten file is mapped anew
+    writeForcingFile(filename, { "air temperature [K]" }, { 0. }, 1, 1, { 0., 0., 0., 0. });
+    auto file3 = ForcingFile::Get(filename);
+    CHECK_EQUAL(1, file3->variables().size());
+    CHECK_EQUAL(1, file3->num_cells());
+  }
+
+
+  TEST_FIXTURE(ForcingFileTest, INVALID)
+  {
+    {
+      // a header without data
+      std::ofstream fid(filename, std::ios::binary | std::ios::trunc);
+      fid.write("ATSFRC01", 8);
+    }
+    CHECK_THROW(ForcingFile::Get(filename), Errors::Message);
+    CHECK_THROW(ForcingFile::Get("does_not_exist.atsf"), Errors::Message);
+  }
+}
@@ -69,76 +69,30 @@ OverlandSourceFromSubsurfaceFluxEvaluator::EnsureCompatibility_ToDeps_(State& S)
 }
 
 
-void
-OverlandSourceFromSubsurfaceFluxEvaluator::IdentifyFaceAndDirection_(const State& S)
-{
-  // grab the meshes
-  Teuchos::RCP<const AmanziMesh::Mesh> subsurface = S.GetMesh(domain_sub_);
-  Teuchos::RCP<const AmanziMesh::Mesh> surface = S.GetMesh(domain_surf_);
-
-  // allocate space for face IDs and directions
-  int ncells = surface->num_entities(AmanziMesh::CELL, AmanziMesh::Parallel_type::OWNED);
-  face_and_dirs_ = Teuchos::rcp(new std::vector<FaceDir>(ncells));
-
-  for (int c = 0; c != ncells; ++c) {
-    // Get the face on the subsurface mesh corresponding to the cell
-    // of the surface mesh.
-    AmanziMesh::Entity_ID domain_face = surface->entity_get_parent(AmanziMesh::CELL, c);
-
-    // Get the direction corresponding to that face wrt its only cell.
-    // -- get the cell
-    AmanziMesh::Entity_ID_List cells;
-    subsurface->face_get_cells(domain_face, AmanziMesh::Parallel_type::OWNED, &cells);
-    AMANZI_ASSERT(cells.size() == 1);
-
-    // -- Get directions
-    AmanziMesh::Entity_ID_List faces;
-    std::vector<int> fdirs;
-    subsurface->cell_get_faces_and_dirs(cells[0], &faces, &fdirs);
-    int index = std::find(faces.begin(), faces.end(), domain_face) - faces.begin();
-
-    // Put (face,dir) into cached data.
-    (*face_and_dirs_)[c] = std::make_pair(domain_face, fdirs[index]);
-  }
-}
-
 // Required methods from EvaluatorSecondaryMonotypeCV
 void
 OverlandSourceFromSubsurfaceFluxEvaluator::Evaluate_(const State& S,
                                                      const std::vector<CompositeVector*>& result)
 {
-  if (face_and_dirs_ == Teuchos::null) { IdentifyFaceAndDirection_(S); }
   auto tag = my_keys_.front().second;
+  if (surf_map_ == Teuchos::null) surf_map_ = SurfaceSubsurfaceMap::Get(result[0]->Mesh());
+  const auto& faces = surf_map_->faces();
+  const auto& dirs = surf_map_->dirs();
 
-  Teuchos::RCP<const AmanziMesh::Mesh> subsurface = S.GetMesh(domain_sub_);
   const Epetra_MultiVector& flux =
     *S.Get<CompositeVector>(flux_key_, tag).ViewComponent("face", false);
-  const Epetra_MultiVector& res_v = *result[0]->ViewComponent("cell", false);
+  Epetra_MultiVector& res_v = *result[0]->ViewComponent("cell", false);
+  int ncells = result[0]->size("cell", false);
 
   if (volume_basis_) {
     const Epetra_MultiVector& dens =
       *S.Get<CompositeVector>(dens_key_, tag).ViewComponent("cell", false);
-
-    int ncells = result[0]->size("cell", false);
+    const auto& cells = surf_map_->cells();
     for (int c = 0; c != ncells; ++c) {
-      AmanziMesh::Entity_ID_List cells;
-      subsurface->face_get_cells(
-        (*face_and_dirs_)[c].first, AmanziMesh::Parallel_type::OWNED, &cells);
-      AMANZI_ASSERT(cells.size() == 1);
-
-      res_v[0][c] =
-        flux[0][(*face_and_dirs_)[c].first] * (*face_and_dirs_)[c].second / dens[0][cells[0]];
+      res_v[0][c] = flux[0][faces[c]] * dirs[c] / dens[0][cells[c]];
     }
   } else {
-    int ncells = result[0]->size("cell", false);
-    for (int c = 0; c != ncells; ++c) {
-      AmanziMesh::Entity_ID_List cells;
-      subsurface->face_get_cells(
-        (*face_and_dirs_)[c].first, AmanziMesh::Parallel_type::OWNED, &cells);
-      AMANZI_ASSERT(cells.size() == 1);
-
-      res_v[0][c] = flux[0][(*face_and_dirs_)[c].first] * (*face_and_dirs_)[c].second;
-    }
+    for (int c = 0; c != ncells; ++c) { res_v[0][c] = flux[0][faces[c]] * dirs[c]; }
   }
 }
 
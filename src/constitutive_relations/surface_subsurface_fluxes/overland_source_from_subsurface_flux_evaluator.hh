@@ -18,6 +18,7 @@
 
 #include "Evaluator_Factory.hh"
 #include "EvaluatorSecondaryMonotype.hh"
+#include "surface_subsurface_map.hh"
 
 namespace Amanzi {
 namespace Relations {
@@ -40,11 +41,6 @@ class OverlandSourceFromSubsurfaceFluxEvaluator : public EvaluatorSecondaryMonot
                                           const Tag& wrt_tag,
                                           const std::vector<CompositeVector*>& result) override;
 
-  void IdentifyFaceAndDirection_(const State& S);
-
-  typedef std::pair<int, double> FaceDir;
-  Teuchos::RCP<std::vector<FaceDir>> face_and_dirs_;
-
   Key flux_key_;
   Key dens_key_;
   bool volume_basis_;
@@ -52,6 +48,9 @@ class OverlandSourceFromSubsurfaceFluxEvaluator : public EvaluatorSecondaryMonot
   Key domain_surf_;
   Key domain_sub_;
 
+  // looked up on first evaluation
+  Teuchos::RCP<const SurfaceSubsurfaceMap> surf_map_;
+
  private:
   static Utils::RegisteredFactory<Evaluator, OverlandSourceFromSubsurfaceFluxEvaluator> fac_;
 };
@@ -0,0 +1,112 @@
+/*
+  Copyright 2010-202x held jointly by participating institutions.
+  ATS is released under the three-clause BSD License.
+  The terms of use and "as is" disclaimer for this license are
+  provided in the top-level COPYRIGHT file.
+
+  Authors:
+*/
+
+#include <algorithm>
+#include <map>
+#include <mutex>
+
+#include "errors.hh"
+#include "surface_subsurface_map.hh"
+
+namespace Amanzi {
+
+SurfaceSubsurfaceMap::SurfaceSubsurfaceMap(const AmanziMesh::Mesh& surface)
+{
+  auto subsurface = surface.parent();
+  if (subsurface == Teuchos::null) {
+    Errors::Message msg("SurfaceSubsurfaceMap: surface mesh has no parent subsurface mesh.");
+    Exceptions::amanzi_throw(msg);
+  }
+
+  int ncells = surface.num_entities(AmanziMesh::CELL, AmanziMesh::Parallel_type::OWNED);
+  faces_.resize(ncells);
+  boundary_faces_.resize(ncells);
+  cells_.resize(ncells);
+  dirs_.resize(ncells);
+
+  const auto& face_map = subsurface->face_map(false);
+  const auto& bface_map = subsurface->exterior_face_map(false);
+
+  AmanziMesh::Entity_ID_List cells;
+  AmanziMesh::Entity_ID_List faces;
+  std::vector<int> fdirs;
+  for (int sc = 0; sc != ncells; ++sc) {
+    // the face on the subsurface mesh
+    AmanziMesh::Entity_ID f = surface.entity_get_parent(AmanziMesh::CELL, sc);
+    faces_[sc] = f;
+    boundary_faces_[sc] = bface_map.LID(face_map.GID(f));
+
+    // the cell interior to the face
+    subsurface->face_get_cells(f, AmanziMesh::Parallel_type::ALL, &cells);
+    AMANZI_ASSERT(cells.size() == 1);
+    cells_[sc] = cells[0];
+
+    // the direction of the face relative to that cell
+    subsurface->cell_get_faces_and_dirs(cells[0], &faces, &fdirs);
+    int index = std::find(faces.begin(), faces.end(), f) - faces.begin();
+    AMANZI_ASSERT(index < faces.size());
+    dirs_[sc] = fdirs[index];
+  }
+}
+
+
+Teuchos::RCP<const SurfaceSubsurfaceMap>
+SurfaceSubsurfaceMap::Get(const Teuchos::RCP<const AmanziMesh::Mesh>& surface)
+{
+  // Cached by mesh address.  A weak reference to the mesh is kept, so the
+  // cache does not keep meshes alive.  Evaluators may be updated on multiple
+  // threads, so access is serialized.  Callers on hot paths should keep the
+  // returned map rather than calling Get() repeatedly.
+  using Entry = std::pair<Teuchos::RCP<const AmanziMesh::Mesh>,
+                          Teuchos::RCP<const SurfaceSubsurfaceMap>>;
+  static std::map<const AmanziMesh::Mesh*, Entry> cache;
+  static std::size_t swept_size = 8;
+  static std::mutex mutex;
+  std::lock_guard<std::mutex> lock(mutex);
+
+  // a hit whose mesh is alive is the same mesh, as its address is not reused
+  auto hit = cache.find(surface.get());
+  if (hit != cache.end() && hit->second.first.is_valid_ptr()) return hit->second.second;
+
+  // On a miss, drop maps whose mesh has been destroyed, once the cache has
+  // doubled since the last sweep, so that a map per column costs O(N log N).
+  if (cache.size() >= 2 * swept_size) {
+    for (auto entry = cache.begin(); entry != cache.end();) {
+      if (entry->second.first.is_valid_ptr()) {
+        ++entry;
+      } else {
+        entry = cache.erase(entry);
+      }
+    }
+    swept_size = std::max<std::size_t>(cache.size(), 8);
+  }
+
+  auto& entry = cache[surface.get()];
+  entry.first = surface.create_weak();
+  entry.second = Teuchos::rcp(new SurfaceSubsurfaceMap(*surface));
+  return entry.second;
+}
+
+
+const std::vector<int>&
+SurfaceSubsurfaceMap::FaceIndices(const CompositeVector& sub, std::string& comp) const
+{
+  if (sub.HasComponent("face")) {
+    comp = "face";
+    return faces_;
+  } else if (sub.HasComponent("boundary_face")) {
+    comp = "boundary_face";
+    return boundary_faces_;
+  }
+  Errors::Message message("Subsurface vector does not have face component.");
+  Exceptions::amanzi_throw(message);
+  return faces_;
+}
+
+} // namespace Amanzi
@@ -0,0 +1,73 @@
+/*
+  Copyright 2010-202x held jointly by participating institutions.
+  ATS is released under the three-clause BSD License.
+  The terms of use and "as is" disclaimer for this license are
+  provided in the top-level COPYRIGHT file.
+
+  Authors:
+*/
+
+/*
+  SurfaceSubsurfaceMap caches the adjacency between a surface mesh and the
+  subsurface mesh it was extracted from: for each owned surface cell, the
+  subsurface face it was lifted from, that face's index in the subsurface
+  boundary_face space, the (single) subsurface cell below it, and the
+  direction of the face's normal relative to that cell.
+
+  Transfers between surface and subsurface vectors are then gathers and
+  scatters over these flat arrays, rather than per-cell calls to
+  entity_get_parent() and face_get_cells().
+
+  Maps are shared: Get() returns the same map for the same surface mesh
+  object, and is safe to call from multiple threads.  The cache holds only a
+  weak reference to each mesh, and drops maps of meshes that no longer exist
+  when a new map is added.  Lookups are a search under a lock, so evaluators
+  keep the map they are given.
+  The map is topological, so it is unaffected by mesh deformation, which only
+  moves nodes.
+*/
+
+#ifndef AMANZI_RELATIONS_SURFACE_SUBSURFACE_MAP_HH_
+#define AMANZI_RELATIONS_SURFACE_SUBSURFACE_MAP_HH_
+
+#include <vector>
+
+#include "Teuchos_RCP.hpp"
+#include "Mesh.hh"
+#include "CompositeVector.hh"
+
+namespace Amanzi {
+
+class SurfaceSubsurfaceMap {
+ public:
+  // Builds the map for surface, whose parent() is the subsurface mesh.
+  explicit SurfaceSubsurfaceMap(const AmanziMesh::Mesh& surface);
+
+  // Returns the shared map for this surface mesh, building it on first use.
+  static Teuchos::RCP<const SurfaceSubsurfaceMap>
+  Get(const Teuchos::RCP<const AmanziMesh::Mesh>& surface);
+
+  // number of owned surface cells
+  int size() const { return faces_.size(); }
+
+  // indexed by surface cell
+  const std::vector<int>& faces() const { return faces_; }
+  const std::vector<int>& boundary_faces() const { return boundary_faces_; }
+  const std::vector<int>& cells() const { return cells_; }
+  const std::vector<int>& dirs() const { return dirs_; }
+
+  // Indices of the surface faces in the "face" component of a subsurface
+  // vector if it has one, else in its "boundary_face" component.
+  // comp is set to the name of the component.
+  const std::vector<int>& FaceIndices(const CompositeVector& sub, std::string& comp) const;
+
+ private:
+  std::vector<int> faces_;
+  std::vector<int> boundary_faces_;
+  std::vector<int> cells_;
+  std::vector<int> dirs_;
+};
+
+} // namespace Amanzi
+
+#endif
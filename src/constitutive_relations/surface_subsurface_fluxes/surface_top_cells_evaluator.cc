@@ -48,18 +48,12 @@ SurfaceTopCellsEvaluator::Evaluate_(const State& S, const std::vector<CompositeV
   Epetra_MultiVector& result_cells = *result[0]->ViewComponent("cell", false);
 
 
-  int ncells_surf =
-    result[0]->Mesh()->num_entities(AmanziMesh::CELL, AmanziMesh::Parallel_type::OWNED);
-  for (unsigned int c = 0; c != ncells_surf; ++c) {
-    // get the face on the subsurface mesh
-    AmanziMesh::Entity_ID f = result[0]->Mesh()->entity_get_parent(AmanziMesh::CELL, c);
-
-    // get the cell interior to the face
-    AmanziMesh::Entity_ID_List cells;
-    sub_vector->Mesh()->face_get_cells(f, AmanziMesh::Parallel_type::ALL, &cells);
-    AMANZI_ASSERT(cells.size() == 1);
-
-    result_cells[0][c] = sub_vector_cells[0][cells[0]];
+  // gather from the cell interior to each surface face
+  if (surf_map_ == Teuchos::null) surf_map_ = SurfaceSubsurfaceMap::Get(result[0]->Mesh());
+  const auto& top_cells = surf_map_->cells();
+  int ncells_surf = top_cells.size();
+  for (int c = 0; c != ncells_surf; ++c) {
+    result_cells[0][c] = sub_vector_cells[0][top_cells[c]];
   }
 }
 
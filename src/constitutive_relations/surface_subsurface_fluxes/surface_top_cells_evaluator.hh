@@ -19,6 +19,7 @@
 #include "Factory.hh"
 
 #include "EvaluatorSecondaryMonotype.hh"
+#include "surface_subsurface_map.hh"
 
 namespace Amanzi {
 namespace Relations {
@@ -45,6 +46,9 @@ class SurfaceTopCellsEvaluator : public EvaluatorSecondaryMonotypeCV {
  protected:
   Key dependency_key_;
 
+  // looked up on first evaluation
+  Teuchos::RCP<const SurfaceSubsurfaceMap> surf_map_;
+
  private:
   static Utils::RegisteredFactory<Evaluator, SurfaceTopCellsEvaluator> reg_;
 };
@@ -19,6 +19,7 @@
 #include "Factory.hh"
 
 #include "EvaluatorSecondaryMonotype.hh"
+#include "surface_subsurface_map.hh"
 
 namespace Amanzi {
 namespace Relations {
@@ -47,6 +48,9 @@ class TopCellsSurfaceEvaluator : public EvaluatorSecondaryMonotypeCV {
   bool negate_;
   Key domain_surf_;
 
+  // looked up on first evaluation
+  Teuchos::RCP<const SurfaceSubsurfaceMap> surf_map_;
+
  private:
   static Utils::RegisteredFactory<Evaluator, TopCellsSurfaceEvaluator> reg_;
 };
@@ -37,9 +37,12 @@
 #include "PK_Factory.hh"
 
 #include "pk_helpers.hh"
+#include "pk_history.hh"
 #include "exceptions.hh"
 #include "errors.hh"
 
+#include "setup_profiler.hh"
+#include "cyclostationary_spinup.hh"
 #include "ats_driver.hh"
 
 // won't run if DEBUG_MODE == false
@@ -55,15 +58,34 @@ namespace ATS {
 void
 ATSDriver::cycle_driver()
 {
-  // wallclock duration -- in seconds
-  const double duration(duration_ * 3600);
-
   // start at time t = t0 and initialize the state.
   {
     Teuchos::TimeMonitor monitor(*setup_timer_);
     setup();
     initialize();
   }
+  SetupProfiler::report(comm_, *vo_, Teuchos::VERB_MEDIUM);
+
+  // run to the end
+  TimeLoop_();
+
+  // finalizing simulation
+  WriteStateStatistics(*S_, *vo_);
+  report_memory();
+  Teuchos::TimeMonitor::summarize(*vo_->os());
+
+  finalize();
+} // cycle driver
+
+
+// -----------------------------------------------------------------------------
+// Write IC vis, then advance until t1_, cycle1_, or the wallclock duration
+// -----------------------------------------------------------------------------
+void
+ATSDriver::TimeLoop_()
+{
+  // wallclock duration -- in seconds
+  const double duration(duration_ * 3600);
 
   // get the intial timestep
   double dt = get_dt(false);
@@ -81,13 +103,15 @@ ATSDriver::cycle_driver()
   {
     Teuchos::TimeMonitor cycle_monitor(*cycle_timer_);
     double dt = S_->Get<double>("dt", Amanzi::Tags::DEFAULT);
+    bool spinup_done = false;
 #if !DEBUG_MODE
     try {
 #endif
 
       while (((t1_ < 0) || (S_->get_time() < t1_)) &&
              ((cycle1_ == -1) || (S_->get_cycle() <= cycle1_)) &&
-             ((duration_ < 0) || (timer_->totalElapsedTime(true) < duration)) && (dt > 0.)) {
+             ((duration_ < 0) || (timer_->totalElapsedTime(true) < duration)) && (dt > 0.) &&
+             !spinup_done) {
         if (vo_->os_OK(Teuchos::VERB_LOW)) {
           Teuchos::OSTab tab = vo_->getOSTab();
           *vo_->os() << "======================================================================"
@@ -113,6 +137,13 @@ ATSDriver::cycle_driver()
           S_->set_time(Amanzi::Tags::CURRENT, S_->get_time(Amanzi::Tags::NEXT));
           S_->advance_cycle();
 
+          // at the end of a spin-up cycle, check convergence and accelerate
+          if (spinup_ != Teuchos::null) {
+            spinup_done = spinup_->Update(*S_, S_->get_time());
+            // time integrators restart from the accelerated primary variables
+            if (spinup_->accelerated()) Amanzi::resetHistory(*pk_, S_->get_time());
+          }
+
           // make observations, vis, and checkpoints
           for (const auto& obs : observations_) obs->MakeObservations(S_.ptr());
           visualize();
@@ -138,14 +169,7 @@ ATSDriver::cycle_driver()
     }
 #endif
   }
-
-  // finalizing simulation
-  WriteStateStatistics(*S_, *vo_);
-  report_memory();
-  Teuchos::TimeMonitor::summarize(*vo_->os());
-
-  finalize();
-} // cycle driver
+}
 
 
 // -----------------------------------------------------------------------------
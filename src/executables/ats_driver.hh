@@ -29,6 +29,8 @@ called `"main`".  That list contains the following required elements:
     * `"checkpoint`" ``[checkpoint-spec]`` A Checkpoint_ spec.
     * `"PKs`" ``[pk-typedinline-spec-list]`` A list of `Process Kernels`_.
     * `"state`" ``[state-spec]`` A State_ spec.
+    * `"ensemble`" ``[ensemble-spec]`` **optional** If provided, runs an
+      ensemble of parameter sets, sharing one setup.  See EnsembleDriver.
 
 
 Coordinator
@@ -67,6 +69,13 @@ simulation, including starting and ending times and restart options.
       hit exactly.  This is useful for situations such as where data is provided at
       a regular interval, and interpolation error related to that data is to be
       minimized.
+    * `"spin-up`" ``[spinup-spec]`` **optional** If provided, the forcing
+      cycle is repeated until the state reaches a periodic steady state, at
+      which point the simulation ends.  See CyclostationarySpinup.
+    * `"checkpoint triggers`" ``[Array(string)]`` **optional** Scalars in
+      State that PKs set to request a checkpoint, e.g. BGCSimple's
+      `"soil_carbon_spinup_converged`".  A checkpoint is written after the step
+      in which one becomes nonzero, once all PKs have committed it.
     * `"PK tree`" ``[pk-typed-spec-list]`` List of length one, the top level
       PK_ spec.
 
@@ -116,6 +125,9 @@ class ATSDriver : public Coordinator {
   // methods
   void cycle_driver();
   int run();
+
+ protected:
+  void TimeLoop_();
 };
 
 } // namespace ATS
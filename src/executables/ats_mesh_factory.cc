@@ -8,6 +8,8 @@
 */
 
 //! Simple wrapper that takes a ParameterList and generates all needed meshes.
+#include <algorithm>
+
 #include "Epetra_MpiComm.h"
 #include "Teuchos_ParameterList.hpp"
 #include "Teuchos_TimeMonitor.hpp"
@@ -23,6 +25,7 @@
 #include "MeshSurfaceCell.hh"
 #include "GeometricModel.hh"
 
+#include "setup_profiler.hh"
 #include "ats_mesh_factory.hh"
 
 namespace ATS {
@@ -68,12 +71,17 @@ createMeshFromFile(const std::string& mesh_name,
 
   if (mesh != Teuchos::null) {
     // potentially build columns
+    bool columns_built = true;
     if (mesh_plist.isParameter("build columns from set")) {
       std::string regionname = mesh_plist.get<std::string>("build columns from set");
       mesh->build_columns(regionname);
     } else if (mesh_plist.get("build columns", true)) {
       mesh->build_columns();
+    } else {
+      columns_built = false;
     }
+    checkColumnLocality(mesh_plist, *mesh, columns_built, vo);
+    reportCellBandwidth(*mesh, vo);
 
     // verify
     checkVerifyMesh(mesh_plist, mesh);
@@ -118,12 +126,17 @@ createMeshGenerated(const std::string& mesh_name,
 
   if (mesh != Teuchos::null) {
     // build columns
+    bool columns_built = true;
     if (mesh_plist.isParameter("build columns from set")) {
       std::string regionname = mesh_plist.get<std::string>("build columns from set");
       mesh->build_columns(regionname);
-    } else if (mesh_plist.get("build columns", false)) {
+    } else if (mesh_plist.get("build columns",
+                              mesh_plist.get<bool>("require whole columns", false))) {
       mesh->build_columns();
+    } else {
+      columns_built = false;
     }
+    checkColumnLocality(mesh_plist, *mesh, columns_built, vo);
 
     // verify
     checkVerifyMesh(mesh_plist, mesh);
@@ -473,6 +486,117 @@ createMeshColumnSurface(const std::string& mesh_name,
 }
 
 
+//
+// Create the maps from many extracted subdomain meshes into one reference
+// mesh.
+//
+// Like the surface maps, these are built in one pass after all subdomains
+// are constructed.  Each subdomain cell is walked up, as cells, through any
+// intermediate meshes to the reference mesh.  Subdomains that are not
+// extracted, possibly through intermediate meshes, from the reference mesh
+// are mapped to their parent mesh, as createMapToParent() does.
+//
+// Not collective.
+void
+createMapsToParent(
+  const std::vector<std::string>& subdomain_names,
+  const std::vector<Teuchos::RCP<const AmanziMesh::Mesh>>& subdomain_meshes,
+  const Teuchos::RCP<const AmanziMesh::Mesh>& reference_mesh,
+  std::map<std::string, Teuchos::RCP<const std::vector<int>>>& reference_maps)
+{
+  AMANZI_ASSERT(subdomain_names.size() == subdomain_meshes.size());
+
+  for (int i = 0; i != subdomain_meshes.size(); ++i) {
+    const auto& subdomain_mesh = *subdomain_meshes[i];
+
+    // meshes from the subdomain's parent up to, not including, the reference
+    std::vector<const AmanziMesh::Mesh*> chain;
+    auto mesh = subdomain_mesh.parent();
+    while (mesh != Teuchos::null && mesh != reference_mesh) {
+      chain.push_back(mesh.get());
+      mesh = mesh->parent();
+    }
+    if (mesh == Teuchos::null) chain.clear();
+
+    int ncells =
+      subdomain_mesh.num_entities(AmanziMesh::CELL, AmanziMesh::Parallel_type::OWNED);
+    auto map = Teuchos::rcp(new std::vector<int>(ncells));
+    for (int c = 0; c != ncells; ++c) {
+      AmanziMesh::Entity_ID pc = subdomain_mesh.entity_get_parent(AmanziMesh::CELL, c);
+      for (const auto& m : chain) pc = m->entity_get_parent(AmanziMesh::CELL, pc);
+      (*map)[c] = pc;
+    }
+    reference_maps[subdomain_names[i]] = map;
+  }
+}
+
+
+//
+// Create the maps from many subdomain surface meshes into one reference
+// surface mesh.
+//
+// Both the subdomain surfaces and the reference surface are (possibly
+// through intermediate meshes, e.g. a column) lifted from faces of the same
+// volume mesh.  Rather than matching each subdomain against the reference
+// mesh separately, this inverts the reference mesh's cell-to-face map once
+// and then walks each subdomain cell up to its volume mesh face.  Subdomains
+// that do not share that ancestor fall back to createMapSurfaceToSurface().
+//
+// Not collective.
+void
+createMapsSurfaceToSurface(
+  const std::vector<std::string>& subdomain_names,
+  const std::vector<Teuchos::RCP<const AmanziMesh::Mesh>>& subdomain_meshes,
+  const AmanziMesh::Mesh& reference_mesh,
+  std::map<std::string, Teuchos::RCP<const std::vector<int>>>& reference_maps)
+{
+  AMANZI_ASSERT(subdomain_names.size() == subdomain_meshes.size());
+
+  // invert the reference mesh's map to its parent's faces
+  auto ancestor = reference_mesh.parent();
+  std::vector<int> ancestor_face_to_ref;
+  if (ancestor != Teuchos::null) {
+    ancestor_face_to_ref.resize(
+      ancestor->num_entities(AmanziMesh::FACE, AmanziMesh::Parallel_type::ALL), -1);
+    int ncells_ref =
+      reference_mesh.num_entities(AmanziMesh::CELL, AmanziMesh::Parallel_type::ALL);
+    for (int c = 0; c != ncells_ref; ++c) {
+      ancestor_face_to_ref[reference_mesh.entity_get_parent(AmanziMesh::CELL, c)] = c;
+    }
+  }
+
+  for (int i = 0; i != subdomain_meshes.size(); ++i) {
+    const auto& subdomain_mesh = *subdomain_meshes[i];
+    int ncells =
+      subdomain_mesh.num_entities(AmanziMesh::CELL, AmanziMesh::Parallel_type::OWNED);
+    auto map = Teuchos::rcp(new std::vector<int>(ncells, -1));
+
+    bool found = ancestor != Teuchos::null;
+    for (int c = 0; found && c != ncells; ++c) {
+      // walk up, as faces, until reaching the reference mesh's parent
+      AmanziMesh::Entity_ID f = subdomain_mesh.entity_get_parent(AmanziMesh::CELL, c);
+      auto mesh = subdomain_mesh.parent();
+      while (mesh != Teuchos::null && mesh != ancestor) {
+        f = mesh->entity_get_parent(AmanziMesh::FACE, f);
+        mesh = mesh->parent();
+      }
+      if (mesh == Teuchos::null || ancestor_face_to_ref[f] < 0) {
+        found = false;
+      } else {
+        (*map)[c] = ancestor_face_to_ref[f];
+      }
+    }
+
+    if (found) {
+      reference_maps[subdomain_names[i]] = map;
+    } else {
+      reference_maps[subdomain_names[i]] =
+        AmanziMesh::createMapSurfaceToSurface(subdomain_mesh, reference_mesh);
+    }
+  }
+}
+
+
 //
 // Create a collection of meshes indexed over a domain set.
 //
@@ -523,6 +647,9 @@ createDomainSetIndexed(const std::string& mesh_name_pristine,
     mesh_name = mesh_name_pristine;
   }
 
+  Teuchos::RCP<Teuchos::Time> dstime = Teuchos::TimeMonitor::getNewCounter("domain set creation");
+  Teuchos::TimeMonitor timer(*dstime);
+
   Teuchos::ParameterList& ds_list = mesh_plist.sublist("domain set indexed parameters");
 
   // get the indexing info
@@ -549,6 +676,13 @@ createDomainSetIndexed(const std::string& mesh_name_pristine,
     std::vector<int> lids;
     std::map<std::string, Teuchos::RCP<const std::vector<int>>> reference_maps;
 
+    // extracted and surface subdomains, whose reference maps are built
+    // together below
+    std::vector<std::string> parent_subdomain_names;
+    std::vector<Teuchos::RCP<const AmanziMesh::Mesh>> parent_subdomain_meshes;
+    std::vector<std::string> surface_subdomain_names;
+    std::vector<Teuchos::RCP<const AmanziMesh::Mesh>> surface_subdomain_meshes;
+
     // if aliased, we deal with domain sets specially
     std::string alias_target;
 
@@ -591,15 +725,15 @@ createDomainSetIndexed(const std::string& mesh_name_pristine,
         auto subdomain_mesh =
           createMesh(subdomain_list, indexing_parent_mesh->get_comm(), gm, S, vo);
 
-        // create maps to the reference mesh
+        // collect subdomains needing maps to the reference mesh
         if (is_reference_mesh) {
-          // construct map into the reference mesh
           if (subdomain_mesh_type == "extracted" || subdomain_mesh_type == "column") {
-            reference_maps[full_subdomain_name] = AmanziMesh::createMapToParent(*subdomain_mesh);
+            parent_subdomain_names.push_back(full_subdomain_name);
+            parent_subdomain_meshes.push_back(subdomain_mesh);
           } else if (subdomain_mesh_type == "surface" || subdomain_mesh_type == "column surface") {
             AMANZI_ASSERT(reference_mesh != Teuchos::null);
-            reference_maps[full_subdomain_name] =
-              AmanziMesh::createMapSurfaceToSurface(*subdomain_mesh, *reference_mesh);
+            surface_subdomain_names.push_back(full_subdomain_name);
+            surface_subdomain_meshes.push_back(subdomain_mesh);
           } else if (subdomain_mesh_type == "aliased") {
             // use the reference map from the target mesh, but first we have to determine the target mesh name
             alias_target = subdomain_param_list.get<std::string>("target");
@@ -617,6 +751,15 @@ createDomainSetIndexed(const std::string& mesh_name_pristine,
       }
     }
 
+    if (parent_subdomain_meshes.size() > 0) {
+      createMapsToParent(
+        parent_subdomain_names, parent_subdomain_meshes, reference_mesh, reference_maps);
+    }
+    if (surface_subdomain_meshes.size() > 0) {
+      createMapsSurfaceToSurface(
+        surface_subdomain_names, surface_subdomain_meshes, *reference_mesh, reference_maps);
+    }
+
     // construct and register the domain set
     Teuchos::RCP<AmanziMesh::DomainSet> ds = Teuchos::null;
     if (is_reference_mesh) {
@@ -688,6 +831,13 @@ createDomainSetRegions(const std::string& mesh_name_pristine,
     std::vector<int> lids;
     std::map<std::string, Teuchos::RCP<const std::vector<int>>> reference_maps;
 
+    // extracted and surface subdomains, whose reference maps are built
+    // together below
+    std::vector<std::string> parent_subdomain_names;
+    std::vector<Teuchos::RCP<const AmanziMesh::Mesh>> parent_subdomain_meshes;
+    std::vector<std::string> surface_subdomain_names;
+    std::vector<Teuchos::RCP<const AmanziMesh::Mesh>> surface_subdomain_meshes;
+
     // create the subdomains, indexed over entities
     for (const auto& subdomain : regions) {
       std::string full_subdomain_name = Keys::getDomainInSet(mesh_name, subdomain);
@@ -719,16 +869,228 @@ createDomainSetRegions(const std::string& mesh_name_pristine,
         if (is_reference_mesh) {
           // construct map into the reference mesh
           if (subdomain_mesh_type == "extracted" || subdomain_mesh_type == "column") {
-            reference_maps[full_subdomain_name] = createMapToParent(*subdomain_mesh);
+            parent_subdomain_names.push_back(full_subdomain_name);
+            parent_subdomain_meshes.push_back(subdomain_mesh);
           } else if (subdomain_mesh_type == "surface") {
             AMANZI_ASSERT(reference_mesh != Teuchos::null);
-            reference_maps[full_subdomain_name] =
-              createMapSurfaceToSurface(*subdomain_mesh, *reference_mesh);
+            surface_subdomain_names.push_back(full_subdomain_name);
+            surface_subdomain_meshes.push_back(subdomain_mesh);
+          }
+        }
+      }
+    }
+
+    if (parent_subdomain_meshes.size() > 0) {
+      createMapsToParent(
+        parent_subdomain_names, parent_subdomain_meshes, reference_mesh, reference_maps);
+    }
+    if (surface_subdomain_meshes.size() > 0) {
+      createMapsSurfaceToSurface(
+        surface_subdomain_names, surface_subdomain_meshes, *reference_mesh, reference_maps);
+    }
+
+    // construct and register the domain set
+    Teuchos::RCP<AmanziMesh::DomainSet> ds = Teuchos::null;
+    if (is_reference_mesh) {
+      ds = Teuchos::rcp(new AmanziMesh::DomainSet(
+        mesh_name, indexing_parent_mesh, subdomains, reference_mesh, reference_maps));
+    } else {
+      ds = Teuchos::rcp(new AmanziMesh::DomainSet(mesh_name, indexing_parent_mesh, subdomains));
+    }
+    S.RegisterDomainSet(mesh_name, ds);
+  }
+}
+
+
+// A Replicated Domain Set is a set of identical subdomains, one per column, or
+// per cell, of an indexing parent mesh, which all alias one mesh.
+//
+// Collective over the indexing parent mesh.
+void
+createDomainSetReplicated(const std::string& mesh_name_pristine,
+                          Teuchos::ParameterList& mesh_plist,
+                          const Teuchos::RCP<AmanziGeometry::GeometricModel>& gm,
+                          State& S,
+                          VerboseObject& vo)
+{
+  // strip a :* from the end of the domain set name if needed
+  std::string delim(1, Keys::dset_delimiter);
+  std::string mesh_name;
+  if (Keys::ends_with(mesh_name_pristine, delim + "*")) {
+    mesh_name = mesh_name_pristine.substr(0, mesh_name_pristine.length() - 2);
+  } else {
+    mesh_name = mesh_name_pristine;
+  }
+
+  Teuchos::ParameterList& ds_list = mesh_plist.sublist("domain set replicated parameters");
+  std::string indexing_parent_name = ds_list.get<std::string>("indexing parent domain", "domain");
+  std::string index_by = ds_list.get<std::string>("index by", "column");
+  if (index_by != "column" && index_by != "cell") {
+    Errors::Message msg;
+    msg << "Mesh \"" << mesh_name << "\" of type \"domain set replicated\": \"index by\" must be "
+        << "\"column\" or \"cell\", not \"" << index_by << "\".";
+    Exceptions::amanzi_throw(msg);
+  }
+  bool by_cell = index_by == "cell";
+
+  if (S.HasMesh(indexing_parent_name)) {
+    auto indexing_parent_mesh = S.GetMesh(indexing_parent_name);
+
+    // the mesh shared by all subdomains on this rank
+    Teuchos::ParameterList template_list = ds_list.sublist("template");
+    std::string template_name = mesh_name + "_template";
+    template_list.setName(template_name);
+    if (!template_list.isParameter("build columns") &&
+        !template_list.isParameter("build columns from set"))
+      template_list.set("build columns", true);
+    auto template_mesh = createMesh(template_list, getCommSelf(), gm, S, vo);
+    int ncells_template =
+      template_mesh->num_entities(AmanziMesh::CELL, AmanziMesh::Parallel_type::OWNED);
+
+    // the parent cells indexing each subdomain, a column or a single cell
+    int ncols = by_cell ?
+                  indexing_parent_mesh->num_entities(AmanziMesh::CELL,
+                                                     AmanziMesh::Parallel_type::OWNED) :
+                  indexing_parent_mesh->num_columns(false);
+    auto column_cells = [&](int col) {
+      return by_cell ? AmanziMesh::Entity_ID_List(1, col) :
+                       indexing_parent_mesh->cells_of_column(col);
+    };
+
+    // subdomains are numbered by the global ID of the top cell of their column
+    const auto& cell_map = indexing_parent_mesh->cell_map(false);
+    std::vector<int> top_gids(ncols);
+    for (int col = 0; col != ncols; ++col) top_gids[col] = cell_map.GID(column_cells(col)[0]);
+
+    auto comm = indexing_parent_mesh->get_comm();
+    std::vector<int> counts(comm->NumProc(), 0), offsets(comm->NumProc() + 1, 0);
+    MPI_Allgather(&ncols, 1, MPI_INT, counts.data(), 1, MPI_INT, comm->Comm());
+    for (int p = 0; p != comm->NumProc(); ++p) offsets[p + 1] = offsets[p] + counts[p];
+    std::vector<int> all_top_gids(offsets.back());
+    MPI_Allgatherv(top_gids.data(),
+                   ncols,
+                   MPI_INT,
+                   all_top_gids.data(),
+                   counts.data(),
+                   offsets.data(),
+                   MPI_INT,
+                   comm->Comm());
+    std::sort(all_top_gids.begin(), all_top_gids.end());
+    if (all_top_gids.empty()) {
+      Errors::Message msg;
+      msg << "Mesh \"" << mesh_name << "\" of type \"domain set replicated\": indexing parent \""
+          << indexing_parent_name << "\" has no " << index_by << "s -- supply \"build columns "
+          << "from set\", or index by cell.";
+      Exceptions::amanzi_throw(msg);
+    }
+
+    // is there a reference mesh for visualization?  It is either the indexing
+    // parent, or a surface mesh extracted from it.
+    bool is_reference_mesh = ds_list.isParameter("referencing parent domain");
+    Teuchos::RCP<const AmanziMesh::Mesh> reference_mesh = Teuchos::null;
+    if (is_reference_mesh)
+      reference_mesh = S.GetMesh(ds_list.get<std::string>("referencing parent domain"));
+    bool is_reference_surface = is_reference_mesh && reference_mesh != indexing_parent_mesh;
+
+    std::vector<int> face_to_surface_cell;
+    AmanziMesh::Entity_ID_List template_cells;
+    if (is_reference_surface) {
+      if (ncells_template != 1) {
+        Errors::Message msg;
+        msg << "Mesh \"" << mesh_name << "\" of type \"domain set replicated\": a surface "
+            << "referencing parent requires a template of one cell.";
+        Exceptions::amanzi_throw(msg);
+      }
+      face_to_surface_cell.resize(
+        indexing_parent_mesh->num_entities(AmanziMesh::FACE, AmanziMesh::Parallel_type::ALL), -1);
+      int nsc = reference_mesh->num_entities(AmanziMesh::CELL, AmanziMesh::Parallel_type::OWNED);
+      for (int sc = 0; sc != nsc; ++sc)
+        face_to_surface_cell[reference_mesh->entity_get_parent(AmanziMesh::CELL, sc)] = sc;
+    } else if (is_reference_mesh && by_cell) {
+      if (ncells_template != 1) {
+        Errors::Message msg;
+        msg << "Mesh \"" << mesh_name << "\" of type \"domain set replicated\": a referencing "
+            << "parent indexed by cell requires a template of one cell.";
+        Exceptions::amanzi_throw(msg);
+      }
+      template_cells.push_back(0);
+    } else if (is_reference_mesh) {
+      if (template_mesh->num_columns(false) != 1 ||
+          template_mesh->cells_of_column(0).size() != ncells_template) {
+        Errors::Message msg;
+        msg << "Mesh \"" << mesh_name << "\" of type \"domain set replicated\": a referencing "
+            << "parent requires a template of one column.";
+        Exceptions::amanzi_throw(msg);
+      }
+      template_cells = template_mesh->cells_of_column(0);
+    }
+
+    std::vector<std::string> subdomains;
+    std::map<std::string, Teuchos::RCP<const std::vector<int>>> reference_maps;
+    for (int col = 0; col != ncols; ++col) {
+      int index = std::lower_bound(all_top_gids.begin(), all_top_gids.end(), top_gids[col]) -
+                  all_top_gids.begin();
+      std::string subdomain = std::to_string(index);
+      std::string full_subdomain_name = Keys::getDomainInSet(mesh_name, subdomain);
+      S.AliasMesh(template_name, full_subdomain_name);
+      subdomains.push_back(subdomain);
+
+      // map the template cells onto the column, or its surface cell
+      if (is_reference_mesh) {
+        AmanziMesh::Entity_ID_List col_cells = column_cells(col);
+        auto map = Teuchos::rcp(new std::vector<int>(ncells_template, -1));
+        if (is_reference_surface) {
+          AmanziMesh::Entity_ID_List faces;
+          std::vector<int> dirs;
+          indexing_parent_mesh->cell_get_faces_and_dirs(col_cells[0], &faces, &dirs);
+          for (const auto& f : faces) {
+            if (face_to_surface_cell[f] >= 0) (*map)[0] = face_to_surface_cell[f];
           }
+        } else if (col_cells.size() == template_cells.size()) {
+          for (int i = 0; i != col_cells.size(); ++i) (*map)[template_cells[i]] = col_cells[i];
         }
+        if (std::find(map->begin(), map->end(), -1) != map->end()) {
+          Errors::Message msg;
+          msg << "Mesh \"" << mesh_name << "\" of type \"domain set replicated\": subdomain \""
+              << full_subdomain_name << "\" does not match its column of the parent.";
+          Exceptions::amanzi_throw(msg);
+        }
+        reference_maps[full_subdomain_name] = map;
       }
     }
 
+    // per-subdomain evaluator lists, overriding the domain set's "*" list
+    if (ds_list.isSublist("subdomain evaluator overrides")) {
+      Teuchos::ParameterList& overrides_list = ds_list.sublist("subdomain evaluator overrides");
+      Teuchos::ParameterList& evals_list = S.FEList();
+      for (const auto& subdomain : subdomains) {
+        if (!overrides_list.isSublist(subdomain)) continue;
+        Teuchos::ParameterList& subdomain_list = overrides_list.sublist(subdomain);
+        for (const auto& entry : subdomain_list) {
+          Key generic = Keys::getKey(Keys::getDomainInSet(mesh_name, "*"), entry.first);
+          Key specific = Keys::getKey(Keys::getDomainInSet(mesh_name, subdomain), entry.first);
+          if (!subdomain_list.isSublist(entry.first) ||
+              !(evals_list.isSublist(specific) || evals_list.isSublist(generic))) {
+            Errors::Message msg;
+            msg << "Mesh \"" << mesh_name << "\": override of \"" << entry.first
+                << "\" has no evaluator list \"" << generic << "\" to override.";
+            Exceptions::amanzi_throw(msg);
+          }
+          Teuchos::ParameterList elist = evals_list.isSublist(specific) ?
+                                           evals_list.sublist(specific) :
+                                           evals_list.sublist(generic);
+          elist.setParameters(subdomain_list.sublist(entry.first));
+          evals_list.set(specific, elist);
+        }
+      }
+    }
+
+    if (vo.os_OK(Teuchos::VERB_HIGH)) {
+      *vo.os() << "  Replicated mesh \"" << template_name << "\" as " << subdomains.size()
+               << " of " << all_top_gids.size() << " subdomains of \"" << mesh_name << "\"."
+               << std::endl;
+    }
+
     // construct and register the domain set
     Teuchos::RCP<AmanziMesh::DomainSet> ds = Teuchos::null;
     if (is_reference_mesh) {
@@ -741,6 +1103,7 @@ createDomainSetRegions(const std::string& mesh_name_pristine,
   }
 }
 
+
 Teuchos::RCP<const Amanzi::AmanziMesh::Mesh>
 createMesh(Teuchos::ParameterList& mesh_plist,
            const Amanzi::Comm_ptr_type& comm,
@@ -777,6 +1140,8 @@ createMesh(Teuchos::ParameterList& mesh_plist,
     createDomainSetIndexed(mesh_name, mesh_plist, gm, S, vo);
   } else if (mesh_type == "domain set regions") {
     createDomainSetRegions(mesh_name, mesh_plist, gm, S, vo);
+  } else if (mesh_type == "domain set replicated") {
+    createDomainSetReplicated(mesh_name, mesh_plist, gm, S, vo);
   } else {
     Errors::Message msg;
     msg << "ATS Mesh Factory: unknown \"mesh type\" parameter \"" << mesh_type << "\" in mesh \""
@@ -835,6 +1200,112 @@ checkVerifyMesh(Teuchos::ParameterList& mesh_plist, Teuchos::RCP<const AmanziMes
 }
 
 
+//
+// Columns are built from owned surface faces, so a column whose cells are not
+// all owned was split by the partitioner, and owned cells that are in no
+// column belong to a column whose top is on another rank.  Columns may only be
+// queried once built.
+//
+// Collective on mesh comm.
+bool
+checkColumnLocality(Teuchos::ParameterList& mesh_plist,
+                    const AmanziMesh::Mesh& mesh,
+                    bool columns_built,
+                    VerboseObject& vo)
+{
+  bool required = mesh_plist.get<bool>("require whole columns", false);
+  if (!columns_built) {
+    if (required) {
+      Errors::Message msg("Mesh \"require whole columns\" is set, but \"build columns\" is false.");
+      Exceptions::amanzi_throw(msg);
+    }
+    return !required;
+  }
+  if (!required && !vo.os_OK(Teuchos::VERB_HIGH)) return true;
+
+  int ncols = mesh.num_columns(false);
+  int ncells_owned = mesh.num_entities(AmanziMesh::CELL, AmanziMesh::Parallel_type::OWNED);
+
+  // local counts: columns, split columns, contiguously numbered columns,
+  // owned cells in columns
+  int l_counts[4] = { ncols, 0, 0, 0 };
+  for (int col = 0; col != ncols; ++col) {
+    const auto& col_cells = mesh.cells_of_column(col);
+    bool split = false;
+    bool contiguous = true;
+    for (int i = 0; i != col_cells.size(); ++i) {
+      if (col_cells[i] >= ncells_owned) {
+        split = true;
+      } else {
+        l_counts[3]++;
+      }
+      if (i > 0 && col_cells[i] != col_cells[i - 1] + 1) contiguous = false;
+    }
+    if (split) l_counts[1]++;
+    if (contiguous) l_counts[2]++;
+  }
+  int l_orphans = ncells_owned - l_counts[3];
+  int g_counts[4] = { 0, 0, 0, 0 };
+  int g_orphans = 0;
+  mesh.get_comm()->SumAll(l_counts, g_counts, 4);
+  mesh.get_comm()->SumAll(&l_orphans, &g_orphans, 1);
+
+  if (g_counts[0] == 0 && !required) return true;
+  if (vo.os_OK(Teuchos::VERB_HIGH)) {
+    *vo.os() << "  Column locality: " << g_counts[0] << " columns, " << g_counts[1]
+             << " split across ranks, " << g_counts[2] << " contiguously numbered, " << g_orphans
+             << " owned cells outside of a locally owned column." << std::endl;
+  }
+
+  if (required && (g_counts[0] == 0 || g_counts[1] > 0 || g_orphans > 0)) {
+    Errors::Message msg;
+    msg << "Mesh \"require whole columns\" is set, but ";
+    if (g_counts[0] == 0) {
+      msg << "no columns were built -- supply \"build columns from set\".";
+    } else {
+      msg << g_counts[1] << " columns (and " << g_orphans
+          << " cells) are split across ranks by the \"partitioner\".  Ensure columns are "
+             "vertical, or use a prepartitioned mesh that keeps columns together.";
+    }
+    Exceptions::amanzi_throw(msg);
+    return false;
+  }
+  return true;
+}
+
+
+//
+// Collective on mesh comm.
+void
+reportCellBandwidth(const AmanziMesh::Mesh& mesh, VerboseObject& vo)
+{
+  if (!vo.os_OK(Teuchos::VERB_HIGH)) return;
+
+  int nfaces = mesh.num_entities(AmanziMesh::FACE, AmanziMesh::Parallel_type::OWNED);
+  double l_sum[2] = { 0., 0. }; // sum of distances, number of internal faces
+  double l_max = 0.;
+  AmanziMesh::Entity_ID_List cells;
+  for (int f = 0; f != nfaces; ++f) {
+    mesh.face_get_cells(f, AmanziMesh::Parallel_type::ALL, &cells);
+    if (cells.size() == 2) {
+      double dist = std::abs(cells[0] - cells[1]);
+      l_sum[0] += dist;
+      l_sum[1] += 1.;
+      l_max = std::max(l_max, dist);
+    }
+  }
+
+  double g_sum[2] = { 0., 0. };
+  double g_max = 0.;
+  mesh.get_comm()->SumAll(l_sum, g_sum, 2);
+  mesh.get_comm()->MaxAll(&l_max, &g_max, 1);
+  if (g_sum[1] > 0.) {
+    *vo.os() << "  Cell bandwidth across faces: mean = " << g_sum[0] / g_sum[1]
+             << ", max = " << g_max << std::endl;
+  }
+}
+
+
 void
 createMeshes(Teuchos::ParameterList& global_list,
              const Comm_ptr_type& comm,
@@ -850,11 +1321,13 @@ createMeshes(Teuchos::ParameterList& global_list,
 
   // always try to do the domain mesh first
   if (meshes_list.isSublist("domain")) {
+    SetupProfiler::Phase phase("mesh \"domain\"");
     createMesh(meshes_list.sublist("domain"), comm, gm, S, vo);
   }
 
   // always try to do the surface mesh second
   if (meshes_list.isSublist("surface")) {
+    SetupProfiler::Phase phase("mesh \"surface\"");
     createMesh(meshes_list.sublist("surface"), comm, gm, S, vo);
   }
 
@@ -862,6 +1335,7 @@ createMeshes(Teuchos::ParameterList& global_list,
   for (auto sublist : meshes_list) {
     if (sublist.first != "domain" && sublist.first != "surface" &&
         sublist.first != "verbose object" && meshes_list.isSublist(sublist.first)) {
+      SetupProfiler::Phase phase("mesh \"" + sublist.first + "\"");
       createMesh(meshes_list.sublist(sublist.first), comm, gm, S, vo);
     }
   }
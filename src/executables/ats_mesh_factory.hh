@@ -45,6 +45,7 @@ through providing a "verify mesh" option.
      - `"surface`" See `Surface Mesh`_.
      - `"subgrid`" See `Subgrid Meshes`_.
      - `"column`" See `Column Meshes`_.
+     - `"domain set replicated`" See `Replicated Domain Sets`_.
 
    * `"_mesh_type_ parameters`" ``[_mesh_type_-spec]`` List of parameters
      associated with the type.
@@ -59,6 +60,14 @@ through providing a "verify mesh" option.
      - `"metis`" uses the METIS graph partitioner
      - `"zoltan`" uses the default Zoltan graph-based partitioner.
 
+   * `"require whole columns`" ``[bool]`` **false** If true, builds columns
+     and, after partitioning, checks that every column of cells is owned, in
+     its entirety, by a single rank, throwing if not.  This does not change
+     the partitioning; it is for, e.g., column integrators and column PKs,
+     which assume that they never touch ghost cells.  The `"zoltan_rcb`"
+     partitioner keeps vertical columns together; otherwise, use a
+     prepartitioned mesh, e.g. written with extrude's ``--partition``.
+
 
 Generated Mesh
 ==============
@@ -112,6 +121,12 @@ Specified by `"mesh type`" of `"read mesh file`".
 
    * `"file`" ``[string]`` filename of a pre-generated mesh file
 
+Face loops in operators and PKs access cell data through face-to-cell
+indirection, so they are fastest when neighboring cells are numbered close to
+each other.  At high verbosity, the mean and maximum cell index distance across
+faces is reported for meshes read from file.  If these are large, renumber the
+mesh when writing it (e.g. `extrude`'s column-major output ordering).
+
 Example:
 
 .. code-block:: xml
@@ -287,6 +302,93 @@ Example:
       </ParameterList>
     </ParameterList>
 
+
+Replicated Domain Sets
+======================
+
+A domain set of identical subdomains, e.g. many parameter realizations of
+the same column, run together by a weak subdomain MPC in one simulation.
+One subdomain is created for each column, or each cell, of an indexing parent
+mesh, on the rank owning it; the parent sets how many subdomains there are
+and how they are distributed.  Indexing by cell, the parent may be a cheap
+mesh of one cell per subdomain, e.g. a generated mesh of N x 1 x 1 cells.
+Indexing by column, it is typically a generated mesh with `"require whole
+columns`" set.  Subdomains are named `"0`" to `"N-1`", in order of the global
+ID of their cell, or of the top cell of their column.
+
+All subdomains on a rank alias one mesh, the template, which is created once
+per rank, on a single process, and registered as `"NAME_template`".
+
+Each subdomain may override the parameters of the domain set's evaluator
+lists, e.g. of `"column:*-base_porosity`", which are then copied into
+subdomain-specific lists, e.g. `"column:3-base_porosity`".
+
+If a referencing parent is provided, the domain set can be visualized
+collectively, writing all subdomains to one file.  The referencing parent is
+either the indexing parent itself, in which case the template must be a
+single column with as many cells as each column of the parent (or a single
+cell, when indexing by cell), or a surface mesh extracted from it, in which
+case the template must be of one cell.
+
+Specified by `"mesh type`" of `"domain set replicated`".
+
+.. _mesh-domain-set-replicated-spec:
+.. admonition:: mesh-domain-set-replicated-spec
+
+   * `"template`" ``[mesh-typed-spec]`` The mesh of every subdomain.
+   * `"indexing parent domain`" ``[string]`` **domain** Mesh whose columns,
+     or cells, index the subdomains.
+   * `"index by`" ``[string]`` **column** One of `"column`" or `"cell`".
+   * `"referencing parent domain`" ``[string]`` **optional** Mesh onto which
+     subdomains are mapped for visualization.
+   * `"subdomain evaluator overrides`" ``[list]`` **optional** Sublists named
+     by subdomain, each of sublists named by variable, e.g. `"base_porosity`",
+     whose parameters override those of the domain set's evaluator list.
+
+Example:
+
+.. code-block:: xml
+
+    <ParameterList name="mesh" type="ParameterList">
+      <ParameterList name="domain" type="ParameterList">
+        <Parameter name="mesh type" type="string" value="generate mesh" />
+        <Parameter name="require whole columns" type="bool" value="true" />
+        <Parameter name="build columns from set" type="string" value="surface" />
+        <ParameterList name="generate mesh parameters" type="ParameterList">
+          <Parameter name="number of cells" type="Array(int)" value="{1000, 1, 100}" />
+          <Parameter name="domain low coordinate" type="Array(double)" value="{0.0, 0.0, -10.0}" />
+          <Parameter name="domain high coordinate" type="Array(double)" value="{1000.0, 1.0, 0.0}" />
+        </ParameterList>
+      </ParameterList>
+      <ParameterList name="column:*" type="ParameterList">
+        <Parameter name="mesh type" type="string" value="domain set replicated" />
+        <ParameterList name="domain set replicated parameters" type="ParameterList">
+          <Parameter name="referencing parent domain" type="string" value="domain" />
+          <ParameterList name="template" type="ParameterList">
+            <Parameter name="mesh type" type="string" value="read mesh file" />
+            <ParameterList name="read mesh file parameters" type="ParameterList">
+              <Parameter name="file" type="string" value="column_100_cells.exo" />
+            </ParameterList>
+          </ParameterList>
+          <ParameterList name="subdomain evaluator overrides" type="ParameterList">
+            <ParameterList name="0" type="ParameterList">
+              <ParameterList name="base_porosity" type="ParameterList">
+                <ParameterList name="function" type="ParameterList">
+                  <ParameterList name="domain" type="ParameterList">
+                    <ParameterList name="function" type="ParameterList">
+                      <ParameterList name="function-constant" type="ParameterList">
+                        <Parameter name="value" type="double" value="0.35" />
+                      </ParameterList>
+                    </ParameterList>
+                  </ParameterList>
+                </ParameterList>
+              </ParameterList>
+            </ParameterList>
+          </ParameterList>
+        </ParameterList>
+      </ParameterList>
+    </ParameterList>
+
 */
 
 #ifndef ATS_MESH_FACTORY_HH_
@@ -308,6 +410,47 @@ bool
 checkVerifyMesh(Teuchos::ParameterList& mesh_plist,
                 Teuchos::RCP<const Amanzi::AmanziMesh::Mesh> mesh);
 
+//
+// Check that every column of cells is owned by a single rank.  Throws if the
+// mesh requires whole columns and a column is split, or if columns were not
+// built.
+//
+bool
+checkColumnLocality(Teuchos::ParameterList& mesh_plist,
+                    const Amanzi::AmanziMesh::Mesh& mesh,
+                    bool columns_built,
+                    Amanzi::VerboseObject& vo);
+
+//
+// Create, in one pass, maps from each extracted subdomain mesh's cells to the
+// cells of a reference mesh from which it was extracted.
+//
+void
+createMapsToParent(
+  const std::vector<std::string>& subdomain_names,
+  const std::vector<Teuchos::RCP<const Amanzi::AmanziMesh::Mesh>>& subdomain_meshes,
+  const Teuchos::RCP<const Amanzi::AmanziMesh::Mesh>& reference_mesh,
+  std::map<std::string, Teuchos::RCP<const std::vector<int>>>& reference_maps);
+
+//
+// Create, in one pass, maps from each subdomain surface mesh's cells to the
+// cells of a reference surface mesh.
+//
+void
+createMapsSurfaceToSurface(
+  const std::vector<std::string>& subdomain_names,
+  const std::vector<Teuchos::RCP<const Amanzi::AmanziMesh::Mesh>>& subdomain_meshes,
+  const Amanzi::AmanziMesh::Mesh& reference_mesh,
+  std::map<std::string, Teuchos::RCP<const std::vector<int>>>& reference_maps);
+
+//
+// Report the mean and max distance, in local cell numbering, between the two
+// cells of each owned face -- a measure of how cache-friendly face loops are
+// on this mesh.
+//
+void
+reportCellBandwidth(const Amanzi::AmanziMesh::Mesh& mesh, Amanzi::VerboseObject& vo);
+
 //
 // Create mesh for each type
 //
@@ -384,6 +527,13 @@ createDomainSetRegions(const std::string& mesh_name_pristine,
                        Amanzi::State& S,
                        Amanzi::VerboseObject& vo);
 
+void
+createDomainSetReplicated(const std::string& mesh_name_pristine,
+                          Teuchos::ParameterList& mesh_plist,
+                          const Teuchos::RCP<Amanzi::AmanziGeometry::GeometricModel>& gm,
+                          Amanzi::State& S,
+                          Amanzi::VerboseObject& vo);
+
 Teuchos::RCP<const Amanzi::AmanziMesh::Mesh>
 createMesh(Teuchos::ParameterList& plist,
            const Amanzi::Comm_ptr_type& comm,
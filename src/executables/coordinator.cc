@@ -47,8 +47,11 @@ actual work.
 #include "TreeVector.hh"
 #include "PK_Factory.hh"
 #include "pk_helpers.hh"
+#include "mesh_geometry_cache.hh"
 
 #include "ats_mesh_factory.hh"
+#include "setup_profiler.hh"
+#include "cyclostationary_spinup.hh"
 
 #include "coordinator.hh"
 
@@ -68,12 +71,18 @@ Coordinator::Coordinator(const Teuchos::RCP<Teuchos::ParameterList>& plist,
   S_ = Teuchos::rcp(new Amanzi::State(plist_->sublist("state")));
 
   // create the geometric model and regions
-  Teuchos::ParameterList reg_list = plist_->sublist("regions");
-  Teuchos::RCP<Amanzi::AmanziGeometry::GeometricModel> gm =
-    Teuchos::rcp(new Amanzi::AmanziGeometry::GeometricModel(3, reg_list, *comm_));
+  Teuchos::RCP<Amanzi::AmanziGeometry::GeometricModel> gm;
+  {
+    SetupProfiler::Phase phase("create regions");
+    Teuchos::ParameterList reg_list = plist_->sublist("regions");
+    gm = Teuchos::rcp(new Amanzi::AmanziGeometry::GeometricModel(3, reg_list, *comm_));
+  }
 
   // create and register meshes
-  ATS::Mesh::createMeshes(*plist_, comm_, gm, *S_);
+  {
+    SetupProfiler::Phase phase("create meshes");
+    ATS::Mesh::createMeshes(*plist_, comm_, gm, *S_);
+  }
 
   coordinator_list_ = Teuchos::sublist(plist_, "cycle driver");
   InitializeFromPlist_();
@@ -92,8 +101,11 @@ Coordinator::Coordinator(const Teuchos::RCP<Teuchos::ParameterList>& plist,
   soln_ = Teuchos::rcp(new Amanzi::TreeVector(comm_));
 
   // create the pk
-  Amanzi::PKFactory pk_factory;
-  pk_ = pk_factory.CreatePK(pk_name, pk_tree_list, plist_, S_, soln_);
+  {
+    SetupProfiler::Phase phase("create PK tree");
+    Amanzi::PKFactory pk_factory;
+    pk_ = pk_factory.CreatePK(pk_name, pk_tree_list, plist_, S_, soln_);
+  }
 
   // create the checkpointing
   Teuchos::ParameterList& chkp_plist = plist_->sublist("checkpoint");
@@ -151,9 +163,16 @@ Coordinator::setup()
   // order matters here -- PKs set the leaves, then observations can use those
   // if provided, and setup finally deals with all secondaries and allocates memory
   pk_->set_tags(Amanzi::Tags::CURRENT, Amanzi::Tags::NEXT);
-  pk_->Setup();
+  {
+    SetupProfiler::Phase phase("PK setup");
+    pk_->Setup();
+  }
   for (auto& obs : observations_) obs->Setup(S_.ptr());
-  S_->Setup();
+  if (spinup_ != Teuchos::null) spinup_->Setup(*S_);
+  {
+    SetupProfiler::Phase phase("State setup");
+    S_->Setup();
+  }
 }
 
 void
@@ -177,10 +196,16 @@ Coordinator::initialize()
   }
 
   // Initialize the state
-  S_->InitializeFields();
+  {
+    SetupProfiler::Phase phase("initialize fields");
+    S_->InitializeFields();
+  }
 
   // Initialize the process kernels
-  pk_->Initialize();
+  {
+    SetupProfiler::Phase phase("PK initialize");
+    pk_->Initialize();
+  }
 
   // calling CommitStep to set up copies as needed.
   pk_->CommitStep(t0_, t0_, Amanzi::Tags::NEXT);
@@ -199,6 +224,7 @@ Coordinator::initialize()
   // Restart from checkpoint part 2:
   // -- load all other data
   if (restart_) {
+    SetupProfiler::Phase phase("read checkpoint");
     Amanzi::ReadCheckpoint(comm_, *S_, restart_filename_);
     t0_ = S_->get_time();
     cycle0_ = S_->get_cycle();
@@ -207,14 +233,19 @@ Coordinator::initialize()
     S_->set_time(Amanzi::Tags::NEXT, t0_);
 
     for (Amanzi::State::mesh_iterator mesh = S_->mesh_begin(); mesh != S_->mesh_end(); ++mesh) {
-      if (S_->IsDeformableMesh(mesh->first) && !S_->IsAliasedMesh(mesh->first))
+      if (S_->IsDeformableMesh(mesh->first) && !S_->IsAliasedMesh(mesh->first)) {
         Amanzi::DeformCheckpointMesh(*S_, mesh->first);
+        Amanzi::MeshGeometryCache::Invalidate(*mesh->second.first);
+      }
     }
   }
 
   // Final checks.
   //S_->CheckNotEvaluatedFieldsInitialized();
-  S_->InitializeEvaluators();
+  {
+    SetupProfiler::Phase phase("initialize evaluators");
+    S_->InitializeEvaluators();
+  }
   S_->InitializeFieldCopies();
   S_->CheckAllFieldsInitialized();
 
@@ -224,66 +255,72 @@ Coordinator::initialize()
   pk_->CommitStep(S_->get_time(), S_->get_time(), Amanzi::Tags::NEXT);
 
   // Write dependency graph.
-  S_->WriteDependencyGraph();
+  {
+    SetupProfiler::Phase phase("write dependency graph");
+    S_->WriteDependencyGraph();
+  }
   S_->InitializeIOFlags();
 
   // Check final initialization
   WriteStateStatistics(*S_, *vo_);
 
   // Set up visualization
-  auto vis_list = Teuchos::sublist(plist_, "visualization");
-  for (auto& entry : *vis_list) {
-    std::string domain_name = entry.first;
-
-    if (S_->HasMesh(domain_name)) {
-      // visualize standard domain
-      auto mesh_p = S_->GetMesh(domain_name);
-      auto sublist_p = Teuchos::sublist(vis_list, domain_name);
-      if (!sublist_p->isParameter("file name base")) {
-        if (domain_name.empty() || domain_name == "domain") {
-          sublist_p->set<std::string>("file name base", std::string("ats_vis"));
-        } else {
-          sublist_p->set<std::string>("file name base", std::string("ats_vis_") + domain_name);
+  {
+    SetupProfiler::Phase phase("create vis files");
+    auto vis_list = Teuchos::sublist(plist_, "visualization");
+    for (auto& entry : *vis_list) {
+      std::string domain_name = entry.first;
+
+      if (S_->HasMesh(domain_name)) {
+        // visualize standard domain
+        auto mesh_p = S_->GetMesh(domain_name);
+        auto sublist_p = Teuchos::sublist(vis_list, domain_name);
+        if (!sublist_p->isParameter("file name base")) {
+          if (domain_name.empty() || domain_name == "domain") {
+            sublist_p->set<std::string>("file name base", std::string("ats_vis"));
+          } else {
+            sublist_p->set<std::string>("file name base", std::string("ats_vis_") + domain_name);
+          }
         }
-      }
 
-      if (S_->HasMesh(domain_name + "_3d") && sublist_p->get<bool>("visualize on 3D mesh", true))
-        mesh_p = S_->GetMesh(domain_name + "_3d");
-
-      // vis successful timesteps
-      auto vis = Teuchos::rcp(new Amanzi::Visualization(*sublist_p));
-      vis->set_name(domain_name);
-      vis->set_mesh(mesh_p);
-      vis->CreateFiles(false);
-      visualization_.push_back(vis);
-
-    } else if (Amanzi::Keys::isDomainSet(domain_name)) {
-      // visualize domain set
-      const auto& dset = S_->GetDomainSet(Amanzi::Keys::getDomainSetName(domain_name));
-      auto sublist_p = Teuchos::sublist(vis_list, domain_name);
-
-      if (sublist_p->get("visualize individually", false)) {
-        // visualize each subdomain
-        for (const auto& subdomain : *dset) {
-          Teuchos::ParameterList sublist = vis_list->sublist(subdomain);
-          sublist.set<std::string>("file name base", std::string("ats_vis_") + subdomain);
-          auto vis = Teuchos::rcp(new Amanzi::Visualization(sublist));
-          vis->set_name(subdomain);
-          vis->set_mesh(S_->GetMesh(subdomain));
+        if (S_->HasMesh(domain_name + "_3d") && sublist_p->get<bool>("visualize on 3D mesh", true))
+          mesh_p = S_->GetMesh(domain_name + "_3d");
+
+        // vis successful timesteps
+        auto vis = Teuchos::rcp(new Amanzi::Visualization(*sublist_p));
+        vis->set_name(domain_name);
+        vis->set_mesh(mesh_p);
+        vis->CreateFiles(false);
+        visualization_.push_back(vis);
+
+      } else if (Amanzi::Keys::isDomainSet(domain_name)) {
+        // visualize domain set
+        const auto& dset = S_->GetDomainSet(Amanzi::Keys::getDomainSetName(domain_name));
+        auto sublist_p = Teuchos::sublist(vis_list, domain_name);
+
+        if (sublist_p->get("visualize individually", false)) {
+          // visualize each subdomain
+          for (const auto& subdomain : *dset) {
+            Teuchos::ParameterList sublist = vis_list->sublist(subdomain);
+            sublist.set<std::string>("file name base", std::string("ats_vis_") + subdomain);
+            auto vis = Teuchos::rcp(new Amanzi::Visualization(sublist));
+            vis->set_name(subdomain);
+            vis->set_mesh(S_->GetMesh(subdomain));
+            vis->CreateFiles(false);
+            visualization_.push_back(vis);
+          }
+        } else {
+          // visualize collectively
+          auto domain_name_base = Amanzi::Keys::getDomainSetName(domain_name);
+          if (!sublist_p->isParameter("file name base"))
+            sublist_p->set("file name base", std::string("ats_vis_") + domain_name_base);
+          auto vis = Teuchos::rcp(new Amanzi::VisualizationDomainSet(*sublist_p));
+          vis->set_name(domain_name_base);
+          vis->set_domain_set(dset);
+          vis->set_mesh(dset->get_referencing_parent());
           vis->CreateFiles(false);
           visualization_.push_back(vis);
         }
-      } else {
-        // visualize collectively
-        auto domain_name_base = Amanzi::Keys::getDomainSetName(domain_name);
-        if (!sublist_p->isParameter("file name base"))
-          sublist_p->set("file name base", std::string("ats_vis_") + domain_name_base);
-        auto vis = Teuchos::rcp(new Amanzi::VisualizationDomainSet(*sublist_p));
-        vis->set_name(domain_name_base);
-        vis->set_domain_set(dset);
-        vis->set_mesh(dset->get_referencing_parent());
-        vis->CreateFiles(false);
-        visualization_.push_back(vis);
       }
     }
   }
@@ -291,7 +328,21 @@ Coordinator::initialize()
   // make observations at time 0
   for (const auto& obs : observations_) obs->MakeObservations(S_.ptr());
 
-  // set up the TSM
+  // set up the TSM and checkpoint triggers
+  InitializeEvents_();
+
+  // -- advance cycle to 0 and begin
+  if (S_->get_cycle() == -1) S_->advance_cycle();
+}
+
+
+// -----------------------------------------------------------------------------
+// Registers event times with the time step manager, and records the initial
+// values of checkpoint triggers.
+// -----------------------------------------------------------------------------
+void
+Coordinator::InitializeEvents_()
+{
   // -- register visualization times
   for (const auto& vis : visualization_) vis->RegisterWithTimeStepManager(tsm_.ptr());
 
@@ -304,6 +355,9 @@ Coordinator::initialize()
   // -- register the final time
   tsm_->RegisterTimeEvent(t1_);
 
+  // -- register the ends of spin-up cycles
+  if (spinup_ != Teuchos::null) spinup_->Initialize(*S_, S_->get_time(), t1_, *tsm_);
+
   // -- register any intermediate requested times
   if (coordinator_list_->isSublist("required times")) {
     Teuchos::ParameterList& sublist = coordinator_list_->sublist("required times");
@@ -311,8 +365,16 @@ Coordinator::initialize()
     pause_times.RegisterWithTimeStepManager(tsm_.ptr());
   }
 
-  // -- advance cycle to 0 and begin
-  if (S_->get_cycle() == -1) S_->advance_cycle();
+  // -- record the initial value of checkpoint triggers
+  checkpoint_trigger_values_.clear();
+  for (const auto& key : checkpoint_triggers_) {
+    if (!S_->HasRecord(key, Amanzi::Tags::DEFAULT)) {
+      Errors::Message msg;
+      msg << "Coordinator: checkpoint trigger \"" << key << "\" is not a scalar in State.";
+      Exceptions::amanzi_throw(msg);
+    }
+    checkpoint_trigger_values_.push_back(S_->Get<double>(key, Amanzi::Tags::DEFAULT));
+  }
 }
 
 
@@ -328,24 +390,6 @@ Coordinator::finalize()
 }
 
 
-double
-rss_usage()
-{ // return ru_maxrss in MBytes
-#if (defined(__unix__) || defined(__unix) || defined(unix) || defined(__APPLE__) ||                \
-     defined(__MACH__))
-  struct rusage usage;
-  getrusage(RUSAGE_SELF, &usage);
-#  if (defined(__APPLE__) || defined(__MACH__))
-  return static_cast<double>(usage.ru_maxrss) / 1024.0 / 1024.0;
-#  else
-  return static_cast<double>(usage.ru_maxrss) / 1024.0;
-#  endif
-#else
-  return 0.0;
-#endif
-}
-
-
 void
 Coordinator::report_memory()
 {
@@ -453,6 +497,16 @@ Coordinator::InitializeFromPlist_()
   restart_ = coordinator_list_->isParameter("restart from checkpoint file");
   if (restart_)
     restart_filename_ = coordinator_list_->get<std::string>("restart from checkpoint file");
+
+  // checkpoints requested by PKs
+  if (coordinator_list_->isParameter("checkpoint triggers"))
+    checkpoint_triggers_ =
+      coordinator_list_->get<Teuchos::Array<std::string>>("checkpoint triggers").toVector();
+
+  // spin-up control
+  if (coordinator_list_->isSublist("spin-up"))
+    spinup_ = Teuchos::rcp(
+      new CyclostationarySpinup(coordinator_list_->sublist("spin-up"), t0_, comm_));
 }
 
 
@@ -535,6 +589,7 @@ Coordinator::advance()
         // undeform the mesh
         Amanzi::AmanziGeometry::Point_List final_positions;
         mesh->second.first->deform(node_ids, old_positions, false, &final_positions);
+        Amanzi::MeshGeometryCache::Invalidate(*mesh->second.first);
       }
     }
   }
@@ -573,6 +628,14 @@ Coordinator::checkpoint(bool force)
   double time = S_->get_time();
   bool dump = force;
   dump |= checkpoint_->DumpRequested(cycle, time);
+
+  // PKs may request a checkpoint, e.g. of a converged spin-up, by setting a
+  // trigger.  This is called after the step is committed by all PKs.
+  for (int i = 0; i != checkpoint_triggers_.size(); ++i) {
+    double value = S_->Get<double>(checkpoint_triggers_[i], Amanzi::Tags::DEFAULT);
+    dump |= value != 0. && checkpoint_trigger_values_[i] == 0.;
+    checkpoint_trigger_values_[i] = value;
+  }
   if (dump) checkpoint_->Write(*S_);
   return dump;
 }
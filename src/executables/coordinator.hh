@@ -34,6 +34,8 @@ class UnstructuredObservations;
 
 namespace ATS {
 
+class CyclostationarySpinup;
+
 class Coordinator {
  public:
   Coordinator(const Teuchos::RCP<Teuchos::ParameterList>& plist, const Amanzi::Comm_ptr_type& comm);
@@ -51,6 +53,7 @@ class Coordinator {
 
  protected:
   void InitializeFromPlist_();
+  void InitializeEvents_();
 
   // PK container and factory
   Teuchos::RCP<Amanzi::PK> pk_;
@@ -77,12 +80,17 @@ class Coordinator {
   std::vector<Teuchos::RCP<Amanzi::Visualization>> visualization_;
   std::vector<Teuchos::RCP<Amanzi::Visualization>> failed_visualization_;
   Teuchos::RCP<Amanzi::Checkpoint> checkpoint_;
+  std::vector<std::string> checkpoint_triggers_;
+  std::vector<double> checkpoint_trigger_values_;
   bool restart_;
   std::string restart_filename_;
 
   // observations
   std::vector<Teuchos::RCP<Amanzi::UnstructuredObservations>> observations_;
 
+  // spin-up to a periodic steady state, if requested
+  Teuchos::RCP<CyclostationarySpinup> spinup_;
+
   // timers
   Teuchos::RCP<Teuchos::Time> setup_timer_;
   Teuchos::RCP<Teuchos::Time> cycle_timer_;
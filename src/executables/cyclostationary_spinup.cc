@@ -0,0 +1,283 @@
+/*
+  Copyright 2010-202x held jointly by participating institutions.
+  ATS is released under the three-clause BSD License.
+  The terms of use and "as is" disclaimer for this license are
+  provided in the top-level COPYRIGHT file.
+
+  Authors:
+*/
+
+#include <algorithm>
+#include <cmath>
+#include <string>
+
+#include "Epetra_Map.h"
+
+#include "errors.hh"
+#include "Units.hh"
+#include "State.hh"
+#include "TimeStepManager.hh"
+#include "pk_helpers.hh"
+#include "anderson_accelerator.hh"
+
+#include "cyclostationary_spinup.hh"
+
+namespace ATS {
+
+CyclostationarySpinup::CyclostationarySpinup(Teuchos::ParameterList& plist,
+                                             double t_start,
+                                             const Amanzi::Comm_ptr_type& comm)
+  : comm_(comm),
+    t_start_(t_start),
+    prev_tag_("spinup_previous"),
+    iterate_tag_("spinup_iterate"),
+    num_cycles_(0),
+    converged_(false),
+    accelerated_(false)
+{
+  vo_ = Teuchos::rcp(new Amanzi::VerboseObject(comm_, "Spin-up", plist));
+
+  Amanzi::Utils::Units units;
+  period_ = plist.get<double>("period", 1.);
+  std::string period_units = plist.get<std::string>("period units", "yr");
+  if (!units.IsValidTime(period_units)) {
+    Errors::Message msg;
+    msg << "Spin-up period: unknown time units type: \"" << period_units
+        << "\"  Valid are: " << units.ValidTimeStrings();
+    Exceptions::amanzi_throw(msg);
+  }
+  bool success;
+  period_ = units.ConvertTime(period_, period_units, "s", success);
+  if (period_ <= 0.) {
+    Errors::Message msg("Spin-up: \"period\" must be positive.");
+    Exceptions::amanzi_throw(msg);
+  }
+  max_cycles_ = plist.get<int>("maximum cycles", -1);
+
+  conv_keys_ = plist.get<Teuchos::Array<std::string>>("convergence keys").toVector();
+  if (plist.isParameter("absolute tolerances")) {
+    atols_ = plist.get<Teuchos::Array<double>>("absolute tolerances").toVector();
+  } else {
+    atols_.resize(conv_keys_.size(), 0.);
+  }
+  if (atols_.size() != conv_keys_.size()) {
+    Errors::Message msg(
+      "Spin-up: \"absolute tolerances\" must have one entry per convergence key.");
+    Exceptions::amanzi_throw(msg);
+  }
+  rtol_ = plist.get<double>("relative tolerance", 1.e-4);
+  conv_errors_.resize(conv_keys_.size(), 0.);
+
+  if (plist.isParameter("accelerated keys")) {
+    accel_keys_ = plist.get<Teuchos::Array<std::string>>("accelerated keys").toVector();
+  }
+  depth_ = plist.get<int>("Anderson depth", 3);
+  if (!accel_keys_.empty()) {
+    anderson_ = Teuchos::rcp(
+      new Amanzi::AndersonAccelerator(depth_, plist.get<double>("relaxation", 1.)));
+    for (int i = 0; i != 2 * (depth_ + 1); ++i)
+      history_tags_.emplace_back(Amanzi::Tag("spinup_history_" + std::to_string(i)));
+  }
+}
+
+
+void
+CyclostationarySpinup::Setup(Amanzi::State& S) const
+{
+  auto requireCopy = [&S](const Amanzi::Key& key, const Amanzi::Tag& tag) {
+    S.Require<Amanzi::CompositeVector, Amanzi::CompositeVectorSpace>(key, tag, "spinup");
+    auto& record = S.GetRecordW(key, tag, "spinup");
+    record.set_io_checkpoint(true);
+    record.set_io_vis(false);
+  };
+  for (const auto& key : conv_keys_) requireCopy(key, prev_tag_);
+  for (const auto& key : accel_keys_) {
+    requireCopy(key, iterate_tag_);
+    for (const auto& tag : history_tags_) requireCopy(key, tag);
+  }
+}
+
+
+void
+CyclostationarySpinup::Initialize(Amanzi::State& S,
+                                  double t0,
+                                  double t1,
+                                  Amanzi::TimeStepManager& tsm)
+{
+  // Cycles are counted from the start time, so that a restart continues the
+  // cycle it stopped in.
+  num_cycles_ = std::max(0, (int)std::floor((t0 - t_start_) / period_ + 1.e-6));
+  t_cycle_end_ = t_start_ + (num_cycles_ + 1) * period_;
+
+  for (const auto& key : conv_keys_) conv_sizes_.push_back(Size_(S, { key }));
+  Epetra_Map conv_map(-1, Size_(S, conv_keys_), 0, *comm_);
+  conv_ = Teuchos::rcp(new Epetra_Vector(conv_map));
+  conv_prev_ = Teuchos::rcp(new Epetra_Vector(conv_map));
+
+  if (!accel_keys_.empty()) {
+    Epetra_Map accel_map(-1, Size_(S, accel_keys_), 0, *comm_);
+    x_ = Teuchos::rcp(new Epetra_Vector(accel_map));
+    g_ = Teuchos::rcp(new Epetra_Vector(accel_map));
+    Pack_(S, accel_keys_, iterate_tag_, *x_);
+
+    // each cycle but the first adds a pair of differences to the history
+    std::vector<Teuchos::RCP<const Epetra_MultiVector>> history;
+    int n_history = num_cycles_ == 0 ? 0 : 2 * (std::min(num_cycles_ - 1, depth_) + 1);
+    for (int i = 0; i != n_history; ++i) {
+      auto v = Teuchos::rcp(new Epetra_Vector(accel_map));
+      Pack_(S, accel_keys_, history_tags_[i], *v);
+      history.push_back(v);
+    }
+    anderson_->set_history(history);
+  }
+
+  // steps must land on the end of each cycle
+  if (t1 < 0.) {
+    // no end time, so each cycle end is registered as the previous one ends
+    tsm_ = Teuchos::ptr(&tsm);
+    tsm_->RegisterTimeEvent(t_cycle_end_);
+  } else {
+    for (double t = t_cycle_end_; t <= t1; t += period_) tsm.RegisterTimeEvent(t);
+  }
+}
+
+
+bool
+CyclostationarySpinup::Update(Amanzi::State& S, double t)
+{
+  accelerated_ = false;
+  if (t < t_cycle_end_ - 1.e-6 * period_) return false;
+  t_cycle_end_ += period_;
+  if (tsm_ != Teuchos::null) tsm_->RegisterTimeEvent(t_cycle_end_);
+  num_cycles_++;
+
+  // year-over-year change in the convergence keys
+  Pack_(S, conv_keys_, Amanzi::Tags::NEXT, *conv_);
+  bool converged = false;
+  if (num_cycles_ > 1) {
+    Pack_(S, conv_keys_, prev_tag_, *conv_prev_);
+    std::vector<double> errors(conv_keys_.size(), 0.);
+    int n = 0;
+    for (int k = 0; k != conv_keys_.size(); ++k) {
+      for (int i = 0; i != conv_sizes_[k]; ++i, ++n) {
+        double x = (*conv_)[n];
+        double err = std::abs(x - (*conv_prev_)[n]) / (atols_[k] + rtol_ * std::abs(x));
+        if (!std::isfinite(err)) err = (x == (*conv_prev_)[n]) ? 0. : 1.e99;
+        errors[k] = std::max(errors[k], err);
+      }
+    }
+    comm_->MaxAll(errors.data(), conv_errors_.data(), errors.size());
+
+    converged = true;
+    for (double err : conv_errors_) converged &= err <= 1.;
+  }
+  Unpack_(S, conv_keys_, prev_tag_, *conv_);
+
+  Teuchos::OSTab tab = vo_->getOSTab();
+  if (vo_->os_OK(Teuchos::VERB_LOW)) {
+    *vo_->os() << "cycle " << num_cycles_ << " ended at t = " << t << " s";
+    if (num_cycles_ > 1) {
+      *vo_->os() << ", scaled change (converged <= 1):";
+      for (int k = 0; k != conv_keys_.size(); ++k)
+        *vo_->os() << " " << conv_keys_[k] << " = " << conv_errors_[k];
+    }
+    *vo_->os() << std::endl;
+  }
+
+  if (converged || (max_cycles_ > 0 && num_cycles_ >= max_cycles_)) {
+    converged_ = converged;
+    if (vo_->os_OK(Teuchos::VERB_LOW)) {
+      if (converged_) {
+        *vo_->os() << "converged to a periodic steady state after " << num_cycles_ << " cycles."
+                   << std::endl;
+      } else {
+        *vo_->os() << vo_->color("yellow") << "NOT converged after the maximum of "
+                   << num_cycles_ << " cycles." << vo_->reset() << std::endl;
+      }
+    }
+    return true;
+  }
+
+  // extrapolate the start of the next cycle
+  if (!accel_keys_.empty()) {
+    Pack_(S, accel_keys_, Amanzi::Tags::NEXT, *g_);
+    anderson_->Update(*x_, *g_);
+    UnpackAccelerated_(S, *x_);
+    accelerated_ = true;
+
+    Unpack_(S, accel_keys_, iterate_tag_, *x_);
+    auto history = anderson_->history();
+    for (int i = 0; i != history.size(); ++i)
+      Unpack_(S, accel_keys_, history_tags_[i], *(*history[i])(0));
+  }
+  return false;
+}
+
+
+int
+CyclostationarySpinup::Size_(const Amanzi::State& S, const Amanzi::KeyVector& keys) const
+{
+  int n = 0;
+  for (const auto& key : keys) {
+    const auto& cv = S.Get<Amanzi::CompositeVector>(key, Amanzi::Tags::NEXT);
+    for (const auto& comp : cv) {
+      const auto& vc = *cv.ViewComponent(comp, false);
+      n += vc.MyLength() * vc.NumVectors();
+    }
+  }
+  return n;
+}
+
+
+void
+CyclostationarySpinup::Pack_(Amanzi::State& S,
+                             const Amanzi::KeyVector& keys,
+                             const Amanzi::Tag& tag,
+                             Epetra_Vector& v) const
+{
+  int n = 0;
+  for (const auto& key : keys) {
+    if (S.HasEvaluator(key, tag)) S.GetEvaluator(key, tag).Update(S, "coordinator");
+    const auto& cv = S.Get<Amanzi::CompositeVector>(key, tag);
+    for (const auto& comp : cv) {
+      const auto& vc = *cv.ViewComponent(comp, false);
+      for (int k = 0; k != vc.NumVectors(); ++k)
+        for (int i = 0; i != vc.MyLength(); ++i) v[n++] = vc[k][i];
+    }
+  }
+}
+
+
+void
+CyclostationarySpinup::Unpack_(Amanzi::State& S,
+                               const Amanzi::KeyVector& keys,
+                               const Amanzi::Tag& tag,
+                               const Epetra_Vector& v) const
+{
+  int n = 0;
+  for (const auto& key : keys) {
+    // e.g. not all keys have a copy at CURRENT
+    if (!S.HasRecord(key, tag)) {
+      n += Size_(S, { key });
+      continue;
+    }
+    auto& cv = S.GetW<Amanzi::CompositeVector>(key, tag, S.GetRecord(key, tag).owner());
+    for (const auto& comp : cv) {
+      auto& vc = *cv.ViewComponent(comp, false);
+      for (int k = 0; k != vc.NumVectors(); ++k)
+        for (int i = 0; i != vc.MyLength(); ++i) vc[k][i] = v[n++];
+    }
+    cv.ScatterMasterToGhosted();
+  }
+}
+
+
+void
+CyclostationarySpinup::UnpackAccelerated_(Amanzi::State& S, const Epetra_Vector& v) const
+{
+  Unpack_(S, accel_keys_, Amanzi::Tags::NEXT, v);
+  Unpack_(S, accel_keys_, Amanzi::Tags::CURRENT, v);
+  for (const auto& key : accel_keys_) Amanzi::changedEvaluatorPrimary(key, Amanzi::Tags::NEXT, S);
+}
+
+} // namespace ATS
@@ -0,0 +1,163 @@
+/*
+  Copyright 2010-202x held jointly by participating institutions.
+  ATS is released under the three-clause BSD License.
+  The terms of use and "as is" disclaimer for this license are
+  provided in the top-level COPYRIGHT file.
+
+  Authors:
+*/
+
+//! Spin-up to a periodic steady state under repeated forcing.
+/*!
+
+Spin-up repeats a forcing cycle, typically a year of climate, until the state
+at the end of each cycle no longer changes.  When the `"spin-up`" sublist is
+provided to the `"cycle driver`", the Coordinator lands a step on the end of
+each cycle and there:
+
+- compares the convergence keys, e.g. temperature and water content, with
+  their values at the end of the previous cycle, and stops the simulation
+  when, in every cell, the change is within tolerance:
+
+    | x_k - x_{k-1} | <= atol + rtol * | x_k |
+
+- optionally accelerates, treating a cycle as a map G from the state at its
+  start to the state at its end, whose fixed point is the periodic steady
+  state.  The accelerated keys, which must be primary variables, are reset
+  to the next Anderson iterate of that map before the next cycle starts.
+
+Acceleration assumes the accelerated keys determine the state at the start of
+a cycle; other PK state, e.g. snow or vegetation, simply carries over.  After
+the keys are reset, time integrators restart from them, as their history no
+longer applies.
+
+Cycles are counted from the start time of the simulation.  The convergence
+keys at the end of the last cycle, and the accelerated keys at its start with
+the Anderson history, are kept in State at tags `"spinup_previous`",
+`"spinup_iterate`", and `"spinup_history_i`", so that they are checkpointed.
+A restart from such a checkpoint continues the cycle it stopped in, as if
+the run had not stopped.  Checkpoints written without spin-up do not have
+these copies, so spin-up cannot be restarted from them.
+
+.. _spinup-spec:
+.. admonition:: spinup-spec
+
+  * `"period`" ``[double]`` **1** Length of the forcing cycle.
+
+  * `"period units`" ``[string]`` **"yr"** One of `"s`", `"d`", or `"yr`".
+
+  * `"convergence keys`" ``[Array(string)]`` Fields checked for convergence.
+
+  * `"absolute tolerances`" ``[Array(double)]`` **0** atol above, one per
+    convergence key, in the key's units.
+
+  * `"relative tolerance`" ``[double]`` **1e-4** rtol above.
+
+  * `"accelerated keys`" ``[Array(string)]`` **empty** Primary variables that
+    are extrapolated at the end of each cycle.  If empty, cycles are simply
+    repeated.
+
+  * `"Anderson depth`" ``[int]`` **3** Number of previous cycles used in
+    extrapolation; 0 is no acceleration.
+
+  * `"relaxation`" ``[double]`` **1** Relaxation of the extrapolation.
+
+  * `"maximum cycles`" ``[int]`` **-1** If positive, stop after this many
+    cycles, converged or not.
+
+*/
+
+#pragma once
+
+#include <vector>
+
+#include "Teuchos_ParameterList.hpp"
+#include "Teuchos_RCP.hpp"
+#include "Teuchos_Ptr.hpp"
+#include "Epetra_Vector.h"
+
+#include "AmanziComm.hh"
+#include "Key.hh"
+#include "Tag.hh"
+#include "VerboseObject.hh"
+
+namespace Amanzi {
+class State;
+class TimeStepManager;
+class AndersonAccelerator;
+} // namespace Amanzi
+
+namespace ATS {
+
+class CyclostationarySpinup {
+ public:
+  // Cycles start at t_start, the start time of the simulation.
+  CyclostationarySpinup(Teuchos::ParameterList& plist,
+                        double t_start,
+                        const Amanzi::Comm_ptr_type& comm);
+
+  // Requires the copies of keys that are checkpointed.  Called after PKs
+  // are set up, before State is.
+  void Setup(Amanzi::State& S) const;
+
+  // Restores the spin-up state at t0 from State, and registers the ends of
+  // cycles up to t1 with the time step manager.  If t1 < 0, the end of each
+  // cycle is registered as the previous cycle ends.
+  void Initialize(Amanzi::State& S, double t0, double t1, Amanzi::TimeStepManager& tsm);
+
+  // Called after each successful step, ending at t.  At the end of a cycle,
+  // checks convergence and accelerates.  Returns true when spin-up is done.
+  // Collective.
+  bool Update(Amanzi::State& S, double t);
+
+  // True if the last call to Update() reset the accelerated keys.
+  bool accelerated() const { return accelerated_; }
+
+  bool converged() const { return converged_; }
+  int num_cycles() const { return num_cycles_; }
+  double start_time() const { return t_start_; }
+
+ private:
+  int Size_(const Amanzi::State& S, const Amanzi::KeyVector& keys) const;
+  void Pack_(Amanzi::State& S,
+             const Amanzi::KeyVector& keys,
+             const Amanzi::Tag& tag,
+             Epetra_Vector& v) const;
+  void Unpack_(Amanzi::State& S,
+               const Amanzi::KeyVector& keys,
+               const Amanzi::Tag& tag,
+               const Epetra_Vector& v) const;
+  void UnpackAccelerated_(Amanzi::State& S, const Epetra_Vector& v) const;
+
+ private:
+  Amanzi::Comm_ptr_type comm_;
+  Teuchos::RCP<Amanzi::VerboseObject> vo_;
+
+  double t_start_;
+  double period_;
+  double t_cycle_end_;
+  int max_cycles_;
+  Teuchos::Ptr<Amanzi::TimeStepManager> tsm_; // set if cycle ends are registered lazily
+
+  Amanzi::KeyVector conv_keys_;
+  std::vector<double> atols_;
+  double rtol_;
+  std::vector<int> conv_sizes_;
+  Teuchos::RCP<Epetra_Vector> conv_prev_, conv_;
+  std::vector<double> conv_errors_;
+
+  Amanzi::KeyVector accel_keys_;
+  int depth_;
+  Teuchos::RCP<Amanzi::AndersonAccelerator> anderson_;
+  Teuchos::RCP<Epetra_Vector> x_, g_;
+
+  // tags of the checkpointed copies
+  Amanzi::Tag prev_tag_, iterate_tag_;
+  std::vector<Amanzi::Tag> history_tags_;
+
+  int num_cycles_;
+  bool converged_;
+  bool accelerated_;
+};
+
+} // namespace ATS
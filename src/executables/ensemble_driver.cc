@@ -0,0 +1,261 @@
+/*
+  Copyright 2010-202x held jointly by participating institutions.
+  ATS is released under the three-clause BSD License.
+  The terms of use and "as is" disclaimer for this license are
+  provided in the top-level COPYRIGHT file.
+
+  Authors:
+*/
+
+#include "mpi.h"
+#include "Epetra_MpiComm.h"
+#include "Teuchos_TimeMonitor.hpp"
+
+#include "errors.hh"
+#include "Checkpoint.hh"
+#include "Evaluator_Factory.hh"
+#include "UnstructuredObservations.hh"
+#include "State.hh"
+#include "TimeStepManager.hh"
+#include "PK.hh"
+#include "pk_helpers.hh"
+
+#include "setup_profiler.hh"
+#include "state_snapshot.hh"
+#include "cyclostationary_spinup.hh"
+#include "ensemble_driver.hh"
+
+namespace ATS {
+
+// -----------------------------------------------------------------------------
+// setup and initialize once, then run each member from the initialized State
+// -----------------------------------------------------------------------------
+int
+EnsembleDriver::ensemble_driver(const Teuchos::ParameterList& members_list,
+                                const std::vector<std::string>& members)
+{
+  {
+    Teuchos::TimeMonitor monitor(*setup_timer_);
+    setup();
+    // members write their own observations
+    observations_.clear();
+    initialize();
+
+    SetupProfiler::Phase phase("capture snapshot");
+    snapshot_ = Teuchos::rcp(new StateSnapshot(*S_));
+  }
+  SetupProfiler::report(comm_, *vo_, Teuchos::VERB_MEDIUM);
+
+  Teuchos::OSTab tab = vo_->getOSTab();
+  int num_failed = 0;
+  for (int i = 0; i != members.size(); ++i) {
+    const std::string& member = members[i];
+    double wallclock = timer_->totalElapsedTime(true);
+    if (vo_->os_OK(Teuchos::VERB_LOW)) {
+      *vo_->os() << "======================================================================"
+                 << std::endl
+                 << "Ensemble member \"" << member << "\" (" << i + 1 << " of " << members.size()
+                 << ")" << std::endl;
+    }
+
+    try {
+      if (i > 0) {
+        // Reset to the initialized State and re-initialize PKs, so that none
+        // of their internal state, e.g. time integrator history, carries
+        // over.  Initial conditions are then overwritten by the snapshot, in
+        // case they were read from a checkpoint.
+        snapshot_->Restore(*S_);
+        pk_->Initialize();
+        snapshot_->Restore(*S_);
+        pk_->CommitStep(S_->get_time(), S_->get_time(), Amanzi::Tags::NEXT);
+        visualization_.clear();
+        failed_visualization_.clear();
+        observations_.clear();
+
+        // events of the last member are not repeated
+        tsm_ = Teuchos::rcp(new Amanzi::TimeStepManager());
+        if (spinup_ != Teuchos::null) {
+          spinup_ = Teuchos::rcp(new CyclostationarySpinup(
+            coordinator_list_->sublist("spin-up"), spinup_->start_time(), comm_));
+        }
+        InitializeEvents_();
+      }
+
+      const Teuchos::ParameterList& member_list = members_list.sublist(member);
+      Teuchos::ParameterList overrides;
+      if (member_list.isSublist("evaluator overrides"))
+        overrides = member_list.sublist("evaluator overrides");
+      ApplyOverrides_(overrides);
+
+      CreateObservations_(member);
+      checkpoint_->set_filebasename(member + "_checkpoint");
+
+      TimeLoop_();
+      finalize();
+
+    } catch (const Errors::Message& e) {
+      num_failed++;
+      for (const auto& obs : observations_) obs->Flush();
+      if (vo_->os_OK(Teuchos::VERB_LOW)) {
+        *vo_->os() << vo_->color("red") << "Ensemble member \"" << member
+                   << "\" failed: " << e.what() << vo_->reset() << std::endl;
+      }
+    }
+
+    if (vo_->os_OK(Teuchos::VERB_LOW)) {
+      *vo_->os() << "Ensemble member \"" << member << "\" ended at t = " << S_->get_time()
+                 << " s, cycle " << S_->get_cycle() << ", in "
+                 << timer_->totalElapsedTime(true) - wallclock << " s wallclock" << std::endl;
+    }
+  }
+
+  report_memory();
+  Teuchos::TimeMonitor::summarize(*vo_->os());
+  return num_failed;
+}
+
+
+// -----------------------------------------------------------------------------
+// Resets the evaluator lists overridden by the last member, and applies the
+// overrides of this one.
+// -----------------------------------------------------------------------------
+void
+EnsembleDriver::ApplyOverrides_(const Teuchos::ParameterList& overrides)
+{
+  std::set<Amanzi::Key> keys(overridden_);
+  overridden_.clear();
+  for (const auto& entry : overrides) {
+    const Amanzi::Key& key = entry.first;
+    if (!overrides.isSublist(key) || !S_->HasEvaluatorList(key)) {
+      Errors::Message msg;
+      msg << "Ensemble: \"evaluator overrides\" entry \"" << key
+          << "\" is not a sublist named by a key in \"state\" \"evaluators\".";
+      Exceptions::amanzi_throw(msg);
+    }
+    keys.insert(key);
+    overridden_.insert(key);
+  }
+
+  for (const auto& key : keys) {
+    Teuchos::ParameterList& elist = S_->GetEvaluatorList(key);
+    auto base = base_lists_.find(key);
+    if (base == base_lists_.end()) base = base_lists_.emplace(key, elist).first;
+    elist = base->second;
+    if (overrides.isSublist(key)) elist.setParameters(overrides.sublist(key));
+    ReplaceEvaluator_(key);
+  }
+}
+
+
+// -----------------------------------------------------------------------------
+// Recreates the evaluator of key from its list, at every tag at which it is
+// not a primary variable.  Evaluators shared across tags stay shared.
+// -----------------------------------------------------------------------------
+void
+EnsembleDriver::ReplaceEvaluator_(const Amanzi::Key& key)
+{
+  std::map<const Amanzi::Evaluator*, Teuchos::RCP<Amanzi::Evaluator>> replaced;
+  for (const auto& rec : S_->GetRecordSet(key)) {
+    const Amanzi::Tag& tag = rec.first;
+    if (!S_->HasEvaluator(key, tag)) continue;
+    Teuchos::RCP<Amanzi::Evaluator> old_eval = S_->GetEvaluatorPtr(key, tag);
+    if (Teuchos::rcp_dynamic_cast<Amanzi::EvaluatorPrimaryCV>(old_eval) != Teuchos::null) continue;
+
+    auto& eval = replaced[old_eval.get()];
+    if (eval == Teuchos::null) {
+      Teuchos::ParameterList elist = S_->GetEvaluatorList(key);
+      elist.setName(key);
+      elist.set("tag", tag.get());
+      Amanzi::Evaluator_Factory factory;
+      eval = factory.createEvaluator(elist);
+      eval->EnsureCompatibility(*S_);
+    }
+    S_->SetEvaluator(key, tag, eval);
+  }
+
+  if (replaced.empty()) {
+    Errors::Message msg;
+    msg << "Ensemble: \"" << key << "\" is a primary variable and cannot be overridden.";
+    Exceptions::amanzi_throw(msg);
+  }
+}
+
+
+// -----------------------------------------------------------------------------
+// Creates observations writing to files prefixed by the member name.
+// -----------------------------------------------------------------------------
+void
+EnsembleDriver::CreateObservations_(const std::string& member)
+{
+  observations_.clear();
+  Teuchos::ParameterList& observation_plist = plist_->sublist("observations");
+  for (auto& entry : observation_plist) {
+    Teuchos::ParameterList& obs_list = observation_plist.sublist(entry.first);
+    auto filename = obs_filenames_.find(entry.first);
+    if (filename == obs_filenames_.end()) {
+      filename = obs_filenames_
+                   .emplace(entry.first,
+                            obs_list.get<std::string>("observation output filename"))
+                   .first;
+    }
+    obs_list.set("observation output filename", member + "_" + filename->second);
+
+    auto obs = Teuchos::rcp(new Amanzi::UnstructuredObservations(obs_list));
+    obs->Setup(S_.ptr());
+    obs->RegisterWithTimeStepManager(tsm_.ptr());
+    obs->MakeObservations(S_.ptr());
+    observations_.emplace_back(obs);
+  }
+}
+
+
+// -----------------------------------------------------------------------------
+// split ranks into groups, each running its share of the members
+// -----------------------------------------------------------------------------
+int
+runEnsemble(const Teuchos::RCP<Teuchos::ParameterList>& plist, const Amanzi::Comm_ptr_type& comm)
+{
+  Teuchos::ParameterList& ensemble_list = plist->sublist("ensemble");
+  int num_groups = ensemble_list.get<int>("number of groups", 1);
+  if (num_groups < 1 || num_groups > comm->NumProc()) {
+    Errors::Message msg(
+      "Ensemble: \"number of groups\" must be between 1 and the number of ranks.");
+    Exceptions::amanzi_throw(msg);
+  }
+
+  // groups are contiguous blocks of ranks; members are dealt round robin
+  int group = comm->MyPID() * num_groups / comm->NumProc();
+  const Teuchos::ParameterList& members_list = ensemble_list.sublist("members");
+  std::vector<std::string> members;
+  int i = 0;
+  for (const auto& entry : members_list) {
+    if (!members_list.isSublist(entry.first)) {
+      Errors::Message msg("Ensemble: \"members\" list must only include sublists.");
+      Exceptions::amanzi_throw(msg);
+    }
+    if (i++ % num_groups == group) members.push_back(entry.first);
+  }
+
+  MPI_Comm group_comm;
+  MPI_Comm_split(comm->Comm(), group, comm->MyPID(), &group_comm);
+  int group_rank;
+  MPI_Comm_rank(group_comm, &group_rank);
+
+  int num_failed = 0;
+  {
+    // each group works on its own copy of the input
+    auto group_plist = Teuchos::rcp(new Teuchos::ParameterList(*plist));
+    EnsembleDriver driver(group_plist, Teuchos::rcp(new Epetra_MpiComm(group_comm)));
+    num_failed =
+      driver.ensemble_driver(group_plist->sublist("ensemble").sublist("members"), members);
+  }
+  MPI_Comm_free(&group_comm);
+
+  // count each group's failures once
+  if (group_rank != 0) num_failed = 0;
+  int total_failed = 0;
+  comm->SumAll(&num_failed, &total_failed, 1);
+  return total_failed;
+}
+
+} // namespace ATS
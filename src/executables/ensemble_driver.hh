@@ -0,0 +1,117 @@
+/*
+  Copyright 2010-202x held jointly by participating institutions.
+  ATS is released under the three-clause BSD License.
+  The terms of use and "as is" disclaimer for this license are
+  provided in the top-level COPYRIGHT file.
+
+  Authors:
+*/
+
+//! Runs an ensemble of parameter sets, paying for setup once.
+/*!
+
+Ensembles of, e.g., column simulations for calibration share the mesh and
+setup and differ only in parameters, so that setup may cost more than the
+simulation itself.  If the `"main`" list includes an `"ensemble`" sublist,
+the ranks are split into groups, each of which sets up and initializes the
+simulation once, captures the initialized State in memory, and then runs its
+share of the members in turn.  Before each member, State is reset to the
+initialized snapshot, PKs are re-initialized, and the member's parameters are
+applied.
+
+Parameters are overrides of evaluator lists in `"state`" `"evaluators`".
+Only the evaluators of overridden keys are recreated, at each tag at which
+they are not primary variables; the dependency graph is otherwise kept.
+Overrides of initial conditions, PK parameters, and evaluators providing
+multiple keys are not supported.  Note also that models a PK takes from an
+evaluator during setup, e.g. the water retention models used by Richards on
+boundary faces, are not recreated.
+
+Each member writes observations to files prefixed by its name, and its final
+checkpoint to `"NAME_checkpoint`".  Visualization is written only by the
+first member of each group.  A member that fails is reported and skipped.
+
+.. _ensemble-spec:
+.. admonition:: ensemble-spec
+
+  * `"number of groups`" ``[int]`` **1** Number of groups of ranks running
+    members concurrently.  Member i is run by group i modulo the number of
+    groups.
+
+  * `"members`" ``[list]`` One sublist per member, named by the member.  Each
+    includes:
+
+    * `"evaluator overrides`" ``[list]`` **optional** Sublists named by
+      evaluator key, whose parameters replace those of the corresponding list
+      in `"state`" `"evaluators`".
+
+.. code-block:: xml
+
+   <ParameterList name="ensemble">
+     <Parameter name="number of groups" type="int" value="4" />
+     <ParameterList name="members">
+       <ParameterList name="m000">
+         <ParameterList name="evaluator overrides">
+           <ParameterList name="base_porosity">
+             <ParameterList name="function">
+               <ParameterList name="domain">
+                 <Parameter name="region" type="string" value="computational domain" />
+                 <Parameter name="component" type="string" value="cell" />
+                 <ParameterList name="function">
+                   <ParameterList name="function-constant">
+                     <Parameter name="value" type="double" value="0.35" />
+                   </ParameterList>
+                 </ParameterList>
+               </ParameterList>
+             </ParameterList>
+           </ParameterList>
+         </ParameterList>
+       </ParameterList>
+     </ParameterList>
+   </ParameterList>
+
+*/
+
+#pragma once
+
+#include <map>
+#include <set>
+
+#include "ats_driver.hh"
+
+namespace ATS {
+
+class StateSnapshot;
+
+class EnsembleDriver : public ATSDriver {
+ public:
+  using ATSDriver::ATSDriver;
+
+  // Sets up once, then runs the named members of the "members" list.
+  // Returns the number of members that failed.
+  int ensemble_driver(const Teuchos::ParameterList& members_list,
+                      const std::vector<std::string>& members);
+
+ protected:
+  void ApplyOverrides_(const Teuchos::ParameterList& overrides);
+  void ReplaceEvaluator_(const Amanzi::Key& key);
+  void CreateObservations_(const std::string& member);
+
+ protected:
+  Teuchos::RCP<StateSnapshot> snapshot_;
+
+  // evaluator lists as set up, and the keys overridden by the last member
+  std::map<Amanzi::Key, Teuchos::ParameterList> base_lists_;
+  std::set<Amanzi::Key> overridden_;
+
+  // observation file names as input, by observation list
+  std::map<std::string, std::string> obs_filenames_;
+};
+
+
+// Splits comm into groups and runs the ensemble in the "ensemble" sublist of
+// plist.  Returns the number of members that failed, over all groups.
+int
+runEnsemble(const Teuchos::RCP<Teuchos::ParameterList>& plist, const Amanzi::Comm_ptr_type& comm);
+
+} // namespace ATS
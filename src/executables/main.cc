@@ -29,6 +29,8 @@
 #include "dbc.hh"
 #include "errors.hh"
 #include "ats_driver.hh"
+#include "ensemble_driver.hh"
+#include "setup_profiler.hh"
 
 // registration files
 #include "ats_registration_files.hh"
@@ -175,7 +177,11 @@ main(int argc, char* argv[])
   auto comm = Amanzi::getDefaultComm();
 
   // -- parse input file
-  Teuchos::RCP<Teuchos::ParameterList> plist = Teuchos::getParametersFromXmlFile(input_filename);
+  Teuchos::RCP<Teuchos::ParameterList> plist;
+  {
+    ATS::SetupProfiler::Phase phase("parse input");
+    plist = Teuchos::getParametersFromXmlFile(input_filename);
+  }
 
   // -- set default verbosity level
   Teuchos::RCP<Teuchos::FancyOStream> fos;
@@ -192,10 +198,15 @@ main(int argc, char* argv[])
 
 
   // create the top level driver and run simulation
-  ATS::ATSDriver driver(plist, comm);
   int ret = 0;
   try {
-    ret = driver.run();
+    if (plist->isSublist("ensemble")) {
+      // many parameter sets, sharing one setup
+      ret = ATS::runEnsemble(plist, comm) > 0 ? 1 : 0;
+    } else {
+      ATS::ATSDriver driver(plist, comm);
+      ret = driver.run();
+    }
   } catch (std::string& s) {
     if (rank == 0) { std::cerr << "ERROR:" << std::endl << s << std::endl; }
     return 1;
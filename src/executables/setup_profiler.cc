@@ -0,0 +1,156 @@
+/*
+  Copyright 2010-202x held jointly by participating institutions.
+  ATS is released under the three-clause BSD License.
+  The terms of use and "as is" disclaimer for this license are
+  provided in the top-level COPYRIGHT file.
+
+  Authors:
+*/
+
+#include <algorithm>
+#include <functional>
+#include <iomanip>
+#include <sys/resource.h>
+
+#include "Teuchos_Time.hpp"
+#include "dbc.hh"
+
+#include "setup_profiler.hh"
+
+namespace ATS {
+
+double
+rss_usage()
+{ // return ru_maxrss in MBytes
+#if (defined(__unix__) || defined(__unix) || defined(unix) || defined(__APPLE__) ||                \
+     defined(__MACH__))
+  struct rusage usage;
+  getrusage(RUSAGE_SELF, &usage);
+#  if (defined(__APPLE__) || defined(__MACH__))
+  return static_cast<double>(usage.ru_maxrss) / 1024.0 / 1024.0;
+#  else
+  return static_cast<double>(usage.ru_maxrss) / 1024.0;
+#  endif
+#else
+  return 0.0;
+#endif
+}
+
+
+std::vector<SetupProfiler::Record> SetupProfiler::records_;
+std::vector<SetupProfiler::Open> SetupProfiler::open_;
+
+
+void
+SetupProfiler::start(const std::string& name)
+{
+  int parent = open_.size() > 0 ? open_.back().record : -1;
+
+  // find an existing record of this phase in the same parent, or add one
+  auto rec = std::find_if(records_.begin(), records_.end(), [&](const Record& r) {
+    return r.parent == parent && r.name == name;
+  });
+  int index = rec - records_.begin();
+  if (rec == records_.end()) {
+    records_.emplace_back(Record{ name, parent, (int)open_.size(), 0, 0., 0. });
+  }
+  open_.emplace_back(Open{ index, Teuchos::Time::wallTime(), rss_usage() });
+}
+
+
+void
+SetupProfiler::stop()
+{
+  AMANZI_ASSERT(open_.size() > 0);
+  const Open& phase = open_.back();
+  Record& rec = records_[phase.record];
+  rec.count++;
+  rec.time += Teuchos::Time::wallTime() - phase.t0;
+  rec.rss_grow += rss_usage() - phase.rss0;
+  open_.pop_back();
+}
+
+
+void
+SetupProfiler::clear()
+{
+  records_.clear();
+  open_.clear();
+}
+
+
+void
+SetupProfiler::report(const Amanzi::Comm_ptr_type& comm,
+                      Amanzi::VerboseObject& vo,
+                      Teuchos::EVerbosityLevel level)
+{
+  // a rank with different phases would deadlock or garble the reductions
+  int l_n = records_.size();
+  int g_n_min, g_n_max;
+  comm->MinAll(&l_n, &g_n_min, 1);
+  comm->MaxAll(&l_n, &g_n_max, 1);
+  if (g_n_min != g_n_max) {
+    if (vo.os_OK(level)) {
+      *vo.os() << "Setup profile not reported: ranks recorded different setup phases."
+               << std::endl;
+    }
+    return;
+  }
+
+  std::vector<double> time(l_n), rss(l_n);
+  for (int i = 0; i != l_n; ++i) {
+    time[i] = records_[i].time;
+    rss[i] = records_[i].rss_grow;
+  }
+  std::vector<double> time_min(l_n), time_max(l_n), time_sum(l_n), rss_max(l_n);
+  if (l_n > 0) {
+    comm->MinAll(time.data(), time_min.data(), l_n);
+    comm->MaxAll(time.data(), time_max.data(), l_n);
+    comm->SumAll(time.data(), time_sum.data(), l_n);
+    comm->MaxAll(rss.data(), rss_max.data(), l_n);
+  }
+
+  if (!vo.os_OK(level)) return;
+  int nprocs = comm->NumProc();
+
+  // write in depth-first order, children below their parents
+  std::vector<int> order;
+  std::function<void(int)> visit = [&](int parent) {
+    for (int i = 0; i != l_n; ++i) {
+      if (records_[i].parent == parent) {
+        order.push_back(i);
+        visit(i);
+      }
+    }
+  };
+  visit(-1);
+
+  Teuchos::OSTab tab = vo.getOSTab();
+  auto flags = vo.os()->flags();
+  auto precision = vo.os()->precision();
+  *vo.os() << "======================================================================"
+           << std::endl
+           << "Setup phases (time [s] over " << nprocs << " ranks, peak RSS growth [MB]):"
+           << std::endl
+           << std::left << std::setw(34) << "  phase" << std::right << std::setw(9) << "min"
+           << std::setw(9) << "mean" << std::setw(9) << "max" << std::setw(7) << "imbal"
+           << std::setw(9) << "RSS" << std::endl;
+
+  for (int i : order) {
+    const Record& rec = records_[i];
+    std::string name = std::string(2 + 2 * rec.depth, ' ') + rec.name;
+    if (rec.count > 1) name += " (x" + std::to_string(rec.count) + ")";
+    if (name.size() > 33) name = name.substr(0, 30) + "...";
+
+    double mean = time_sum[i] / nprocs;
+    *vo.os() << std::left << std::setw(34) << name << std::right << std::fixed
+             << std::setprecision(3) << std::setw(9) << time_min[i] << std::setw(9) << mean
+             << std::setw(9) << time_max[i] << std::setprecision(2) << std::setw(7)
+             << (mean > 0. ? time_max[i] / mean : 1.) << std::setprecision(1) << std::setw(9)
+             << rss_max[i] << std::endl;
+  }
+  vo.os()->flags(flags);
+  vo.os()->precision(precision);
+}
+
+} // namespace ATS
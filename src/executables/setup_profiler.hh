@@ -0,0 +1,92 @@
+/*
+  Copyright 2010-202x held jointly by participating institutions.
+  ATS is released under the three-clause BSD License.
+  The terms of use and "as is" disclaimer for this license are
+  provided in the top-level COPYRIGHT file.
+
+  Authors:
+*/
+
+//! Times and reports the phases of simulation setup.
+/*!
+
+Time to the first timestep can be significant on large jobs, and a single
+"setup" timer does not say where it goes.  The setup profiler records, for each
+named phase of startup (parsing the input file, building regions and meshes,
+constructing the PK tree, State setup, field and evaluator initialization,
+reading checkpoints, writing the dependency graph, and creating vis files):
+
+- the wallclock time, reported as the min, mean, and max over ranks, and the
+  imbalance (max / mean), and
+- the growth in peak resident memory (ru_maxrss) over the phase, reported as the
+  max over ranks.
+
+Phases may be nested; nested phases are reported indented below their parent,
+and repeated phases with the same name and parent are accumulated.
+
+The report is written by the ATS driver, after initialization, when the
+Coordinator's verbosity is `"medium`" or higher.
+
+*/
+
+#pragma once
+
+#include <string>
+#include <vector>
+
+#include "AmanziComm.hh"
+#include "VerboseObject.hh"
+
+namespace ATS {
+
+// return ru_maxrss in MBytes
+double
+rss_usage();
+
+
+class SetupProfiler {
+ public:
+  struct Record {
+    std::string name;
+    int parent; // index of the enclosing phase, or -1
+    int depth;
+    int count;
+    double time;     // [s]
+    double rss_grow; // [MB]
+  };
+
+  // Times the enclosing scope as a phase.
+  class Phase {
+   public:
+    explicit Phase(const std::string& name) { SetupProfiler::start(name); }
+    ~Phase() { SetupProfiler::stop(); }
+
+    Phase(const Phase&) = delete;
+    Phase& operator=(const Phase&) = delete;
+  };
+
+  static void start(const std::string& name);
+  static void stop();
+
+  // Reduces phase statistics across ranks and writes them if vo is at or
+  // above level.  Collective on comm -- all ranks must have recorded the same
+  // phases.
+  static void report(const Amanzi::Comm_ptr_type& comm,
+                     Amanzi::VerboseObject& vo,
+                     Teuchos::EVerbosityLevel level);
+
+  static const std::vector<Record>& records() { return records_; }
+  static void clear();
+
+ private:
+  struct Open {
+    int record;
+    double t0;
+    double rss0;
+  };
+
+  static std::vector<Record> records_;
+  static std::vector<Open> open_;
+};
+
+} // namespace ATS
@@ -0,0 +1,61 @@
+/*
+  Copyright 2010-202x held jointly by participating institutions.
+  ATS is released under the three-clause BSD License.
+  The terms of use and "as is" disclaimer for this license are
+  provided in the top-level COPYRIGHT file.
+
+  Authors:
+*/
+
+#include "CompositeVector.hh"
+#include "State.hh"
+#include "pk_helpers.hh"
+
+#include "state_snapshot.hh"
+
+namespace ATS {
+
+StateSnapshot::StateSnapshot(const Amanzi::State& S)
+  : time_(S.get_time()), cycle_(S.get_cycle()), size_(0)
+{
+  for (auto entry = S.data_begin(); entry != S.data_end(); ++entry) {
+    for (const auto& rec : *entry->second) {
+      const auto& record = *rec.second;
+      if (record.ValidType<Amanzi::CompositeVector>()) {
+        const auto& cv = record.Get<Amanzi::CompositeVector>();
+        vectors_.push_back(
+          { entry->first, rec.first, Teuchos::rcp(new Amanzi::CompositeVector(cv)) });
+        for (const auto& comp : cv) {
+          const auto& vc = *cv.ViewComponent(comp, false);
+          size_ += vc.MyLength() * vc.NumVectors();
+        }
+      } else if (record.ValidType<double>()) {
+        scalars_.push_back({ entry->first, rec.first, record.Get<double>() });
+        size_++;
+      }
+    }
+  }
+}
+
+
+void
+StateSnapshot::Restore(Amanzi::State& S) const
+{
+  S.set_time(Amanzi::Tags::CURRENT, time_);
+  S.set_time(Amanzi::Tags::NEXT, time_);
+  S.set_cycle(cycle_);
+
+  for (const auto& v : vectors_) {
+    S.GetW<Amanzi::CompositeVector>(v.key, v.tag, S.GetRecord(v.key, v.tag).owner()) = *v.data;
+  }
+  for (const auto& s : scalars_) {
+    S.Assign<double>(s.key, s.tag, S.GetRecord(s.key, s.tag).owner(), s.data);
+  }
+
+  // secondary variables are recomputed from the restored primary variables
+  for (const auto& v : vectors_) {
+    if (S.HasEvaluator(v.key, v.tag)) Amanzi::changedEvaluatorPrimary(v.key, v.tag, S, false);
+  }
+}
+
+} // namespace ATS
@@ -0,0 +1,64 @@
+/*
+  Copyright 2010-202x held jointly by participating institutions.
+  ATS is released under the three-clause BSD License.
+  The terms of use and "as is" disclaimer for this license are
+  provided in the top-level COPYRIGHT file.
+
+  Authors:
+*/
+
+//! An in-memory copy of the data in State, to reset a run without setup.
+/*!
+
+Captures the time, cycle, and every CompositeVector and double record of an
+initialized State.  Restoring writes these back and marks all primary
+variables as changed, so that secondary variables are recomputed from the
+restored data on their next update.  Records of other types, e.g. gravity,
+are constants and are not captured.
+
+Internal state of PKs, e.g. the history of a time integrator, is not part of
+State and is not restored; PKs must be re-initialized.
+
+*/
+
+#pragma once
+
+#include <vector>
+
+#include "Teuchos_RCP.hpp"
+
+#include "Key.hh"
+#include "Tag.hh"
+
+namespace Amanzi {
+class State;
+class CompositeVector;
+} // namespace Amanzi
+
+namespace ATS {
+
+class StateSnapshot {
+ public:
+  explicit StateSnapshot(const Amanzi::State& S);
+
+  void Restore(Amanzi::State& S) const;
+
+  // local number of doubles held
+  std::size_t size() const { return size_; }
+
+ private:
+  template <typename T>
+  struct Entry {
+    Amanzi::Key key;
+    Amanzi::Tag tag;
+    T data;
+  };
+
+  double time_;
+  int cycle_;
+  std::vector<Entry<Teuchos::RCP<Amanzi::CompositeVector>>> vectors_;
+  std::vector<Entry<double>> scalars_;
+  std::size_t size_;
+};
+
+} // namespace ATS
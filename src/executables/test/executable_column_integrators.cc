@@ -0,0 +1,167 @@
+/*
+  Copyright 2010-202x held jointly by participating institutions.
+  ATS is released under the three-clause BSD License.
+  The terms of use and "as is" disclaimer for this license are
+  provided in the top-level COPYRIGHT file.
+
+  Authors:
+*/
+
+// Checks that the fused "column integrators" evaluator matches the
+// single-quantity column integrator evaluators.
+
+#include <UnitTest++.h>
+
+#include <algorithm>
+#include <cmath>
+#include <iostream>
+
+#include "Teuchos_ParameterXMLFileReader.hpp"
+#include "Teuchos_XMLParameterListHelpers.hpp"
+
+#include "AmanziComm.hh"
+#include "State.hh"
+#include "ats_mesh_factory.hh"
+#include "pk_helpers.hh"
+
+using namespace Amanzi;
+
+struct ColumnIntegratorsProblem {
+  ColumnIntegratorsProblem()
+  {
+    comm = getDefaultComm();
+    plist = Teuchos::getParametersFromXmlFile("test/executable_mesh_construct_columns.xml");
+    auto gm = Teuchos::rcp(new AmanziGeometry::GeometricModel(3, plist->sublist("regions"), *comm));
+    S = Teuchos::rcp(new State(plist->sublist("state")));
+    ATS::Mesh::createMeshes(*plist, comm, gm, *S);
+
+    auto& evals = S->GetEvaluatorList("surface-thaw_depth");
+    evals.set<std::string>("evaluator type", "column integrators");
+    auto& quantities = evals.sublist("integrated quantities");
+    quantities.sublist("thaw_depth").set<std::string>("integrator type", "thaw depth");
+    quantities.sublist("water_table_depth")
+      .set<std::string>("integrator type", "water table depth");
+    quantities.sublist("temperature_sum")
+      .set<std::string>("integrator type", "column sum evaluator")
+      .set<std::string>("summed key", "temperature")
+      .set<bool>("include volume to surface area factor", true);
+
+    S->GetEvaluatorList("surface-thaw_depth_single")
+      .set<std::string>("evaluator type", "thaw depth");
+    S->GetEvaluatorList("surface-water_table_depth_single")
+      .set<std::string>("evaluator type", "water table depth");
+    S->GetEvaluatorList("surface-temperature_sum_single")
+      .set<std::string>("evaluator type", "column sum evaluator")
+      .set<std::string>("summed key", "temperature")
+      .set<bool>("include volume to surface area factor", true);
+
+    S->GetEvaluatorList("cell_volume").set<std::string>("evaluator type", "cell volume");
+    S->GetEvaluatorList("surface-cell_volume").set<std::string>("evaluator type", "cell volume");
+
+    S->require_time(Tags::NEXT);
+    for (const auto& key : { "temperature", "saturation_gas" }) {
+      S->Require<CompositeVector, CompositeVectorSpace>(key, Tags::NEXT, key)
+        .SetMesh(S->GetMesh("domain"))
+        ->SetGhosted()
+        ->AddComponent("cell", AmanziMesh::CELL, 1);
+      requireEvaluatorPrimary(key, Tags::NEXT, *S);
+    }
+    for (const auto& key : keys) {
+      S->Require<CompositeVector, CompositeVectorSpace>(key, Tags::NEXT)
+        .SetMesh(S->GetMesh("surface"))
+        ->AddComponent("cell", AmanziMesh::CELL, 1);
+      S->RequireEvaluator(key, Tags::NEXT);
+    }
+
+    S->Setup();
+    S->set_time(Tags::NEXT, 0.);
+    S->InitializeFields();
+    S->InitializeEvaluators();
+  }
+
+  // Sets temperature to thawed and gas saturation to nonzero in the top
+  // n_thawed and n_unsaturated cells of each column.
+  void setColumns(int n_thawed, int n_unsaturated)
+  {
+    auto mesh = S->GetMesh("domain");
+    auto& temp = *S->GetW<CompositeVector>("temperature", Tags::NEXT, "temperature")
+                    .ViewComponent("cell", false);
+    auto& sg = *S->GetW<CompositeVector>("saturation_gas", Tags::NEXT, "saturation_gas")
+                  .ViewComponent("cell", false);
+    for (int col = 0; col != mesh->num_columns(false); ++col) {
+      const auto& cells = mesh->cells_of_column(col);
+      for (int i = 0; i != cells.size(); ++i) {
+        temp[0][cells[i]] = i < n_thawed ? 275. : 265.;
+        sg[0][cells[i]] = i < n_unsaturated ? 0.2 : 0.;
+      }
+    }
+    changedEvaluatorPrimary("temperature", Tags::NEXT, *S);
+    changedEvaluatorPrimary("saturation_gas", Tags::NEXT, *S);
+  }
+
+  // The sum of the cell volumes of the top n cells of each column, divided by
+  // the surface cell volume.
+  double expectedDepth(int col, int n)
+  {
+    auto mesh = S->GetMesh("domain");
+    const auto& cells = mesh->cells_of_column(col);
+    double depth = 0.;
+    for (int i = 0; i != std::min<int>(n, cells.size()); ++i) depth += mesh->cell_volume(cells[i]);
+    return depth / S->GetMesh("surface")->cell_volume(col);
+  }
+
+  void checkFusedMatchesSingle()
+  {
+    for (const auto& key : keys) S->GetEvaluator(key, Tags::NEXT).Update(*S, "test");
+    for (const auto& var : { "thaw_depth", "water_table_depth", "temperature_sum" }) {
+      Key fused_key = Keys::getKey("surface", var);
+      const auto& fused =
+        *S->Get<CompositeVector>(fused_key, Tags::NEXT).ViewComponent("cell", false);
+      const auto& single = *S->Get<CompositeVector>(fused_key + "_single", Tags::NEXT)
+                              .ViewComponent("cell", false);
+      for (int col = 0; col != fused.MyLength(); ++col)
+        CHECK_CLOSE(single[0][col], fused[0][col], 1.e-10 * std::abs(single[0][col]));
+    }
+  }
+
+  Teuchos::RCP<Teuchos::ParameterList> plist;
+  Comm_ptr_type comm;
+  Teuchos::RCP<State> S;
+  std::vector<Key> keys = { "surface-thaw_depth",
+                            "surface-water_table_depth",
+                            "surface-temperature_sum",
+                            "surface-thaw_depth_single",
+                            "surface-water_table_depth_single",
+                            "surface-temperature_sum_single" };
+};
+
+
+SUITE(ATS_COLUMN_INTEGRATORS)
+{
+  // Quantities stop scanning at different depths, and the column sum never
+  // stops.
+  TEST_FIXTURE(ColumnIntegratorsProblem, FUSED_MATCHES_SINGLE)
+  {
+    setColumns(2, 3);
+    checkFusedMatchesSingle();
+
+    const auto& thaw_depth =
+      *S->Get<CompositeVector>("surface-thaw_depth", Tags::NEXT).ViewComponent("cell", false);
+    const auto& wt_depth = *S->Get<CompositeVector>("surface-water_table_depth", Tags::NEXT)
+                              .ViewComponent("cell", false);
+    for (int col = 0; col != thaw_depth.MyLength(); ++col) {
+      CHECK_CLOSE(expectedDepth(col, 2), thaw_depth[0][col], 1.e-10);
+      CHECK_CLOSE(expectedDepth(col, 3), wt_depth[0][col], 1.e-10);
+    }
+  }
+
+  // The walk ends early once all quantities have stopped, and fully thawed or
+  // saturated columns scan to the bottom.
+  TEST_FIXTURE(ColumnIntegratorsProblem, FUSED_MATCHES_SINGLE_EXTREMES)
+  {
+    setColumns(0, 1000);
+    checkFusedMatchesSingle();
+    setColumns(1000, 0);
+    checkFusedMatchesSingle();
+  }
+}
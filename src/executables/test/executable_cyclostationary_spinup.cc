@@ -0,0 +1,224 @@
+/*
+  Copyright 2010-202x held jointly by participating institutions.
+  ATS is released under the three-clause BSD License.
+  The terms of use and "as is" disclaimer for this license are
+  provided in the top-level COPYRIGHT file.
+
+  Authors:
+*/
+
+// Checks convergence, acceleration, and restart of CyclostationarySpinup, with
+// a cycle that contracts the temperature in each cell towards a fixed point, at
+// a rate that differs between cells.
+
+#include <UnitTest++.h>
+
+#include <algorithm>
+#include <cmath>
+
+#include "AmanziComm.hh"
+#include "GeometricModel.hh"
+#include "MeshFactory.hh"
+#include "State.hh"
+#include "TimeStepManager.hh"
+#include "pk_helpers.hh"
+#include "cyclostationary_spinup.hh"
+
+using namespace Amanzi;
+
+struct SpinupProblem {
+  SpinupProblem()
+  {
+    comm = getDefaultComm();
+    auto gm = Teuchos::rcp(new AmanziGeometry::GeometricModel(3));
+    AmanziMesh::MeshFactory factory(comm, gm);
+    auto mesh = factory.create(0., 0., 0., 1., 1., 1., 4 * comm->NumProc(), 1, 1);
+
+    Teuchos::ParameterList state_list("state");
+    S = Teuchos::rcp(new State(state_list));
+    S->RegisterMesh("domain", mesh, false);
+    S->require_time(Tags::CURRENT);
+    S->require_time(Tags::NEXT);
+    for (const auto& tag : { Tags::NEXT, Tags::CURRENT }) {
+      S->Require<CompositeVector, CompositeVectorSpace>("temperature", tag, "temperature")
+        .SetMesh(mesh)
+        ->SetGhosted()
+        ->AddComponent("cell", AmanziMesh::CELL, 1);
+    }
+    requireEvaluatorPrimary("temperature", Tags::NEXT, *S);
+
+    plist.set<double>("period", 1.);
+    plist.set<std::string>("period units", "s");
+    plist.set<Teuchos::Array<std::string>>("convergence keys",
+                                           Teuchos::Array<std::string>(1, "temperature"));
+    plist.set<double>("relative tolerance", 1.e-6);
+  }
+
+  void accelerate(int depth)
+  {
+    plist.set<Teuchos::Array<std::string>>("accelerated keys",
+                                           Teuchos::Array<std::string>(1, "temperature"));
+    plist.set<int>("Anderson depth", depth);
+  }
+
+  // sets up State, starting at t = 0 from a temperature of 0
+  void setup(const ATS::CyclostationarySpinup& spinup)
+  {
+    spinup.Setup(*S);
+    S->Setup();
+    S->set_time(Tags::CURRENT, 0.);
+    S->set_time(Tags::NEXT, 0.);
+    temp().PutScalar(0.);
+    S->GetRecordW("temperature", Tags::NEXT, "temperature").set_initialized();
+    S->InitializeEvaluators();
+    S->InitializeFieldCopies();
+    x_start = Teuchos::rcp(new Epetra_MultiVector(temp()));
+  }
+
+  Epetra_MultiVector& temp(const Tag& tag = Tags::NEXT)
+  {
+    return *S->GetW<CompositeVector>("temperature", tag, "temperature")
+              .ViewComponent("cell", false);
+  }
+
+  // the periodic steady state of cell c, and the contraction rate
+  static double fixedPoint(int c) { return 1. + 0.1 * c; }
+  static double rate(int c) { return 0.5 + 0.1 * (c % 4); }
+
+  // runs the cycle ending at t, returning true when spin-up is done
+  bool cycle(ATS::CyclostationarySpinup& spinup, double t)
+  {
+    auto& x = temp();
+    for (int c = 0; c != x.MyLength(); ++c)
+      x[0][c] = rate(c) * (*x_start)[0][c] + (1. - rate(c)) * fixedPoint(c);
+    temp(Tags::CURRENT) = x;
+    changedEvaluatorPrimary("temperature", Tags::NEXT, *S);
+
+    bool done = spinup.Update(*S, t);
+    *x_start = temp();
+    return done;
+  }
+
+  // number of cycles to spin up, or -1 if not done in max_cycles
+  int run(ATS::CyclostationarySpinup& spinup, int max_cycles)
+  {
+    for (int i = 1; i <= max_cycles; ++i)
+      if (cycle(spinup, i)) return spinup.num_cycles();
+    return -1;
+  }
+
+  double maxError()
+  {
+    double error = 0.;
+    const auto& x = temp();
+    for (int c = 0; c != x.MyLength(); ++c)
+      error = std::max(error, std::abs(x[0][c] - fixedPoint(c)) / fixedPoint(c));
+    double global_error;
+    comm->MaxAll(&error, &global_error, 1);
+    return global_error;
+  }
+
+  Comm_ptr_type comm;
+  Teuchos::RCP<State> S;
+  Teuchos::ParameterList plist;
+  TimeStepManager tsm;
+  Teuchos::RCP<Epetra_MultiVector> x_start;
+};
+
+
+SUITE(ATS_CYCLOSTATIONARY_SPINUP)
+{
+  // Cycles are repeated until the change over a cycle is within tolerance.
+  TEST_FIXTURE(SpinupProblem, SPINUP_CONVERGED)
+  {
+    ATS::CyclostationarySpinup spinup(plist, 0., comm);
+    setup(spinup);
+    spinup.Initialize(*S, 0., 100., tsm);
+
+    // only the end of a cycle counts
+    CHECK(!spinup.Update(*S, 0.5));
+    CHECK_EQUAL(0, spinup.num_cycles());
+
+    int n_cycles = run(spinup, 100);
+    CHECK(n_cycles > 10);
+    CHECK(spinup.converged());
+    CHECK(!spinup.accelerated());
+    CHECK(maxError() < 1.e-5);
+  }
+
+
+  TEST_FIXTURE(SpinupProblem, SPINUP_MAXIMUM_CYCLES)
+  {
+    plist.set<int>("maximum cycles", 3);
+    ATS::CyclostationarySpinup spinup(plist, 0., comm);
+    setup(spinup);
+    spinup.Initialize(*S, 0., 100., tsm);
+
+    CHECK_EQUAL(3, run(spinup, 100));
+    CHECK(!spinup.converged());
+  }
+
+
+  // Extrapolation converges in far fewer cycles, and the accelerated key is
+  // reset at both NEXT and CURRENT.
+  TEST_FIXTURE(SpinupProblem, SPINUP_ACCELERATED)
+  {
+    SpinupProblem repeated;
+    ATS::CyclostationarySpinup spinup_repeated(repeated.plist, 0., comm);
+    repeated.setup(spinup_repeated);
+    spinup_repeated.Initialize(*repeated.S, 0., 100., repeated.tsm);
+    int n_cycles_repeated = repeated.run(spinup_repeated, 100);
+    CHECK(n_cycles_repeated > 0);
+
+    accelerate(2);
+    ATS::CyclostationarySpinup spinup(plist, 0., comm);
+    setup(spinup);
+    spinup.Initialize(*S, 0., 100., tsm);
+
+    CHECK(!cycle(spinup, 1.));
+    CHECK(spinup.accelerated());
+    for (int c = 0; c != temp().MyLength(); ++c)
+      CHECK_EQUAL(temp()[0][c], temp(Tags::CURRENT)[0][c]);
+
+    int n_cycles = run(spinup, 100);
+    CHECK(n_cycles > 0 && n_cycles < n_cycles_repeated / 2);
+    CHECK(spinup.converged());
+    CHECK(maxError() < 1.e-4);
+  }
+
+
+  // A spin-up restarted mid-cycle, from the State it checkpoints, continues
+  // that cycle as if it had not stopped.
+  TEST_FIXTURE(SpinupProblem, SPINUP_RESTART)
+  {
+    accelerate(2);
+
+    // the reference runs four cycles
+    SpinupProblem reference;
+    reference.plist = plist;
+    ATS::CyclostationarySpinup spinup_ref(reference.plist, 0., comm);
+    reference.setup(spinup_ref);
+    spinup_ref.Initialize(*reference.S, 0., -1., reference.tsm);
+    CHECK_EQUAL(-1, reference.run(spinup_ref, 4));
+
+    // this one stops after three, and restarts at t = 3.5
+    ATS::CyclostationarySpinup spinup(plist, 0., comm);
+    setup(spinup);
+    spinup.Initialize(*S, 0., -1., tsm);
+    CHECK_EQUAL(-1, run(spinup, 3));
+
+    temp().PutScalar(-1.);
+    TimeStepManager tsm_restart;
+    ATS::CyclostationarySpinup spinup_restart(plist, 0., comm);
+    spinup_restart.Initialize(*S, 3.5, -1., tsm_restart);
+    CHECK_EQUAL(3, spinup_restart.num_cycles());
+    CHECK_CLOSE(0.5, tsm_restart.TimeStep(3.5, 10.), 1.e-10);
+
+    CHECK(!spinup_restart.Update(*S, 3.75));
+    CHECK(!cycle(spinup_restart, 4.));
+    CHECK_EQUAL(4, spinup_restart.num_cycles());
+    CHECK(spinup_restart.accelerated());
+    for (int c = 0; c != temp().MyLength(); ++c)
+      CHECK_EQUAL(reference.temp()[0][c], temp()[0][c]);
+  }
+}
@@ -9,13 +9,16 @@
 
 #include <UnitTest++.h>
 
+#include <algorithm>
 #include <iostream>
 
 #include "Teuchos_ParameterXMLFileReader.hpp"
 #include "Teuchos_XMLParameterListHelpers.hpp"
 
 #include "AmanziComm.hh"
+#include "errors.hh"
 #include "ats_mesh_factory.hh"
+#include "setup_profiler.hh"
 
 using namespace Amanzi;
 
@@ -43,6 +46,71 @@ struct Runner {
 };
 
 
+// A replicated domain set of generated meshes of 1 x 1 x nz cells.
+Teuchos::ParameterList
+replicatedList(const std::string& indexing_parent, const std::string& index_by, int nz)
+{
+  Teuchos::ParameterList mesh_plist("replica:*");
+  mesh_plist.set<std::string>("mesh type", "domain set replicated");
+  auto& ds_list = mesh_plist.sublist("domain set replicated parameters");
+  ds_list.set<std::string>("indexing parent domain", indexing_parent);
+  ds_list.set<std::string>("index by", index_by);
+  ds_list.set<std::string>("referencing parent domain", indexing_parent);
+  auto& template_list = ds_list.sublist("template");
+  template_list.set<std::string>("mesh type", "generate mesh");
+  auto& gen_list = template_list.sublist("generate mesh parameters");
+  gen_list.set("number of cells", Teuchos::Array<int>({ 1, 1, nz }));
+  gen_list.set("domain low coordinate", Teuchos::Array<double>({ 0., 0., -1. * nz }));
+  gen_list.set("domain high coordinate", Teuchos::Array<double>({ 1., 1., 0. }));
+  return mesh_plist;
+}
+
+
+// Subdomains alias the template, and are named 0 to n_global - 1.  Imports
+// through the reference maps fill each parent cell in index_cells[i] with the
+// index of the i-th subdomain.
+void
+checkReplicated(State& S,
+                int n_global,
+                const std::vector<AmanziMesh::Entity_ID_List>& index_cells,
+                const std::string& parent)
+{
+  auto ds = S.GetDomainSet("replica");
+  auto template_mesh = S.GetMesh("replica_template");
+  auto parent_mesh = S.GetMesh(parent);
+  Epetra_MultiVector expected(parent_mesh->cell_map(false), 1);
+  Epetra_MultiVector imported(parent_mesh->cell_map(false), 1);
+
+  int n_local = 0;
+  int index_sum = 0;
+  for (const auto& subdomain : *ds) {
+    CHECK(S.GetMesh(subdomain) == template_mesh);
+    int index = Keys::getDomainSetIndex<int>(subdomain);
+    CHECK(index >= 0 && index < n_global);
+    index_sum += index;
+
+    Epetra_MultiVector vec_l(template_mesh->cell_map(false), 1);
+    vec_l.PutScalar((double)index);
+    ds->DoImport(subdomain, vec_l, imported);
+    for (const auto& c : index_cells[n_local]) expected[0][c] = index;
+    n_local++;
+  }
+  CHECK_EQUAL((int)index_cells.size(), n_local);
+
+  // every index is used once
+  int l_counts[2] = { n_local, index_sum };
+  int g_counts[2] = { 0, 0 };
+  S.GetMesh(parent)->get_comm()->SumAll(l_counts, g_counts, 2);
+  CHECK_EQUAL(n_global, g_counts[0]);
+  CHECK_EQUAL(n_global * (n_global - 1) / 2, g_counts[1]);
+
+  expected.Update(-1., imported, 1.);
+  double norm;
+  expected.NormInf(&norm);
+  CHECK_CLOSE(0., norm, 1.e-10);
+}
+
+
 SUITE(ATS_MESH_FACTORY)
 {
   TEST_FIXTURE(Runner, EXTRACT_SURFACE)
@@ -304,4 +372,211 @@ SUITE(ATS_MESH_FACTORY)
       CHECK_CLOSE(0., norm, 1.e-10);
     }
   }
+
+
+  // Batched maps from column meshes to the domain match the columns, and are
+  // those used by the domain set.
+  TEST_FIXTURE(Runner, MAPS_TO_PARENT)
+  {
+    setup("test/executable_mesh_construct_columns.xml");
+    go();
+
+    auto mesh = S->GetMesh("domain");
+    auto ds = S->GetDomainSet("column");
+    std::vector<std::string> names;
+    std::vector<Teuchos::RCP<const AmanziMesh::Mesh>> meshes;
+    for (const auto& subdomain : *ds) {
+      names.push_back(subdomain);
+      meshes.push_back(S->GetMesh(subdomain));
+    }
+    std::map<std::string, Teuchos::RCP<const std::vector<int>>> maps, parent_maps;
+    ATS::Mesh::createMapsToParent(names, meshes, mesh, maps);
+    ATS::Mesh::createMapsToParent(names, meshes, Teuchos::null, parent_maps);
+    CHECK_EQUAL(names.size(), maps.size());
+
+    const auto& ds_maps = ds->get_subdomain_maps();
+    for (int col = 0; col != names.size(); ++col) {
+      const auto& map = *maps[names[col]];
+      AmanziMesh::Entity_ID_List col_cells = mesh->cells_of_column(col);
+      std::vector<int> cells(map);
+      std::sort(cells.begin(), cells.end());
+      std::sort(col_cells.begin(), col_cells.end());
+      CHECK(std::equal(cells.begin(), cells.end(), col_cells.begin(), col_cells.end()));
+      CHECK(map == *parent_maps[names[col]]);
+      CHECK(map == *ds_maps.at(names[col]));
+    }
+  }
+
+
+  TEST_FIXTURE(Runner, REQUIRE_WHOLE_COLUMNS)
+  {
+    setup("test/executable_mesh_construct_columns.xml");
+    plist->sublist("mesh").sublist("domain").set<bool>("require whole columns", true);
+    go();
+
+    // every column is entirely owned by this rank, and every owned cell is in
+    // a column
+    auto mesh = S->GetMesh("domain");
+    int ncells_owned =
+      mesh->num_entities(AmanziMesh::Entity_kind::CELL, AmanziMesh::Parallel_type::OWNED);
+    int ncells_in_cols = 0;
+    for (int col = 0; col != mesh->num_columns(false); ++col) {
+      for (const auto& c : mesh->cells_of_column(col)) {
+        CHECK(c < ncells_owned);
+        ncells_in_cols++;
+      }
+    }
+    CHECK_EQUAL(ncells_owned, ncells_in_cols);
+  }
+
+
+  // Column locality is only checked, and reported at high verbosity, when
+  // columns are built, which generated meshes do not do by default.
+  TEST_FIXTURE(Runner, GENERATED_WITHOUT_COLUMNS)
+  {
+    auto generated = [&](bool require) {
+      setup("test/executable_mesh_extract_surface.xml");
+      auto& meshes = plist->sublist("mesh");
+      meshes.remove("surface");
+      meshes.remove("domain");
+      auto& domain = meshes.sublist("domain");
+      domain.set<std::string>("mesh type", "generate mesh");
+      auto& gen_list = domain.sublist("generate mesh parameters");
+      gen_list.set("number of cells", Teuchos::Array<int>({ 2 * comm->NumProc(), 2, 3 }));
+      gen_list.set("domain low coordinate", Teuchos::Array<double>({ 0., 0., -3. }));
+      gen_list.set("domain high coordinate", Teuchos::Array<double>({ 2., 2., 0. }));
+      if (require) {
+        domain.set<bool>("require whole columns", true);
+        domain.set<bool>("build columns", false);
+      }
+      go();
+    };
+
+    generated(false);
+    CHECK(S->HasMesh("domain"));
+    CHECK_THROW(generated(true), Errors::Message);
+  }
+
+
+  // One subdomain per column, mapped onto the columns of the parent, with
+  // evaluator lists overridden for one subdomain.
+  TEST_FIXTURE(Runner, REPLICATED_BY_COLUMN)
+  {
+    setup("test/executable_mesh_construct_columns.xml");
+    plist->sublist("mesh").sublist("domain").set<bool>("require whole columns", true);
+    go();
+
+    auto mesh = S->GetMesh("domain");
+    int ncols = mesh->num_columns(false);
+    std::vector<AmanziMesh::Entity_ID_List> index_cells;
+    for (int col = 0; col != ncols; ++col) index_cells.push_back(mesh->cells_of_column(col));
+    int l_nz = ncols > 0 ? index_cells[0].size() : 0;
+    int nz = 0, ncols_global = 0;
+    comm->MaxAll(&l_nz, &nz, 1);
+    comm->SumAll(&ncols, &ncols_global, 1);
+
+    auto& evals = S->FEList();
+    evals.sublist("replica:*-base_porosity")
+      .set<std::string>("evaluator type", "independent variable constant")
+      .set<double>("value", 0.25);
+    auto mesh_plist = replicatedList("domain", "column", nz);
+    mesh_plist.sublist("domain set replicated parameters")
+      .sublist("subdomain evaluator overrides")
+      .sublist("0")
+      .sublist("base_porosity")
+      .set<double>("value", 0.35);
+
+    VerboseObject vo(comm, "Replicated", *plist);
+    ATS::Mesh::createDomainSetReplicated("replica:*", mesh_plist, gm, *S, vo);
+    checkReplicated(*S, ncols_global, index_cells, "domain");
+
+    // only subdomain 0 has its own list, which is overridden
+    CHECK(!evals.isSublist("replica:1-base_porosity"));
+    if (S->HasMesh("replica:0")) {
+      CHECK_EQUAL(0.35, evals.sublist("replica:0-base_porosity").get<double>("value"));
+      CHECK_EQUAL("independent variable constant",
+                  evals.sublist("replica:0-base_porosity").get<std::string>("evaluator type"));
+    }
+    CHECK_EQUAL(0.25, evals.sublist("replica:*-base_porosity").get<double>("value"));
+
+    // overrides must override something, which is checked by the owner of
+    // the subdomain
+    mesh_plist = replicatedList("domain", "column", nz);
+    mesh_plist.sublist("domain set replicated parameters")
+      .sublist("subdomain evaluator overrides")
+      .sublist("0")
+      .sublist("permeability");
+    bool threw = false;
+    try {
+      ATS::Mesh::createDomainSetReplicated("other:*", mesh_plist, gm, *S, vo);
+    } catch (const Errors::Message& e) {
+      threw = true;
+    }
+    CHECK_EQUAL(S->HasMesh("other:0"), threw);
+  }
+
+
+  // Indexing by cell, a cheap parent of one cell per subdomain suffices.
+  TEST_FIXTURE(Runner, REPLICATED_BY_CELL)
+  {
+    setup("test/executable_mesh_construct_columns.xml");
+    Teuchos::ParameterList parent_list("index");
+    parent_list.set<std::string>("mesh type", "generate mesh");
+    auto& gen_list = parent_list.sublist("generate mesh parameters");
+    gen_list.set("number of cells", Teuchos::Array<int>({ 8, 1, 1 }));
+    gen_list.set("domain low coordinate", Teuchos::Array<double>({ 0., 0., 0. }));
+    gen_list.set("domain high coordinate", Teuchos::Array<double>({ 8., 1., 1. }));
+    VerboseObject vo(comm, "Replicated", *plist);
+    ATS::Mesh::createMesh(parent_list, comm, gm, *S, vo);
+
+    auto mesh = S->GetMesh("index");
+    int ncells = mesh->num_entities(AmanziMesh::CELL, AmanziMesh::Parallel_type::OWNED);
+    std::vector<AmanziMesh::Entity_ID_List> index_cells;
+    for (int c = 0; c != ncells; ++c) index_cells.emplace_back(1, c);
+
+    auto mesh_plist = replicatedList("index", "cell", 1);
+    ATS::Mesh::createDomainSetReplicated("replica:*", mesh_plist, gm, *S, vo);
+    checkReplicated(*S, 8, index_cells, "index");
+
+    // subdomains are named by the global ID of their cell
+    for (int c = 0; c != ncells; ++c)
+      CHECK(S->HasMesh(Keys::getDomainInSet("replica", mesh->cell_map(false).GID(c))));
+
+    // a referencing parent indexed by cell requires a template of one cell
+    auto bad_list = replicatedList("index", "cell", 2);
+    CHECK_THROW(ATS::Mesh::createDomainSetReplicated("bad:*", bad_list, gm, *S, vo),
+                Errors::Message);
+  }
+
+
+  TEST_FIXTURE(Runner, SETUP_PROFILER)
+  {
+    setup("test/executable_mesh_construct_columns.xml");
+    ATS::SetupProfiler::clear();
+    {
+      ATS::SetupProfiler::Phase phase("create meshes");
+      go();
+    }
+
+    // one top-level phase, with one nested phase per top-level mesh
+    const auto& records = ATS::SetupProfiler::records();
+    CHECK(records.size() > 1);
+    CHECK_EQUAL("create meshes", records[0].name);
+    CHECK_EQUAL(-1, records[0].parent);
+    CHECK_EQUAL(1, records[0].count);
+    CHECK_EQUAL("mesh \"domain\"", records[1].name);
+    CHECK_EQUAL(0, records[1].parent);
+    CHECK_EQUAL(1, records[1].depth);
+
+    double nested_time = 0.;
+    for (int i = 1; i != records.size(); ++i) {
+      CHECK_EQUAL(0, records[i].parent);
+      nested_time += records[i].time;
+    }
+    CHECK(nested_time <= records[0].time);
+
+    VerboseObject vo(comm, "SetupProfiler", *plist);
+    ATS::SetupProfiler::report(comm, vo, Teuchos::VERB_NONE);
+    ATS::SetupProfiler::clear();
+  }
 }
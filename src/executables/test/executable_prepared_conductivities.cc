@@ -0,0 +1,210 @@
+/*
+  Copyright 2010-202x held jointly by participating institutions.
+  ATS is released under the three-clause BSD License.
+  The terms of use and "as is" disclaimer for this license are
+  provided in the top-level COPYRIGHT file.
+
+  Authors:
+*/
+
+// Checks that the three-phase thermal conductivity and overland conductivity
+// evaluators, which keep factors prepared from porosity and from slope and
+// Manning coefficient, recompute them when those dependencies change.
+
+#include <UnitTest++.h>
+
+#include <cmath>
+
+#include "AmanziComm.hh"
+#include "GeometricModel.hh"
+#include "MeshFactory.hh"
+#include "State.hh"
+#include "pk_helpers.hh"
+#include "thermal_conductivity_threephase_peterslidard.hh"
+#include "manning_conductivity_model.hh"
+
+using namespace Amanzi;
+
+namespace {
+
+Teuchos::ParameterList
+getPetersLidardList()
+{
+  Teuchos::ParameterList plist("soil");
+  plist.set<std::string>("region", "computational domain");
+  plist.set<std::string>("thermal conductivity type", "three-phase Peters-Lidard");
+  plist.set<double>("unsaturated alpha unfrozen [-]", 0.92);
+  plist.set<double>("unsaturated alpha frozen [-]", 0.27);
+  plist.set<double>("thermal conductivity of soil [W m^-1 K^-1]", 1.0);
+  plist.set<double>("thermal conductivity of ice [W m^-1 K^-1]", 2.2);
+  plist.set<double>("thermal conductivity of liquid [W m^-1 K^-1]", 0.6);
+  plist.set<double>("thermal conductivity of gas [W m^-1 K^-1]", 0.024);
+  return plist;
+}
+
+
+Teuchos::ParameterList
+getManningList()
+{
+  Teuchos::ParameterList plist("overland conductivity model");
+  plist.set<double>("Manning exponent", 2. / 3.);
+  return plist;
+}
+
+} // namespace
+
+
+struct PreparedConductivityProblem {
+  PreparedConductivityProblem()
+  {
+    auto comm = getDefaultComm();
+    Teuchos::ParameterList regions("regions");
+    regions.sublist("computational domain").sublist("region: all");
+    auto gm = Teuchos::rcp(new AmanziGeometry::GeometricModel(3, regions, *comm));
+    AmanziMesh::MeshFactory factory(comm, gm);
+    auto mesh = factory.create(0., 0., 0., 1., 1., 1., 4 * comm->NumProc(), 1, 1);
+
+    Teuchos::ParameterList state_list("state");
+    S = Teuchos::rcp(new State(state_list));
+    S->RegisterMesh("domain", mesh, false);
+
+    auto& tc_list = S->GetEvaluatorList("thermal_conductivity");
+    tc_list.set<std::string>("evaluator type", "three-phase thermal conductivity");
+    tc_list.sublist("thermal conductivity parameters").set("soil", getPetersLidardList());
+
+    auto& cond_list = S->GetEvaluatorList("overland_conductivity");
+    cond_list.set<std::string>("evaluator type", "overland conductivity");
+    cond_list.set<bool>("include density", false);
+    cond_list.set("overland conductivity model", getManningList());
+
+    S->require_time(Tags::NEXT);
+    for (const auto& key : primaries) {
+      S->Require<CompositeVector, CompositeVectorSpace>(key, Tags::NEXT, key)
+        .SetMesh(mesh)
+        ->SetGhosted()
+        ->AddComponent("cell", AmanziMesh::CELL, 1);
+      requireEvaluatorPrimary(key, Tags::NEXT, *S);
+    }
+    for (const auto& key : { "thermal_conductivity", "overland_conductivity" }) {
+      S->Require<CompositeVector, CompositeVectorSpace>(key, Tags::NEXT)
+        .SetMesh(mesh)
+        ->AddComponent("cell", AmanziMesh::CELL, 1);
+      S->RequireEvaluator(key, Tags::NEXT);
+    }
+    S->Setup();
+
+    S->set_time(Tags::NEXT, 0.);
+    set("porosity", 0.3);
+    set("temperature", 272.);
+    set("saturation_liquid", 0.4);
+    set("saturation_ice", 0.5);
+    set("ponded_depth", 0.01);
+    set("slope_magnitude", 0.02);
+    set("manning_coefficient", 0.5);
+    S->InitializeEvaluators();
+  }
+
+  Epetra_MultiVector& primary(const Key& key)
+  {
+    return *S->GetW<CompositeVector>(key, Tags::NEXT, key).ViewComponent("cell", false);
+  }
+
+  void set(const Key& key, double value)
+  {
+    primary(key).PutScalar(value);
+    S->GetRecordW(key, Tags::NEXT, key).set_initialized();
+    changedEvaluatorPrimary(key, Tags::NEXT, *S);
+  }
+
+  const Epetra_MultiVector& evaluate(const Key& key)
+  {
+    S->GetEvaluator(key, Tags::NEXT).Update(*S, "test");
+    return *S->Get<CompositeVector>(key, Tags::NEXT).ViewComponent("cell", false);
+  }
+
+  // thermal conductivity of each cell, in MW m^-1 K^-1, from the model
+  void checkThermalConductivity()
+  {
+    auto plist = getPetersLidardList();
+    Energy::ThermalConductivityThreePhasePetersLidard model(plist);
+    const auto& tc = evaluate("thermal_conductivity");
+    const auto& poro = primary("porosity");
+    const auto& temp = primary("temperature");
+    const auto& sl = primary("saturation_liquid");
+    const auto& si = primary("saturation_ice");
+    for (int c = 0; c != tc.MyLength(); ++c) {
+      double expected =
+        1.e-6 * model.ThermalConductivity(poro[0][c], sl[0][c], si[0][c], temp[0][c]);
+      CHECK_CLOSE(expected, tc[0][c], 1.e-12 * std::abs(expected));
+    }
+  }
+
+  void checkOverlandConductivity()
+  {
+    auto plist = getManningList();
+    Flow::ManningConductivityModel model(plist);
+    const auto& cond = evaluate("overland_conductivity");
+    const auto& depth = primary("ponded_depth");
+    const auto& slope = primary("slope_magnitude");
+    const auto& coef = primary("manning_coefficient");
+    for (int c = 0; c != cond.MyLength(); ++c) {
+      double expected = model.Conductivity(depth[0][c], slope[0][c], coef[0][c]);
+      CHECK_CLOSE(expected, cond[0][c], 1.e-12 * std::abs(expected));
+    }
+  }
+
+  std::vector<Key> primaries = { "porosity",       "temperature",  "saturation_liquid",
+                                 "saturation_ice", "ponded_depth", "slope_magnitude",
+                                 "manning_coefficient" };
+  Teuchos::RCP<State> S;
+};
+
+
+SUITE(ATS_PREPARED_CONDUCTIVITIES)
+{
+  // Factors prepared from porosity are recomputed in the cells where porosity
+  // changed.
+  TEST_FIXTURE(PreparedConductivityProblem, THERMAL_CONDUCTIVITY_POROSITY_CHANGED)
+  {
+    checkThermalConductivity();
+    double tc0 = evaluate("thermal_conductivity")[0][0];
+
+    primary("porosity")[0][0] = 0.5;
+    changedEvaluatorPrimary("porosity", Tags::NEXT, *S);
+    checkThermalConductivity();
+    CHECK(evaluate("thermal_conductivity")[0][0] != tc0);
+
+    // changes to other dependencies reuse the factors
+    set("saturation_liquid", 0.2);
+    checkThermalConductivity();
+
+    // and restoring the porosity restores the conductivity
+    primary("porosity")[0][0] = 0.3;
+    changedEvaluatorPrimary("porosity", Tags::NEXT, *S);
+    set("saturation_liquid", 0.4);
+    CHECK_CLOSE(tc0, evaluate("thermal_conductivity")[0][0], 1.e-12 * tc0);
+  }
+
+
+  // The Manning scaling is recomputed when either the slope or the
+  // coefficient changes.
+  TEST_FIXTURE(PreparedConductivityProblem, OVERLAND_CONDUCTIVITY_SCALING_CHANGED)
+  {
+    checkOverlandConductivity();
+    double cond0 = evaluate("overland_conductivity")[0][0];
+
+    primary("slope_magnitude")[0][0] = 0.1;
+    changedEvaluatorPrimary("slope_magnitude", Tags::NEXT, *S);
+    checkOverlandConductivity();
+    CHECK(evaluate("overland_conductivity")[0][0] != cond0);
+
+    int last = primary("manning_coefficient").MyLength() - 1;
+    primary("manning_coefficient")[0][last] = 0.05;
+    changedEvaluatorPrimary("manning_coefficient", Tags::NEXT, *S);
+    checkOverlandConductivity();
+
+    // changes to depth reuse the scaling
+    set("ponded_depth", 0.1);
+    checkOverlandConductivity();
+  }
+}
@@ -0,0 +1,96 @@
+/*
+  Copyright 2010-202x held jointly by participating institutions.
+  ATS is released under the three-clause BSD License.
+  The terms of use and "as is" disclaimer for this license are
+  provided in the top-level COPYRIGHT file.
+
+  Authors:
+*/
+
+// Checks that a StateSnapshot restores the data, time, and cycle of State,
+// and marks primary variables as changed.
+
+#include <UnitTest++.h>
+
+#include "AmanziComm.hh"
+#include "GeometricModel.hh"
+#include "MeshFactory.hh"
+#include "State.hh"
+#include "pk_helpers.hh"
+#include "state_snapshot.hh"
+
+using namespace Amanzi;
+
+struct SnapshotProblem {
+  SnapshotProblem()
+  {
+    auto comm = getDefaultComm();
+    auto gm = Teuchos::rcp(new AmanziGeometry::GeometricModel(3));
+    AmanziMesh::MeshFactory factory(comm, gm);
+    auto mesh = factory.create(0., 0., 0., 1., 1., 1., 4 * comm->NumProc(), 1, 1);
+
+    Teuchos::ParameterList state_list("state");
+    S = Teuchos::rcp(new State(state_list));
+    S->RegisterMesh("domain", mesh, false);
+    S->require_time(Tags::NEXT);
+    S->Require<CompositeVector, CompositeVectorSpace>("temperature", Tags::NEXT, "temperature")
+      .SetMesh(mesh)
+      ->SetGhosted()
+      ->AddComponent("cell", AmanziMesh::CELL, 2);
+    requireEvaluatorPrimary("temperature", Tags::NEXT, *S);
+    S->Require<double>("scalar", Tags::DEFAULT, "scalar");
+    S->Setup();
+
+    S->set_time(Tags::CURRENT, 10.);
+    S->set_time(Tags::NEXT, 10.);
+    S->set_cycle(3);
+    temp().PutScalar(270.);
+    S->Assign<double>("scalar", Tags::DEFAULT, "scalar", 1.);
+  }
+
+  Epetra_MultiVector& temp()
+  {
+    return *S->GetW<CompositeVector>("temperature", Tags::NEXT, "temperature")
+              .ViewComponent("cell", false);
+  }
+
+  Teuchos::RCP<State> S;
+};
+
+
+SUITE(ATS_STATE_SNAPSHOT)
+{
+  TEST_FIXTURE(SnapshotProblem, SNAPSHOT_RESTORE)
+  {
+    ATS::StateSnapshot snapshot(*S);
+    CHECK_EQUAL(2 * temp().MyLength() + 1, snapshot.size());
+
+    // the evaluator has seen the data
+    auto& eval = S->GetEvaluator("temperature", Tags::NEXT);
+    eval.Update(*S, "test");
+    CHECK(!eval.Update(*S, "test"));
+
+    // run a while
+    S->set_time(Tags::CURRENT, 20.);
+    S->set_time(Tags::NEXT, 25.);
+    S->set_cycle(8);
+    temp()[1][0] = 300.;
+    S->Assign<double>("scalar", Tags::DEFAULT, "scalar", 2.);
+
+    snapshot.Restore(*S);
+    CHECK_EQUAL(10., S->get_time(Tags::CURRENT));
+    CHECK_EQUAL(10., S->get_time(Tags::NEXT));
+    CHECK_EQUAL(3, S->get_cycle());
+    CHECK_EQUAL(1., S->Get<double>("scalar", Tags::DEFAULT));
+    for (int i = 0; i != temp().MyLength(); ++i) {
+      CHECK_EQUAL(270., temp()[0][i]);
+      CHECK_EQUAL(270., temp()[1][i]);
+    }
+    CHECK(eval.Update(*S, "test"));
+
+    // the snapshot is a copy, and may be restored again
+    temp().PutScalar(0.);
+    snapshot.Restore(*S);
+    CHECK_EQUAL(270., temp()[1][0]);
+  }
+}
@@ -0,0 +1,187 @@
+/*
+  Copyright 2010-202x held jointly by participating institutions.
+  ATS is released under the three-clause BSD License.
+  The terms of use and "as is" disclaimer for this license are
+  provided in the top-level COPYRIGHT file.
+
+  Authors:
+*/
+
+/* -------------------------------------------------------------------------
+ATS
+
+Jacobian-free Newton-Krylov wrapper of a BDF PK: right-preconditioned,
+flexible GMRES on finite differences of the PK's residual.
+------------------------------------------------------------------------- */
+
+#include <cmath>
+
+#include "errors.hh"
+#include "bdf_fn_jfnk.hh"
+
+namespace Amanzi {
+
+BDFFnJFNK::BDFFnJFNK(Teuchos::ParameterList& plist, BDFFnBase<TreeVector>& fn)
+  : BDFFnWrapper(fn), t_old_(0.), t_new_(0.), f0_current_(false)
+{
+  tol_ = plist.get<double>("linear tolerance", 1.e-3);
+  max_itrs_ = plist.get<int>("maximum linear iterations", 20);
+  fd_eps_ = plist.get<double>("finite difference epsilon", 1.e-7);
+  if (max_itrs_ < 1) {
+    Errors::Message msg(
+      "Jacobian-free Newton-Krylov: \"maximum linear iterations\" must be >= 1.");
+    Exceptions::amanzi_throw(msg);
+  }
+  vo_ = Teuchos::rcp(new VerboseObject("JFNK", plist));
+}
+
+
+void
+BDFFnJFNK::FunctionalResidual(double t_old,
+                              double t_new,
+                              Teuchos::RCP<TreeVector> u_old,
+                              Teuchos::RCP<TreeVector> u_new,
+                              Teuchos::RCP<TreeVector> f)
+{
+  fn_.FunctionalResidual(t_old, t_new, u_old, u_new, f);
+
+  t_old_ = t_old;
+  t_new_ = t_new;
+  u_old_ = u_old;
+  u_new_ = u_new;
+  if (f0_ == Teuchos::null) f0_ = Teuchos::rcp(new TreeVector(*f, INIT_MODE_ZERO));
+  *f0_ = *f;
+  f0_current_ = true;
+}
+
+
+void
+BDFFnJFNK::ChangedSolution()
+{
+  f0_current_ = false;
+  fn_.ChangedSolution();
+}
+
+
+void
+BDFFnJFNK::ApplyJacobian_(const TreeVector& v, TreeVector& Jv)
+{
+  double norm_u0, norm_v;
+  u0_->Norm2(&norm_u0);
+  v.Norm2(&norm_v);
+  if (norm_v == 0.) {
+    Jv.PutScalar(0.);
+    return;
+  }
+  double eps = fd_eps_ * (1. + norm_u0) / norm_v;
+
+  // perturb the solution in place, as the PK's residual works on State
+  *u_new_ = *u0_;
+  u_new_->Update(eps, v, 1.);
+  fn_.ChangedSolution();
+  fn_.FunctionalResidual(t_old_, t_new_, u_old_, u_new_, f1_);
+
+  Jv.Update(1. / eps, *f1_, -1. / eps, *f0_, 0.);
+}
+
+
+int
+BDFFnJFNK::ApplyPreconditioner(Teuchos::RCP<const TreeVector> u, Teuchos::RCP<TreeVector> Pu)
+{
+  if (u_new_ == Teuchos::null) {
+    // no residual to difference about yet
+    return fn_.ApplyPreconditioner(u, Pu);
+  }
+
+  // the Jacobian is differenced about u_new_, so F(u_new_) must be current
+  if (!f0_current_) {
+    fn_.FunctionalResidual(t_old_, t_new_, u_old_, u_new_, f0_);
+    f0_current_ = true;
+  }
+
+  Teuchos::OSTab tab = vo_->getOSTab();
+  if (u0_ == Teuchos::null) {
+    u0_ = Teuchos::rcp(new TreeVector(*u_new_, INIT_MODE_ZERO));
+    f1_ = Teuchos::rcp(new TreeVector(*f0_, INIT_MODE_ZERO));
+  }
+  while ((int)V_.size() < max_itrs_ + 1) {
+    V_.emplace_back(Teuchos::rcp(new TreeVector(*u, INIT_MODE_ZERO)));
+  }
+  while ((int)Z_.size() < max_itrs_) {
+    Z_.emplace_back(Teuchos::rcp(new TreeVector(*u, INIT_MODE_ZERO)));
+  }
+  *u0_ = *u_new_;
+
+  // Flexible GMRES with a zero initial guess: the preconditioner may be an
+  // inexact (iterative) inverse, so the preconditioned basis Z is kept.
+  Pu->PutScalar(0.);
+  double beta;
+  u->Norm2(&beta);
+  if (beta == 0.) return 0;
+
+  Teuchos::SerialDenseMatrix<int, double> H(max_itrs_ + 1, max_itrs_);
+  std::vector<double> cs(max_itrs_), sn(max_itrs_), g(max_itrs_ + 1, 0.);
+  g[0] = beta;
+  V_[0]->Update(1. / beta, *u, 0.);
+
+  int ierr = 0;
+  int k = 0;
+  double resid = beta;
+  for (int j = 0; j != max_itrs_; ++j) {
+    ierr += fn_.ApplyPreconditioner(V_[j], Z_[j]);
+    ApplyJacobian_(*Z_[j], *V_[j + 1]);
+
+    // modified Gram-Schmidt
+    for (int i = 0; i <= j; ++i) {
+      V_[j + 1]->Dot(*V_[i], &H(i, j));
+      V_[j + 1]->Update(-H(i, j), *V_[i], 1.);
+    }
+    V_[j + 1]->Norm2(&H(j + 1, j));
+
+    // Givens rotations reduce H to upper triangular
+    for (int i = 0; i < j; ++i) {
+      double tmp = cs[i] * H(i, j) + sn[i] * H(i + 1, j);
+      H(i + 1, j) = -sn[i] * H(i, j) + cs[i] * H(i + 1, j);
+      H(i, j) = tmp;
+    }
+    double denom = std::sqrt(H(j, j) * H(j, j) + H(j + 1, j) * H(j + 1, j));
+    k = j + 1;
+    if (denom == 0.) {
+      k = j; // J Z_j is in the span of V, nothing more to gain
+      break;
+    }
+    double h_next = H(j + 1, j);
+    cs[j] = H(j, j) / denom;
+    sn[j] = h_next / denom;
+    H(j, j) = denom;
+    H(j + 1, j) = 0.;
+    g[j + 1] = -sn[j] * g[j];
+    g[j] = cs[j] * g[j];
+    resid = std::abs(g[j + 1]);
+
+    if (resid <= tol_ * beta || h_next == 0.) break;
+    V_[j + 1]->Scale(1. / h_next);
+  }
+
+  // back substitution for the coefficients of Z
+  std::vector<double> y(k);
+  for (int i = k - 1; i >= 0; --i) {
+    y[i] = g[i];
+    for (int l = i + 1; l < k; ++l) y[i] -= H(i, l) * y[l];
+    y[i] /= H(i, i);
+  }
+  for (int i = 0; i != k; ++i) Pu->Update(y[i], *Z_[i], 1.);
+
+  // restore the solution and everything in State that depends upon it
+  *u_new_ = *u0_;
+  fn_.ChangedSolution();
+  fn_.FunctionalResidual(t_old_, t_new_, u_old_, u_new_, f1_);
+
+  if (vo_->os_OK(Teuchos::VERB_HIGH)) {
+    *vo_->os() << "GMRES: " << k << " iterations, relative residual " << resid / beta
+               << std::endl;
+  }
+  return ierr;
+}
+
+} // namespace Amanzi
@@ -0,0 +1,118 @@
+/*
+  Copyright 2010-202x held jointly by participating institutions.
+  ATS is released under the three-clause BSD License.
+  The terms of use and "as is" disclaimer for this license are
+  provided in the top-level COPYRIGHT file.
+
+  Authors:
+*/
+
+//! Jacobian-free Newton-Krylov wrapper of a BDF PK.
+/*!
+
+Coupled MPCs assemble approximate off-diagonal blocks of the Jacobian in their
+preconditioner, which is expensive to set up and still misses terms.  In
+Jacobian-free Newton-Krylov (JFNK) mode, the correction of each nonlinear
+iteration is instead computed by a (flexible) GMRES solve of the true Jacobian
+system, :math:`J \delta u = r`, where the action of the Jacobian is
+approximated by a finite difference of the PK's residual:
+
+.. math::
+    J v \approx \frac{F(u + \epsilon v) - F(u)}{\epsilon}, \quad
+    \epsilon = \epsilon_0 \frac{1 + \|u\|}{\|v\|}
+
+The PK's own preconditioner is applied as a right preconditioner.  For a
+StrongMPC this is the block-diagonal preconditioner of its sub-PKs, so the
+off-diagonal blocks of the coupled MPCs (e.g. `"preconditioner type`" of
+`"block diagonal`") need not be assembled at all.
+
+Residual evaluations at perturbed states are made in place on the solution
+vector, which is restored (along with all evaluated quantities in State) after
+each linear solve.  The Jacobian is approximated about the current iterate,
+so the nonlinear solver must report changes to the iterate through
+ChangedSolution(), as Amanzi's nonlinear solvers do; if the residual has not
+been evaluated since, it is evaluated again before the solve.  Each linear
+iteration costs one residual evaluation and one preconditioner application,
+plus one residual evaluation per solve.
+
+This mode is enabled by providing the `"Jacobian-free Newton-Krylov`" sublist
+in a PK that owns its own time integrator.
+
+.. _jfnk-spec:
+.. admonition:: jfnk-spec
+
+    * `"linear tolerance`" ``[double]`` **1.e-3** Relative reduction of the
+      linear residual at which GMRES stops.  Since the nonlinear solver
+      iterates, this need not be tight.
+
+    * `"maximum linear iterations`" ``[int]`` **20** Maximum number of GMRES
+      iterations (there are no restarts).
+
+    * `"finite difference epsilon`" ``[double]`` **1.e-7** Base
+      :math:`\epsilon_0` of the finite difference.
+
+    * `"verbose object`" ``[verbose-object-spec]`` **optional** See `Verbose Object`_.
+
+*/
+
+#pragma once
+
+#include <vector>
+
+#include "Teuchos_ParameterList.hpp"
+#include "Teuchos_SerialDenseMatrix.hpp"
+
+#include "VerboseObject.hh"
+#include "bdf_fn_wrapper.hh"
+
+namespace Amanzi {
+
+class BDFFnJFNK : public BDFFnWrapper {
+ public:
+  // fn is the PK whose residual and preconditioner are used.
+  BDFFnJFNK(Teuchos::ParameterList& plist, BDFFnBase<TreeVector>& fn);
+
+  // Residuals are forwarded to fn, and the last one is kept as F(u).  All
+  // else but the preconditioner is forwarded to fn as well.
+  virtual void FunctionalResidual(double t_old,
+                                  double t_new,
+                                  Teuchos::RCP<TreeVector> u_old,
+                                  Teuchos::RCP<TreeVector> u_new,
+                                  Teuchos::RCP<TreeVector> f) override;
+
+  // Approximately solves J Pu = u by GMRES, preconditioned by fn.  If
+  // ChangedSolution() was called since the last FunctionalResidual(), the
+  // residual is first evaluated at the current iterate.
+  virtual int
+  ApplyPreconditioner(Teuchos::RCP<const TreeVector> u, Teuchos::RCP<TreeVector> Pu) override;
+
+  // Marks the last residual as out of date, and forwards to fn.
+  virtual void ChangedSolution() override;
+
+ protected:
+  // Computes Jv = J v by finite differences about u_new_.
+  void ApplyJacobian_(const TreeVector& v, TreeVector& Jv);
+
+ protected:
+  Teuchos::RCP<VerboseObject> vo_;
+
+  double tol_;
+  int max_itrs_;
+  double fd_eps_;
+
+  // arguments and result of the last residual evaluation, about which the
+  // Jacobian is approximated
+  double t_old_, t_new_;
+  Teuchos::RCP<TreeVector> u_old_;
+  Teuchos::RCP<TreeVector> u_new_;
+  Teuchos::RCP<TreeVector> f0_;
+  bool f0_current_; // u_new_ has not changed since f0_ was evaluated
+
+  // workspace
+  Teuchos::RCP<TreeVector> u0_;
+  Teuchos::RCP<TreeVector> f1_;
+  std::vector<Teuchos::RCP<TreeVector>> V_; // Krylov basis
+  std::vector<Teuchos::RCP<TreeVector>> Z_; // preconditioned basis
+};
+
+} // namespace Amanzi
@@ -0,0 +1,109 @@
+/*
+  Copyright 2010-202x held jointly by participating institutions.
+  ATS is released under the three-clause BSD License.
+  The terms of use and "as is" disclaimer for this license are
+  provided in the top-level COPYRIGHT file.
+
+  Authors:
+*/
+
+/* -------------------------------------------------------------------------
+ATS
+
+Policy for reusing a BDF PK's preconditioner instead of rebuilding it on every
+update.
+------------------------------------------------------------------------- */
+
+#include <cmath>
+
+#include "bdf_fn_precon_reuse.hh"
+
+namespace Amanzi {
+
+BDFFnPreconditionerReuse::BDFFnPreconditionerReuse(Teuchos::ParameterList& plist,
+                                                   BDFFnBase<TreeVector>& fn)
+  : BDFFnWrapper(fn),
+    built_(false),
+    t_built_(0.),
+    h_built_(0.),
+    n_reused_(0),
+    t_solve_(-1.),
+    last_norm_(-1.),
+    slow_(false),
+    num_rebuilds_(0),
+    num_reuses_(0)
+{
+  max_reuse_ = plist.get<int>("maximum reuse count", 5);
+  dt_tol_ = plist.get<double>("time step size tolerance", 0.1);
+  max_ratio_ = plist.get<double>("maximum error ratio", 0.5);
+  vo_ = Teuchos::rcp(new VerboseObject("PC reuse", plist));
+}
+
+
+void
+BDFFnPreconditionerReuse::FunctionalResidual(double t_old,
+                                             double t_new,
+                                             Teuchos::RCP<TreeVector> u_old,
+                                             Teuchos::RCP<TreeVector> u_new,
+                                             Teuchos::RCP<TreeVector> f)
+{
+  if (t_new != t_solve_) {
+    // a new nonlinear solve
+    t_solve_ = t_new;
+    last_norm_ = -1.;
+  }
+  fn_.FunctionalResidual(t_old, t_new, u_old, u_new, f);
+}
+
+
+double
+BDFFnPreconditionerReuse::ErrorNorm(Teuchos::RCP<const TreeVector> u,
+                                    Teuchos::RCP<const TreeVector> du)
+{
+  double norm = fn_.ErrorNorm(u, du);
+  if (last_norm_ > 0. && norm > max_ratio_ * last_norm_) slow_ = true;
+  last_norm_ = norm;
+  return norm;
+}
+
+
+void
+BDFFnPreconditionerReuse::UpdatePreconditioner(double t,
+                                               Teuchos::RCP<const TreeVector> up,
+                                               double h)
+{
+  Teuchos::OSTab tab = vo_->getOSTab();
+
+  std::string reason;
+  if (!built_) {
+    reason = "first use";
+  } else if (n_reused_ >= max_reuse_) {
+    reason = "reuse count";
+  } else if (std::abs(h - h_built_) > dt_tol_ * h_built_) {
+    reason = "time step size";
+  } else if (t < t_built_) {
+    reason = "step retried";
+  } else if (slow_) {
+    reason = "slow convergence";
+  }
+
+  if (reason.empty()) {
+    n_reused_++;
+    num_reuses_++;
+    if (vo_->os_OK(Teuchos::VERB_HIGH))
+      *vo_->os() << "reusing preconditioner (" << n_reused_ << " in a row)" << std::endl;
+    return;
+  }
+
+  if (vo_->os_OK(Teuchos::VERB_HIGH))
+    *vo_->os() << "rebuilding preconditioner: " << reason << std::endl;
+  fn_.UpdatePreconditioner(t, up, h);
+  built_ = true;
+  t_built_ = t;
+  h_built_ = h;
+  n_reused_ = 0;
+  slow_ = false;
+  num_rebuilds_++;
+}
+
+} // namespace Amanzi
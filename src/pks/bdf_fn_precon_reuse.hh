@@ -0,0 +1,103 @@
+/*
+  Copyright 2010-202x held jointly by participating institutions.
+  ATS is released under the three-clause BSD License.
+  The terms of use and "as is" disclaimer for this license are
+  provided in the top-level COPYRIGHT file.
+
+  Authors:
+*/
+
+//! Reuses a BDF PK's preconditioner across nonlinear iterations and time steps.
+/*!
+
+Updating a preconditioner rebuilds all local matrices, reapplies boundary
+conditions, and recomputes the inverse (e.g. the AMG hierarchy), which on
+large meshes often costs more than the linear solves it accelerates.  The time
+integrator's `"max preconditioner lag iterations`" skips updates at a fixed
+frequency within one nonlinear solve; this policy instead keeps the last
+preconditioner, across time steps as well, for as long as it still works.
+
+The preconditioner is rebuilt when the time integrator requests an update and:
+
+- it has been reused `"maximum reuse count`" times in a row, or
+- the time step size differs from the one it was built with by more than
+  `"time step size tolerance`" (relative), or the step was retried, or
+- the nonlinear solve converged slowly with it: the ratio of successive error
+  norms exceeded `"maximum error ratio`".
+
+Otherwise the update is skipped, keeping all matrices and the inverse.  The
+number of rebuilds and reuses is reported after each successful step at a
+verbosity of `"medium`" or higher.
+
+This policy is enabled by providing the `"preconditioner reuse`" sublist in a
+PK that owns its own time integrator.  The policy applies to the whole
+preconditioner of that PK, including the blocks of any strongly coupled
+sub-PKs.
+
+.. _preconditioner-reuse-spec:
+.. admonition:: preconditioner-reuse-spec
+
+    * `"maximum reuse count`" ``[int]`` **5** Maximum number of consecutive
+      updates that may be skipped.
+
+    * `"time step size tolerance`" ``[double]`` **0.1** Relative change in the
+      time step size, and so the accumulation terms, above which the
+      preconditioner is rebuilt.
+
+    * `"maximum error ratio`" ``[double]`` **0.5** If the error norm of a
+      nonlinear iteration is larger than this times the previous one, the
+      preconditioner is rebuilt at the next update.
+
+*/
+
+#pragma once
+
+#include "Teuchos_ParameterList.hpp"
+
+#include "VerboseObject.hh"
+#include "bdf_fn_wrapper.hh"
+
+namespace Amanzi {
+
+class BDFFnPreconditionerReuse : public BDFFnWrapper {
+ public:
+  BDFFnPreconditionerReuse(Teuchos::ParameterList& plist, BDFFnBase<TreeVector>& fn);
+
+  // Tracks the time of the nonlinear solve, to tell solves apart.
+  virtual void FunctionalResidual(double t_old,
+                                  double t_new,
+                                  Teuchos::RCP<TreeVector> u_old,
+                                  Teuchos::RCP<TreeVector> u_new,
+                                  Teuchos::RCP<TreeVector> f) override;
+
+  // Tracks the convergence rate of the nonlinear solve.
+  virtual double
+  ErrorNorm(Teuchos::RCP<const TreeVector> u, Teuchos::RCP<const TreeVector> du) override;
+
+  // Forwards to fn only if a rebuild is needed.
+  virtual void UpdatePreconditioner(double t, Teuchos::RCP<const TreeVector> up, double h) override;
+
+  int num_rebuilds() const { return num_rebuilds_; }
+  int num_reuses() const { return num_reuses_; }
+
+ protected:
+  Teuchos::RCP<VerboseObject> vo_;
+
+  int max_reuse_;
+  double dt_tol_;
+  double max_ratio_;
+
+  bool built_;
+  double t_built_;
+  double h_built_;
+  int n_reused_; // consecutive
+
+  double t_solve_;
+  double last_norm_;
+  bool slow_;
+
+  int num_rebuilds_;
+  int num_reuses_;
+};
+
+} // namespace Amanzi
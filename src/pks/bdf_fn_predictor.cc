@@ -0,0 +1,281 @@
+/*
+  Copyright 2010-202x held jointly by participating institutions.
+  ATS is released under the three-clause BSD License.
+  The terms of use and "as is" disclaimer for this license are
+  provided in the top-level COPYRIGHT file.
+
+  Authors:
+*/
+
+/* -------------------------------------------------------------------------
+ATS
+
+Predictors for the nonlinear solve of a BDF PK: extrapolation from the
+solution history, periodic (last period, same time) increments, and a
+correction by the previous predictor's error.
+------------------------------------------------------------------------- */
+
+#include <algorithm>
+#include <cmath>
+
+#include "errors.hh"
+#include "bdf_fn_predictor.hh"
+
+namespace Amanzi {
+
+namespace {
+
+// tolerance, relative to the interval, for times falling on a snapshot
+const double snapshot_eps = 1.e-8;
+
+int
+positiveModulo(long long k, int n)
+{
+  int i = k % n;
+  return i < 0 ? i + n : i;
+}
+
+} // namespace
+
+
+BDFFnPredictor::BDFFnPredictor(Teuchos::ParameterList& plist, BDFFnBase<TreeVector>& fn)
+  : BDFFnWrapper(fn),
+    t_predicted_(0.),
+    h_predicted_(0.),
+    correction_(0.),
+    h_error_(0.),
+    iterations_(0),
+    num_steps_(0),
+    num_iterations_(0)
+{
+  auto type = plist.get<std::string>("predictor type", "extrapolation");
+  if (type != "extrapolation" && type != "periodic") {
+    Errors::Message msg;
+    msg << "Predictor: invalid \"predictor type\" \"" << type
+        << "\", valid are \"extrapolation\" and \"periodic\".";
+    Exceptions::amanzi_throw(msg);
+  }
+  periodic_ = type == "periodic";
+  order_ = plist.get<int>("extrapolation order", 2);
+  if (order_ < 1) {
+    Errors::Message msg("Predictor: \"extrapolation order\" must be >= 1.");
+    Exceptions::amanzi_throw(msg);
+  }
+  correct_ = plist.get<bool>("correct with previous error", false);
+
+  if (periodic_) {
+    period_ = plist.get<double>("period [s]", 365. * 86400.);
+    interval_ = plist.get<double>("snapshot interval [s]", 86400.);
+    int n_snapshots = std::lround(period_ / interval_);
+    if (interval_ <= 0. || n_snapshots < 1 ||
+        std::abs(n_snapshots * interval_ - period_) > snapshot_eps * interval_) {
+      Errors::Message msg("Predictor: \"snapshot interval [s]\" must divide \"period [s]\".");
+      Exceptions::amanzi_throw(msg);
+    }
+    // one more than a period, so that the snapshot at the start of the
+    // step, one period ago, is not yet overwritten
+    snapshots_.resize(n_snapshots + 1);
+    snapshot_ids_.resize(n_snapshots + 1, 0);
+  }
+  vo_ = Teuchos::rcp(new VerboseObject("predictor", plist));
+}
+
+
+void
+BDFFnPredictor::FunctionalResidual(double t_old,
+                                   double t_new,
+                                   Teuchos::RCP<TreeVector> u_old,
+                                   Teuchos::RCP<TreeVector> u_new,
+                                   Teuchos::RCP<TreeVector> f)
+{
+  iterations_++;
+  fn_.FunctionalResidual(t_old, t_new, u_old, u_new, f);
+}
+
+
+bool
+BDFFnPredictor::ModifyPredictor(double h,
+                                Teuchos::RCP<const TreeVector> u0,
+                                Teuchos::RCP<TreeVector> u)
+{
+  iterations_ = 0;
+  bool changed = false;
+  if (!times_.empty()) {
+    if (predicted_ == Teuchos::null) {
+      predicted_ = Teuchos::rcp(new TreeVector(*u, INIT_MODE_ZERO));
+      predicted_default_ = Teuchos::rcp(new TreeVector(*u, INIT_MODE_ZERO));
+      work_ = Teuchos::rcp(new TreeVector(*u, INIT_MODE_ZERO));
+    }
+    *predicted_default_ = *u;
+
+    double t_old = times_.front();
+    double t_new = t_old + h;
+    int order = 0;
+    if (periodic_ && Periodic_(t_old, t_new, *u0, *u)) {
+      changed = true;
+    } else {
+      order = Extrapolate_(t_new, *u);
+      changed = order > 0;
+    }
+    if (!changed) *u = *predicted_default_;
+
+    *predicted_ = *u;
+    correction_ = 0.;
+    if (correct_ && h_error_ > 0.) {
+      correction_ = std::pow(h / h_error_, order + 1);
+      u->Update(correction_, *error_, 1.);
+      changed = true;
+    }
+
+    t_predicted_ = t_new;
+    h_predicted_ = h;
+    if (changed) fn_.ChangedSolution();
+  }
+
+  changed |= fn_.ModifyPredictor(h, u0, u);
+  return changed;
+}
+
+
+void
+BDFFnPredictor::CommitSolution(double t, Teuchos::RCP<const TreeVector> u)
+{
+  if (!times_.empty() && t <= times_.front()) return;
+  Teuchos::OSTab tab = vo_->getOSTab();
+
+  if (predicted_ != Teuchos::null && std::abs(t - t_predicted_) <= 1.e-8 * h_predicted_) {
+    num_steps_++;
+    num_iterations_ += iterations_;
+
+    if (vo_->os_OK(Teuchos::VERB_MEDIUM)) {
+      work_->Update(1., *u, -1., *predicted_, 0.);
+      if (correction_ != 0.) work_->Update(-correction_, *error_, 1.);
+      double err = fn_.ErrorNorm(u, work_);
+      work_->Update(1., *u, -1., *predicted_default_, 0.);
+      double err_default = fn_.ErrorNorm(u, work_);
+      *vo_->os() << "predictor error = " << err << " (default = " << err_default << "), "
+                 << iterations_ << " iterations (mean = " << (double)num_iterations_ / num_steps_
+                 << ")" << std::endl;
+    }
+
+    if (correct_) {
+      // the error of the uncorrected predictor, which varies smoothly
+      if (error_ == Teuchos::null) error_ = Teuchos::rcp(new TreeVector(*u, INIT_MODE_ZERO));
+      error_->Update(1., *u, -1., *predicted_, 0.);
+      h_error_ = h_predicted_;
+    }
+  } else {
+    // the step was not predicted here, so the error is unknown
+    h_error_ = 0.;
+  }
+
+  if (periodic_) {
+    if (times_.empty()) {
+      // the initial solution is stored only if it falls on a snapshot
+      double x = t / interval_;
+      if (std::abs(x - std::round(x)) <= snapshot_eps) StoreSnapshots_(t - interval_, *u, t, *u);
+    } else {
+      StoreSnapshots_(times_.front(), *history_.front(), t, *u);
+    }
+  }
+
+  // push onto the history, reusing the oldest vector
+  Teuchos::RCP<TreeVector> v;
+  if ((int)history_.size() == order_ + 1) {
+    v = history_.back();
+    history_.pop_back();
+    times_.pop_back();
+  } else {
+    v = Teuchos::rcp(new TreeVector(*u, INIT_MODE_ZERO));
+  }
+  *v = *u;
+  history_.push_front(v);
+  times_.push_front(t);
+  iterations_ = 0;
+}
+
+
+void
+BDFFnPredictor::Reset()
+{
+  // Snapshots are kept: the change over a period is still the best guess of
+  // the change after the solution is set, e.g. by spin-up acceleration.
+  times_.clear();
+  history_.clear();
+  predicted_ = Teuchos::null;
+  h_error_ = 0.;
+  iterations_ = 0;
+}
+
+
+int
+BDFFnPredictor::Extrapolate_(double t, TreeVector& u) const
+{
+  // Lagrange polynomial through the last n solutions
+  int n = std::min(order_ + 1, (int)times_.size());
+  if (n < 2) return 0;
+
+  u.PutScalar(0.);
+  for (int i = 0; i != n; ++i) {
+    double coef = 1.;
+    for (int j = 0; j != n; ++j) {
+      if (j != i) coef *= (t - times_[j]) / (times_[i] - times_[j]);
+    }
+    u.Update(coef, *history_[i], 1.);
+  }
+  return n - 1;
+}
+
+
+bool
+BDFFnPredictor::Periodic_(double t_old, double t_new, const TreeVector& u0, TreeVector& u)
+{
+  if (!Snapshot_(t_old - period_, *work_) || !Snapshot_(t_new - period_, u)) return false;
+  u.Update(1., u0, -1., *work_, 1.);
+  return true;
+}
+
+
+bool
+BDFFnPredictor::Snapshot_(double t, TreeVector& s) const
+{
+  int n = snapshots_.size();
+  double x = t / interval_;
+  long long k = std::floor(x + snapshot_eps);
+  double w = std::max(x - k, 0.);
+
+  int i0 = positiveModulo(k, n);
+  if (snapshots_[i0] == Teuchos::null || snapshot_ids_[i0] != k) return false;
+  if (w <= snapshot_eps) {
+    s = *snapshots_[i0];
+    return true;
+  }
+
+  int i1 = positiveModulo(k + 1, n);
+  if (snapshots_[i1] == Teuchos::null || snapshot_ids_[i1] != k + 1) return false;
+  s.Update(1. - w, *snapshots_[i0], w, *snapshots_[i1], 0.);
+  return true;
+}
+
+
+void
+BDFFnPredictor::StoreSnapshots_(double t_old,
+                                const TreeVector& u_old,
+                                double t_new,
+                                const TreeVector& u_new)
+{
+  int n = snapshots_.size();
+  long long k_begin = std::floor(t_old / interval_ + snapshot_eps) + 1;
+  long long k_end = std::floor(t_new / interval_ + snapshot_eps);
+  for (long long k = k_begin; k <= k_end; ++k) {
+    double w = std::min(std::max((k * interval_ - t_old) / (t_new - t_old), 0.), 1.);
+    int i = positiveModulo(k, n);
+    if (snapshots_[i] == Teuchos::null) {
+      snapshots_[i] = Teuchos::rcp(new TreeVector(u_new, INIT_MODE_ZERO));
+    }
+    snapshots_[i]->Update(1. - w, u_old, w, u_new, 0.);
+    snapshot_ids_[i] = k;
+  }
+}
+
+} // namespace Amanzi
@@ -0,0 +1,162 @@
+/*
+  Copyright 2010-202x held jointly by participating institutions.
+  ATS is released under the three-clause BSD License.
+  The terms of use and "as is" disclaimer for this license are
+  provided in the top-level COPYRIGHT file.
+
+  Authors:
+*/
+
+//! Improved initial guesses for the nonlinear solve of a BDF PK.
+/*!
+
+The time integrator's predictor, the initial guess of each nonlinear solve, is
+a linear extrapolation of the last two solutions, which the PK may then modify
+(e.g. for flux boundary conditions).  The closer the predictor is to the
+solution, the fewer nonlinear iterations are needed.  This replaces the
+time integrator's extrapolation, before the PK's modifications, with one of:
+
+- `"extrapolation`" Polynomial extrapolation, in time, through the last
+  `"extrapolation order`" + 1 accepted solutions.  Steps of varying size are
+  handled exactly.
+
+- `"periodic`" For periodic (e.g. annual) forcing, snapshots of the solution
+  are stored every `"snapshot interval [s]`" through one `"period [s]`".  The
+  predictor is the last solution plus the change in the solution over the
+  same interval one period earlier.  Until a full period has been stored, or
+  when the step does not fall within stored snapshots, extrapolation is used.
+  Snapshots are interpolated linearly in time, so the interval should not be
+  much larger than typical time steps.  Note this stores period / interval + 1
+  copies of the solution.
+
+Additionally, if `"correct with previous error`" is true, the error of the
+previous step's predictor (its difference from the accepted solution), scaled
+to the current step size, is added to the predictor.  This is a secant
+correction which captures errors that are smooth in time.
+
+The time integrator must extrapolate its initial guess (`"extrapolate initial
+guess`", the default), as otherwise predictors are not modified.
+
+At a verbosity of `"medium`" or higher, the error norm of the predictor and of
+the time integrator's default predictor, relative to the accepted solution,
+are reported after each step, along with the mean number of nonlinear
+iterations per step.
+
+This is enabled by providing the `"predictor`" sublist in a PK that owns its
+own time integrator.
+
+.. _predictor-spec:
+.. admonition:: predictor-spec
+
+    * `"predictor type`" ``[string]`` **extrapolation** One of
+      `"extrapolation`" or `"periodic`".
+
+    * `"extrapolation order`" ``[int]`` **2** Order of the polynomial
+      extrapolation.  Order 1 is the default predictor.
+
+    * `"period [s]`" ``[double]`` **31536000** Period of the forcing, used by
+      `"periodic`".  The default is a 365 day year.
+
+    * `"snapshot interval [s]`" ``[double]`` **86400** Interval between stored
+      snapshots, used by `"periodic`".  Must divide the period.
+
+    * `"correct with previous error`" ``[bool]`` **false** Add the scaled
+      error of the previous predictor.
+
+    * `"verbose object`" ``[verbose-object-spec]`` **optional** See `Verbose Object`_.
+
+*/
+
+#pragma once
+
+#include <deque>
+#include <vector>
+
+#include "Teuchos_ParameterList.hpp"
+
+#include "VerboseObject.hh"
+#include "bdf_fn_wrapper.hh"
+
+namespace Amanzi {
+
+class BDFFnPredictor : public BDFFnWrapper {
+ public:
+  BDFFnPredictor(Teuchos::ParameterList& plist, BDFFnBase<TreeVector>& fn);
+
+  // Counts residual evaluations, i.e. nonlinear iterations.  This must be
+  // the outermost wrapper seen by the time integrator, so that residuals
+  // evaluated by other wrappers (e.g. JFNK's finite differences) are not
+  // counted.
+  virtual void FunctionalResidual(double t_old,
+                                  double t_new,
+                                  Teuchos::RCP<TreeVector> u_old,
+                                  Teuchos::RCP<TreeVector> u_new,
+                                  Teuchos::RCP<TreeVector> f) override;
+
+  // Replaces the predictor u, then forwards to fn.
+  virtual bool
+  ModifyPredictor(double h, Teuchos::RCP<const TreeVector> u0, Teuchos::RCP<TreeVector> u) override;
+
+  // Adds the accepted solution u at time t to the history.
+  void CommitSolution(double t, Teuchos::RCP<const TreeVector> u);
+
+  // Forgets the history, e.g. when the solution is set outside of a step.
+  void Reset();
+
+  int num_steps() const { return num_steps_; }
+  int num_iterations() const { return num_iterations_; }
+
+ protected:
+  // Extrapolates the history to time t.  Returns the order of the
+  // extrapolation, or 0 if there is too little history.
+  int Extrapolate_(double t, TreeVector& u) const;
+
+  // Sets u to u0 plus the change from t_old to t_new one period ago.
+  // Returns false if that change is not stored.
+  bool Periodic_(double t_old, double t_new, const TreeVector& u0, TreeVector& u);
+
+  // Interpolates the stored snapshots to time t.
+  bool Snapshot_(double t, TreeVector& s) const;
+
+  // Stores snapshots at the snapshot times in (t_old, t_new].
+  void StoreSnapshots_(double t_old, const TreeVector& u_old, double t_new, const TreeVector& u_new);
+
+ protected:
+  Teuchos::RCP<VerboseObject> vo_;
+
+  int order_;
+  bool periodic_;
+  double period_;
+  double interval_;
+  bool correct_;
+
+  // accepted solutions, most recent first
+  std::deque<double> times_;
+  std::deque<Teuchos::RCP<TreeVector>> history_;
+
+  // ring of snapshots through one period, and the number of intervals since
+  // t = 0 at which each was taken
+  std::vector<Teuchos::RCP<TreeVector>> snapshots_;
+  std::vector<long long> snapshot_ids_;
+
+  // the last predictor, before correction, the time integrator's default
+  // predictor, and its step
+  double t_predicted_;
+  double h_predicted_;
+  Teuchos::RCP<TreeVector> predicted_;
+  Teuchos::RCP<TreeVector> predicted_default_;
+  double correction_; // coefficient of error_ added to predicted_
+
+  // error of the last accepted step's predictor, and its step size
+  Teuchos::RCP<TreeVector> error_;
+  double h_error_;
+
+  // workspace
+  Teuchos::RCP<TreeVector> work_;
+
+  int iterations_;
+  int num_steps_;
+  int num_iterations_;
+};
+
+} // namespace Amanzi
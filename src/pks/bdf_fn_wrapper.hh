@@ -0,0 +1,85 @@
+/*
+  Copyright 2010-202x held jointly by participating institutions.
+  ATS is released under the three-clause BSD License.
+  The terms of use and "as is" disclaimer for this license are
+  provided in the top-level COPYRIGHT file.
+
+  Authors:
+*/
+
+/*
+  BDFFnWrapper is a BDFFnBase which forwards all calls to another BDFFnBase,
+  typically a PK.  Wrappers that change how the time integrator sees a PK
+  (e.g. its preconditioner) derive from this and override only what they
+  change.  Wrappers may be stacked.
+*/
+
+#pragma once
+
+#include "BDFFnBase.hh"
+#include "TreeVector.hh"
+
+namespace Amanzi {
+
+class BDFFnWrapper : public BDFFnBase<TreeVector> {
+ public:
+  explicit BDFFnWrapper(BDFFnBase<TreeVector>& fn) : fn_(fn) {}
+
+  virtual void FunctionalResidual(double t_old,
+                                  double t_new,
+                                  Teuchos::RCP<TreeVector> u_old,
+                                  Teuchos::RCP<TreeVector> u_new,
+                                  Teuchos::RCP<TreeVector> f) override
+  {
+    fn_.FunctionalResidual(t_old, t_new, u_old, u_new, f);
+  }
+
+  virtual int
+  ApplyPreconditioner(Teuchos::RCP<const TreeVector> u, Teuchos::RCP<TreeVector> Pu) override
+  {
+    return fn_.ApplyPreconditioner(u, Pu);
+  }
+
+  virtual double
+  ErrorNorm(Teuchos::RCP<const TreeVector> u, Teuchos::RCP<const TreeVector> du) override
+  {
+    return fn_.ErrorNorm(u, du);
+  }
+
+  virtual void UpdatePreconditioner(double t, Teuchos::RCP<const TreeVector> up, double h) override
+  {
+    fn_.UpdatePreconditioner(t, up, h);
+  }
+
+  virtual void UpdateContinuationParameter(double lambda) override
+  {
+    fn_.UpdateContinuationParameter(lambda);
+  }
+
+  virtual bool IsAdmissible(Teuchos::RCP<const TreeVector> up) override
+  {
+    return fn_.IsAdmissible(up);
+  }
+
+  virtual bool
+  ModifyPredictor(double h, Teuchos::RCP<const TreeVector> u0, Teuchos::RCP<TreeVector> u) override
+  {
+    return fn_.ModifyPredictor(h, u0, u);
+  }
+
+  virtual AmanziSolvers::FnBaseDefs::ModifyCorrectionResult
+  ModifyCorrection(double h,
+                   Teuchos::RCP<const TreeVector> res,
+                   Teuchos::RCP<const TreeVector> u,
+                   Teuchos::RCP<TreeVector> du) override
+  {
+    return fn_.ModifyCorrection(h, res, u, du);
+  }
+
+  virtual void ChangedSolution() override { fn_.ChangedSolution(); }
+
+ protected:
+  BDFFnBase<TreeVector>& fn_;
+};
+
+} // namespace Amanzi
@@ -15,6 +15,8 @@
 
 */
 
+#include <cmath>
+
 #include "utils.hh"
 
 #include "PFT.hh"
@@ -190,5 +192,35 @@ PFT::InitRoots(const Epetra_SerialDenseVector& SoilTArr,
   return;
 }
 
+
+void
+PFT::PackState(double* state) const
+{
+  double* s = state;
+  for (double v : { Bleaf, Bleafmemory, Broot, Bstem, Bstore, CSinkLimit, ET, GDD, GPP, NPP })
+    *s++ = v;
+  for (double v : { annNPP, bleafon, gResp, mResp, lai, laimemory, leafoffdaysi, leafondaysi })
+    *s++ = v;
+  for (double v : { rootD, totalBiomass }) *s++ = v;
+  for (int v : { leafstatus, bleafoff, maxLAI }) *s++ = v;
+  for (int i = 0; i != 10; ++i) *s++ = annCBalance[i];
+  AMANZI_ASSERT(s - state == num_state);
+}
+
+
+void
+PFT::UnpackState(const double* state)
+{
+  const double* s = state;
+  for (double* v : { &Bleaf, &Bleafmemory, &Broot, &Bstem, &Bstore, &CSinkLimit, &ET, &GDD })
+    *v = *s++;
+  for (double* v : { &GPP, &NPP, &annNPP, &bleafon, &gResp, &mResp, &lai, &laimemory })
+    *v = *s++;
+  for (double* v : { &leafoffdaysi, &leafondaysi, &rootD, &totalBiomass }) *v = *s++;
+  for (int* v : { &leafstatus, &bleafoff, &maxLAI }) *v = (int)std::round(*s++);
+  for (int i = 0; i != 10; ++i) annCBalance[i] = *s++;
+  AMANZI_ASSERT(s - state == num_state);
+}
+
 } // namespace BGC
 } // namespace Amanzi
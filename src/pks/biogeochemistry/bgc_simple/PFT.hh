@@ -63,6 +63,13 @@ class PFT {
                  const Epetra_SerialDenseVector& SoilDArr,
                  const Epetra_SerialDenseVector& SoilThicknessArr);
 
+  // The scalars that evolve in time, as a flat array of num_state values, so
+  // that they may be stored in State.  The root distribution, BRootSoil, is
+  // not included.
+  static const int num_state = 33;
+  void PackState(double* state) const;
+  void UnpackState(const double* state);
+
   bool AssertRootBalance_or_die()
   {
     double totalRootW = BRootSoil.Norm1();
@@ -35,6 +35,8 @@ BGCSimple::BGCSimple(Teuchos::ParameterList& pk_tree,
                      const Teuchos::RCP<TreeVector>& solution)
   : PK_Physical_Default(pk_tree, global_list, S, solution),
     PK(pk_tree, global_list, S, solution),
+    pfts_advanced_(false),
+    col_geometry_fixed_(false),
     ncells_per_col_(-1)
 {
   // set up additional primary variables -- this is very hacky...
@@ -50,6 +52,12 @@ BGCSimple::BGCSimple(Teuchos::ParameterList& pk_tree,
   // -- lai
   total_lai_key_ =
     Keys::readKey(*plist_, domain_surf_, "total leaf area index", "total_leaf_area_index");
+  // -- PFT state, stored in State for checkpointing
+  pft_state_key_ = Keys::readKey(*plist_, domain_surf_, "pft state", "pft_state");
+  pft_roots_key_ = Keys::readKey(*plist_, domain_, "pft root biomass", "pft_root_biomass");
+  // -- spin-up convergence flag
+  spinup_converged_key_ = Keys::readKey(
+    *plist_, domain_, "spin-up converged", "soil_carbon_spinup_converged");
 
   // initial timestep
   dt_ = plist_->get<double>("initial time step", 1.);
@@ -129,20 +137,37 @@ BGCSimple::Setup()
     }
   }
 
-  // -- soil carbon pools
+  if (ncells_per_col_ < 0) ncells_per_col_ = 0; // no owned columns
+
+  // -- soil carbon pools, views into contiguous storage
+  som_.assign(num_cols_ * ncells_per_col_ * num_pools_, 0.);
   soil_carbon_pools_.resize(num_cols_);
   for (unsigned int col = 0; col != num_cols_; ++col) {
     soil_carbon_pools_[col].resize(ncells_per_col_);
 
     auto& col_iter = mesh_->cells_of_column(col);
-    ncells_per_col_ = col_iter.size();
-
     for (std::size_t i = 0; i != col_iter.size(); ++i) {
       // col_iter[i] = cell id, mp[cell_id] = index into partition list, sc_params_[index] = correct params
-      soil_carbon_pools_[col][i] = Teuchos::rcp(new SoilCarbon(sc_params_[mp[col_iter[i]]]));
+      double* som = &som_[(col * ncells_per_col_ + i) * num_pools_];
+      soil_carbon_pools_[col][i] = Teuchos::rcp(new SoilCarbon(sc_params_[mp[col_iter[i]]], som));
     }
   }
 
+  // -- column geometry and workspace
+  col_depth_.resize(num_cols_ * ncells_per_col_);
+  col_dz_.resize(num_cols_ * ncells_per_col_);
+  temp_c_.Size(ncells_per_col_);
+  pres_c_.Size(ncells_per_col_);
+  co2_decomp_c_.Size(ncells_per_col_);
+  trans_c_.Size(ncells_per_col_);
+
+  // -- spin-up acceleration of the soil carbon pools
+  if (plist_->isSublist("spin-up acceleration")) {
+    Teuchos::ParameterList& spinup_list = plist_->sublist("spin-up acceleration");
+    spinup_ =
+      Teuchos::rcp(new SpinupAccelerator(spinup_list, som_.size(), mesh_->get_comm()));
+  }
+
   // requirements: primary variable
   S_->Require<CompositeVector, CompositeVectorSpace>(key_, tag_next_, name_)
     .SetMesh(mesh_)
@@ -167,6 +192,17 @@ BGCSimple::Setup()
     ->SetComponent("cell", AmanziMesh::CELL, 1);
   requireEvaluatorPrimary(total_lai_key_, tag_next_, *S_);
 
+  // requirements: PFT state, copied in at each commit
+  S_->Require<CompositeVector, CompositeVectorSpace>(pft_state_key_, tag_next_, name_)
+    .SetMesh(mesh_surf_)
+    ->SetComponent("cell", AmanziMesh::CELL, num_pfts_ * PFT::num_state);
+  S_->Require<CompositeVector, CompositeVectorSpace>(pft_roots_key_, tag_next_, name_)
+    .SetMesh(mesh_)
+    ->SetComponent("cell", AmanziMesh::CELL, num_pfts_);
+  S_->GetRecordSetW(pft_roots_key_).set_subfieldnames(pft_names);
+  if (spinup_ != Teuchos::null)
+    S_->Require<double>(spinup_converged_key_, Tags::DEFAULT, name_);
+
   // requirement: diagnostics
   S_->Require<CompositeVector, CompositeVectorSpace>("co2_decomposition", tag_next_, name_)
     .SetMesh(mesh_)
@@ -298,22 +334,18 @@ BGCSimple::Initialize()
   }
 
   // init root carbon
-  auto col_temp = Teuchos::rcp(new Epetra_SerialDenseVector(ncells_per_col_));
-  auto col_depth = Teuchos::rcp(new Epetra_SerialDenseVector(ncells_per_col_));
-  auto col_dz = Teuchos::rcp(new Epetra_SerialDenseVector(ncells_per_col_));
-
+  UpdateColumnGeometry_();
   S_->GetEvaluator("temperature", tag_next_).Update(*S_, name_);
   const Epetra_Vector& temp =
     *(*S_->Get<CompositeVector>("temperature", tag_next_).ViewComponent("cell", false))(0);
 
   int num_cols_ = mesh_surf_->num_entities(AmanziMesh::CELL, AmanziMesh::Parallel_type::OWNED);
   for (int col = 0; col != num_cols_; ++col) {
-    FieldToColumn_(col, temp, col_temp.ptr());
-    ColDepthDz_(col, col_depth.ptr(), col_dz.ptr());
+    FieldToColumn_(col, temp, Teuchos::ptr(&temp_c_));
+    Epetra_SerialDenseVector depth_c(View, &col_depth_[col * ncells_per_col_], ncells_per_col_);
+    Epetra_SerialDenseVector dz_c(View, &col_dz_[col * ncells_per_col_], ncells_per_col_);
 
-    for (int i = 0; i != num_pfts_; ++i) {
-      pfts_old_[col][i]->InitRoots(*col_temp, *col_depth, *col_dz);
-    }
+    for (int i = 0; i != num_pfts_; ++i) { pfts_old_[col][i]->InitRoots(temp_c_, depth_c, dz_c); }
   }
 
   // ensure all initialization in both PFTs?  Not sure this is
@@ -321,6 +353,14 @@ BGCSimple::Initialize()
   for (int col = 0; col != num_cols_; ++col) {
     for (int i = 0; i != num_pfts_; ++i) { *pfts_[col][i] = *pfts_old_[col][i]; }
   }
+  CopyPFTsToState_();
+  S_->GetRecordW(pft_state_key_, tag_next_, name_).set_initialized();
+  S_->GetRecordW(pft_roots_key_, tag_next_, name_).set_initialized();
+
+  if (spinup_ != Teuchos::null) {
+    S_->Assign<double>(spinup_converged_key_, Tags::DEFAULT, name_, 0.);
+    S_->GetRecordW(spinup_converged_key_, Tags::DEFAULT, name_).set_initialized();
+  }
 }
 
 
@@ -328,13 +368,97 @@ BGCSimple::Initialize()
 void
 BGCSimple::CommitStep(double told, double tnew, const Tag& tag)
 {
-  // Copy the PFT over, which includes all additional state required, commit
-  // the step as succesful.
-  double dt = tnew - told;
+  // The advanced PFTs, which include all additional state required, become
+  // the old ones by swapping the two sets, rather than copying.  The next
+  // AdvanceStep() starts each column's working PFTs from these.
+  if (pfts_advanced_) {
+    if (spinup_ != Teuchos::null) CommitSpinup_(tnew);
+    std::swap(pfts_, pfts_old_);
+    pfts_advanced_ = false;
+    CopyPFTsToState_();
+
+  } else if (told == tnew) {
+    // Initial commits, after which State may have been read from a
+    // checkpoint, which includes the PFTs.
+    CopyPFTsFromState_();
+  }
+}
 
-  int num_cols_ = mesh_surf_->num_entities(AmanziMesh::CELL, AmanziMesh::Parallel_type::OWNED);
+
+// Accepts the step in the spin-up accelerator, jumping the soil carbon pools
+// at the end of a forcing cycle.
+void
+BGCSimple::CommitSpinup_(double t_new)
+{
+  if (!spinup_->CommitStep(t_new, som_.data())) return;
+
+  Epetra_MultiVector& sc_pools =
+    *S_->GetW<CompositeVector>(key_, tag_next_, name_).ViewComponent("cell", false);
+  int num_cols = mesh_surf_->num_entities(AmanziMesh::CELL, AmanziMesh::Parallel_type::OWNED);
+  for (int col = 0; col != num_cols; ++col) {
+    auto& col_iter = mesh_->cells_of_column(col);
+    const double* som_c = &som_[col * ncells_per_col_ * num_pools_];
+    for (std::size_t i = 0; i != col_iter.size(); ++i) {
+      for (int p = 0; p != num_pools_; ++p) sc_pools[p][col_iter[i]] = som_c[i * num_pools_ + p];
+    }
+  }
+  changedEvaluatorPrimary(key_, tag_next_, *S_);
+
+  Teuchos::OSTab out = vo_->getOSTab();
+  if (vo_->os_OK(Teuchos::VERB_LOW))
+    *vo_->os() << "Spin-up cycle " << spinup_->num_cycles()
+               << ": max relative change in soil carbon = " << spinup_->max_change() << std::endl;
+
+  // Convergence is exposed in State, so that the cycle driver may checkpoint
+  // once all PKs have committed the step.
+  if (spinup_->converged()) {
+    if (vo_->os_OK(Teuchos::VERB_LOW)) *vo_->os() << "Spin-up converged." << std::endl;
+    S_->Assign<double>(spinup_converged_key_, Tags::DEFAULT, name_, 1.);
+  }
+}
+
+
+// Copies the committed PFTs into State.
+void
+BGCSimple::CopyPFTsToState_()
+{
+  Epetra_MultiVector& pft_state =
+    *S_->GetW<CompositeVector>(pft_state_key_, tag_next_, name_).ViewComponent("cell", false);
+  Epetra_MultiVector& roots =
+    *S_->GetW<CompositeVector>(pft_roots_key_, tag_next_, name_).ViewComponent("cell", false);
+
+  double state[PFT::num_state];
   for (int col = 0; col != num_cols_; ++col) {
-    for (int i = 0; i != num_pfts_; ++i) { *pfts_old_[col][i] = *pfts_[col][i]; }
+    auto& col_iter = mesh_->cells_of_column(col);
+    for (int i = 0; i != num_pfts_; ++i) {
+      const PFT& pft = *pfts_old_[col][i];
+      pft.PackState(state);
+      for (int k = 0; k != PFT::num_state; ++k) pft_state[i * PFT::num_state + k][col] = state[k];
+      for (std::size_t j = 0; j != col_iter.size(); ++j) roots[i][col_iter[j]] = pft.BRootSoil[j];
+    }
+  }
+}
+
+
+// Copies the PFTs from State into both the committed and working sets.
+void
+BGCSimple::CopyPFTsFromState_()
+{
+  const Epetra_MultiVector& pft_state =
+    *S_->Get<CompositeVector>(pft_state_key_, tag_next_).ViewComponent("cell", false);
+  const Epetra_MultiVector& roots =
+    *S_->Get<CompositeVector>(pft_roots_key_, tag_next_).ViewComponent("cell", false);
+
+  double state[PFT::num_state];
+  for (int col = 0; col != num_cols_; ++col) {
+    auto& col_iter = mesh_->cells_of_column(col);
+    for (int i = 0; i != num_pfts_; ++i) {
+      PFT& pft = *pfts_old_[col][i];
+      for (int k = 0; k != PFT::num_state; ++k) state[k] = pft_state[i * PFT::num_state + k][col];
+      pft.UnpackState(state);
+      for (std::size_t j = 0; j != col_iter.size(); ++j) pft.BRootSoil[j] = roots[i][col_iter[j]];
+      *pfts_[col][i] = pft;
+    }
   }
 }
 
@@ -351,14 +475,8 @@ BGCSimple::AdvanceStep(double t_old, double t_new, bool reinit)
                << " t1 = " << S_->get_time(tag_next_) << " h = " << dt << std::endl
                << "----------------------------------------------------------------" << std::endl;
 
-  // Copy the PFT from old to new, in case we failed the previous attempt at
-  // this timestep.  This is hackery to get around the fact that PFTs are not
-  // (but should be) in state.
   AmanziMesh::Entity_ID num_cols_ =
     mesh_surf_->num_entities(AmanziMesh::CELL, AmanziMesh::Parallel_type::OWNED);
-  for (AmanziMesh::Entity_ID col = 0; col != num_cols_; ++col) {
-    for (int i = 0; i != num_pfts_; ++i) { *pfts_[col][i] = *pfts_old_[col][i]; }
-  }
 
   // grab the required fields
   Epetra_MultiVector& sc_pools =
@@ -422,36 +540,42 @@ BGCSimple::AdvanceStep(double t_old, double t_new, bool reinit)
   const Epetra_MultiVector& scv =
     *S_->Get<CompositeVector>("surface-cell_volume", tag_next_).ViewComponent("cell", false);
 
-  // Create workspace arrays (these should be removed when data is correctly oriented).
-  auto temp_c = Teuchos::rcp(new Epetra_SerialDenseVector(ncells_per_col_));
-  auto pres_c = Teuchos::rcp(new Epetra_SerialDenseVector(ncells_per_col_));
-  auto dz_c = Teuchos::rcp(new Epetra_SerialDenseVector(ncells_per_col_));
-  auto depth_c = Teuchos::rcp(new Epetra_SerialDenseVector(ncells_per_col_));
+  // column depths and thicknesses change only if the mesh deforms
+  if (!col_geometry_fixed_) UpdateColumnGeometry_();
 
-  // Create a workspace array for the result
-  Epetra_SerialDenseVector co2_decomp_c(ncells_per_col_);
-  Epetra_SerialDenseVector trans_c(ncells_per_col_);
   double sw_c(0.);
+  if (spinup_ != Teuchos::null) spinup_->BeginStep(t_old, t_new);
 
   total_lai.PutScalar(0.);
 
   // loop over columns and apply the model
   for (AmanziMesh::Entity_ID col = 0; col != num_cols_; ++col) {
     // update the various soil arrays
-    FieldToColumn_(col, *temp(0), temp_c.ptr());
-    FieldToColumn_(col, *pres(0), pres_c.ptr());
-    ColDepthDz_(col, depth_c.ptr(), dz_c.ptr());
+    FieldToColumn_(col, *temp(0), Teuchos::ptr(&temp_c_));
+    FieldToColumn_(col, *pres(0), Teuchos::ptr(&pres_c_));
+    Epetra_SerialDenseVector depth_c(View, &col_depth_[col * ncells_per_col_], ncells_per_col_);
+    Epetra_SerialDenseVector dz_c(View, &col_dz_[col * ncells_per_col_], ncells_per_col_);
 
-    // copy over the soil carbon arrays
+    // copy over the soil carbon arrays, which are viewed by the column's pools
     auto& col_iter = mesh_->cells_of_column(col);
-    ncells_per_col_ = col_iter.size();
+    double* som_c = &som_[col * ncells_per_col_ * num_pools_];
 
     // -- serious cache thrash... --etc
     for (std::size_t i = 0; i != col_iter.size(); ++i) {
-      AmanziGeometry::Point centroid = mesh_->cell_centroid(col_iter[i]);
-      //      std::cout << "Col iter col=" << col << ", index i=" << i << ", cell=" << col_iter[i] << " at " << centroid << std::endl;
-      for (int p = 0; p != soil_carbon_pools_[col][i]->nPools; ++p) {
-        soil_carbon_pools_[col][i]->SOM[p] = sc_pools[p][col_iter[i]];
+      for (int p = 0; p != num_pools_; ++p) som_c[i * num_pools_ + p] = sc_pools[p][col_iter[i]];
+    }
+
+    // record decomposition losses of the step for spin-up
+    if (spinup_ != Teuchos::null) {
+      int offset = col * ncells_per_col_ * num_pools_;
+      for (std::size_t i = 0; i != col_iter.size(); ++i) {
+        double factor = SoilDecompositionFactor(temp_c_[i], pres_c_[i], depth_c[i]);
+        const SoilCarbonParameters& params = *soil_carbon_pools_[col][i]->params;
+        for (int p = 0; p != num_pools_; ++p) {
+          double C = som_c[i * num_pools_ + p];
+          double turnover = SoilCarbonTurnover(params, p, dt / 86400., factor);
+          spinup_->Record(offset + i * num_pools_ + p, C, C * turnover);
+        }
       }
     }
 
@@ -466,35 +590,40 @@ BGCSimple::AdvanceStep(double t_old, double t_new, bool reinit)
     met.lat = lat_;
     sw_c = met.qSWin;
 
+    // The model advances PFTs in place, so the working set starts from the
+    // committed one, which is kept for a repeated step.  This is the PFTs'
+    // only copy per step: it is done column by column, while the column is
+    // in cache, and committing the step swaps the two sets.  This is hackery
+    // to get around the fact that PFTs are not (but should be) in state.
+    for (int i = 0; i != num_pfts_; ++i) *pfts_[col][i] = *pfts_old_[col][i];
+
     // call the model
     BGCAdvance(S_->get_time(tag_current_),
                dt,
                scv[0][col],
                cryoturbation_coef_,
                met,
-               *temp_c,
-               *pres_c,
-               *depth_c,
-               *dz_c,
+               temp_c_,
+               pres_c_,
+               depth_c,
+               dz_c,
                pfts_[col],
                soil_carbon_pools_[col],
-               co2_decomp_c,
-               trans_c,
+               co2_decomp_c_,
+               trans_c_,
                sw_c);
 
     // copy back
     // -- serious cache thrash... --etc
     for (std::size_t i = 0; i != col_iter.size(); ++i) {
-      for (int p = 0; p != soil_carbon_pools_[col][i]->nPools; ++p) {
-        sc_pools[p][col_iter[i]] = soil_carbon_pools_[col][i]->SOM[p];
-      }
+      for (int p = 0; p != num_pools_; ++p) sc_pools[p][col_iter[i]] = som_c[i * num_pools_ + p];
 
       // and integrate the decomp
-      co2_decomp[0][col_iter[i]] += co2_decomp_c[i];
+      co2_decomp[0][col_iter[i]] += co2_decomp_c_[i];
 
 
       // and pull in the transpiration, converting to mol/m^3/s, as a sink
-      trans[0][col_iter[i]] = trans_c[i] / .01801528;
+      trans[0][col_iter[i]] = trans_c_[i] / .01801528;
       sw[0][col] = sw_c;
     }
 
@@ -514,6 +643,7 @@ BGCSimple::AdvanceStep(double t_old, double t_new, bool reinit)
   changedEvaluatorPrimary(trans_key_, tag_next_, *S_);
   changedEvaluatorPrimary(shaded_sw_key_, tag_next_, *S_);
   changedEvaluatorPrimary(total_lai_key_, tag_next_, *S_);
+  pfts_advanced_ = true;
   return false;
 }
 
@@ -545,6 +675,21 @@ BGCSimple::FieldToColumn_(AmanziMesh::Entity_ID col,
 }
 
 
+// helper function for collecting dz and depth of all columns
+void
+BGCSimple::UpdateColumnGeometry_()
+{
+  int num_cols = mesh_surf_->num_entities(AmanziMesh::CELL, AmanziMesh::Parallel_type::OWNED);
+  for (int col = 0; col != num_cols; ++col) {
+    Epetra_SerialDenseVector depth_c(View, &col_depth_[col * ncells_per_col_], ncells_per_col_);
+    Epetra_SerialDenseVector dz_c(View, &col_dz_[col * ncells_per_col_], ncells_per_col_);
+    ColDepthDz_(col, Teuchos::ptr(&depth_c), Teuchos::ptr(&dz_c));
+  }
+  // depths and thicknesses of a mesh that never deforms are computed once
+  col_geometry_fixed_ = !S_->IsDeformableMesh(domain_);
+}
+
+
 // helper function for collecting column dz and depth
 void
 BGCSimple::ColDepthDz_(AmanziMesh::Entity_ID col,
@@ -52,6 +52,10 @@ that build_columns in the subsurface Mesh_ spec has been supplied.
 
   * `"leaf biomass initial condition`" ``[initial-conditions-spec]`` Sets the leaf biomass IC.
 
+  * `"spin-up acceleration`" ``[spinup-accelerator-spec]`` **optional** If
+    provided, soil carbon pools are jumped toward their steady state at the
+    end of each forcing cycle, until converged.
+
   * `"domain name`" ``[string]`` **domain**
 
   * `"surface domain name`" ``[string]`` **surface**
@@ -64,6 +68,17 @@ that build_columns in the subsurface Mesh_ spec has been supplied.
 
   * `"total leaf area index key`" ``[string]`` **SURFACE_DOMAIN-total_leaf_area_index** Total LAI across all PFTs.
 
+  * `"pft state key`" ``[string]`` **SURFACE_DOMAIN-pft_state** The evolving
+    state of each PFT, stored so that it is checkpointed and restarted.
+
+  * `"pft root biomass key`" ``[string]`` **DOMAIN-pft_root_biomass** Root
+    biomass of each PFT in each soil cell `[kg C m^-2]`, stored as above.
+
+  * `"spin-up converged key`" ``[string]`` **DOMAIN-soil_carbon_spinup_converged**
+    With spin-up acceleration, a scalar that is 1 once spin-up has converged
+    and 0 before.  Listing it in the cycle driver's `"checkpoint triggers`"
+    checkpoints the converged state.
+
   EVALUATORS:
 
   - `"temperature`" The soil temperature `[K]`
@@ -93,6 +108,7 @@ that build_columns in the subsurface Mesh_ spec has been supplied.
 #include "SoilCarbonParameters.hh"
 #include "PFT.hh"
 #include "SoilCarbon.hh"
+#include "spinup_accelerator.hh"
 
 namespace Amanzi {
 namespace BGC {
@@ -136,6 +152,10 @@ class BGCSimple : public PK_Physical_Default {
   void ColDepthDz_(AmanziMesh::Entity_ID col,
                    Teuchos::Ptr<Epetra_SerialDenseVector> depth,
                    Teuchos::Ptr<Epetra_SerialDenseVector> dz);
+  void UpdateColumnGeometry_();
+  void CommitSpinup_(double t_new);
+  void CopyPFTsToState_();
+  void CopyPFTsFromState_();
 
  protected:
   double dt_;
@@ -146,8 +166,23 @@ class BGCSimple : public PK_Physical_Default {
   std::vector<Teuchos::RCP<SoilCarbonParameters>> sc_params_;
   std::vector<std::vector<Teuchos::RCP<PFT>>> pfts_;     // this also contains state data!
   std::vector<std::vector<Teuchos::RCP<PFT>>> pfts_old_; // need two copies for failed timesteps
+  bool pfts_advanced_;                                   // pfts_ is ahead of pfts_old_
   std::vector<std::vector<Teuchos::RCP<SoilCarbon>>> soil_carbon_pools_;
 
+  // Column-ordered storage, contiguous in cells of a column.
+  // -- soil carbon state, pool x cell x column, viewed by soil_carbon_pools_
+  std::vector<double> som_;
+  // -- cell depth and thickness, cell x column, updated each step if the mesh
+  //    is deformable
+  std::vector<double> col_depth_, col_dz_;
+  bool col_geometry_fixed_;
+  // -- workspace for a column
+  Epetra_SerialDenseVector temp_c_, pres_c_;
+  Epetra_SerialDenseVector co2_decomp_c_, trans_c_;
+
+  // spin-up acceleration, if requested
+  Teuchos::RCP<SpinupAccelerator> spinup_;
+
   // extras
   int num_pools_;
   int num_pfts_;
@@ -162,6 +197,8 @@ class BGCSimple : public PK_Physical_Default {
   Key trans_key_;
   Key shaded_sw_key_;
   Key total_lai_key_;
+  Key pft_state_key_, pft_roots_key_;
+  Key spinup_converged_key_;
 
 
  private:
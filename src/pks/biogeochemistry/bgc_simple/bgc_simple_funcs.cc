@@ -716,25 +716,14 @@ BGCAdvance(double t,
   //=========================================================================
   // do soil decomposition
   for (int k = 0; k != ncells; ++k) {
-    double TFactor = TEffectsQ10(2.0, SoilTArr[k] - 273.15, 25.0);
     SoilCO2Arr[k] = 0.0;
-    double WFactor;
-
-    double soil_wp = std::max(std::min((SoilWPArr[k] - p_atm) / 1.e6, wp_max), wp_min);
-    if (soil_wp == wp_min) {
-      WFactor = 0.0;
-    } else {
-      WFactor = std::log(wp_min / soil_wp) / std::log(wp_min / wp_max);
-    }
-
-    double DFactor = std::exp(-SoilDArr[k] / 0.5);
+    double factor = SoilDecompositionFactor(SoilTArr[k], SoilWPArr[k], SoilDArr[k]);
     int nPools = soilcarr[k]->params->nPools;
     std::vector<double> SOMConvt(nPools);
 
     for (int l = 0; l != nPools; ++l) {
       // AFFECTED BY DT --etc
-      double turnover =
-        dt_days * WFactor * TFactor * DFactor / (soilcarr[k]->params->TurnoverRates[l] * 365.25);
+      double turnover = SoilCarbonTurnover(*soilcarr[k]->params, l, dt_days, factor);
       AMANZI_ASSERT(turnover <= 0.9);
 
       double SOMDecomp = soilcarr[k]->SOM[l] * turnover;
@@ -764,6 +753,36 @@ BGCAdvance(double t,
   return;
 }
 
+// Environmental modifier of soil carbon decomposition, from temperature,
+// water potential, and depth
+double
+SoilDecompositionFactor(double soil_T, double soil_p, double depth)
+{
+  double p_atm = 101325.;
+  double wp_max = -1.e-6; //MPa wp = p - p_atm
+  double wp_min = -10.;   //MPa
+
+  double TFactor = TEffectsQ10(2.0, soil_T - 273.15, 25.0);
+  double WFactor;
+  double soil_wp = std::max(std::min((soil_p - p_atm) / 1.e6, wp_max), wp_min);
+  if (soil_wp == wp_min) {
+    WFactor = 0.0;
+  } else {
+    WFactor = std::log(wp_min / soil_wp) / std::log(wp_min / wp_max);
+  }
+  double DFactor = std::exp(-depth / 0.5);
+  return WFactor * TFactor * DFactor;
+}
+
+
+// Fraction of soil carbon pool l decomposed in a step of dt_days
+double
+SoilCarbonTurnover(const SoilCarbonParameters& params, int l, double dt_days, double factor)
+{
+  return dt_days * factor / (params.TurnoverRates[l] * 365.25);
+}
+
+
 // Cryoturbation -- move the carbon around via diffusion
 void
 Cryoturbate(double dt,
@@ -45,6 +45,16 @@ BGCAdvance(double t,
            Epetra_SerialDenseVector& TransArr,
            double& sw_shaded);
 
+// Environmental modifier of soil carbon decomposition [-], given soil
+// temperature [K], pressure [Pa], and depth [m].
+double
+SoilDecompositionFactor(double soil_T, double soil_p, double depth);
+
+// Fraction of soil carbon pool l decomposed in a step of dt_days [d], given
+// the environmental modifier above.
+double
+SoilCarbonTurnover(const SoilCarbonParameters& params, int l, double dt_days, double factor);
+
 void
 Cryoturbate(double dt,
             const Epetra_SerialDenseVector& SoilTArr,
@@ -0,0 +1,114 @@
+/*
+  Copyright 2010-202x held jointly by participating institutions.
+  ATS is released under the three-clause BSD License.
+  The terms of use and "as is" disclaimer for this license are
+  provided in the top-level COPYRIGHT file.
+
+  Authors:
+*/
+
+#include <algorithm>
+#include <cmath>
+
+#include "errors.hh"
+#include "spinup_accelerator.hh"
+
+namespace Amanzi {
+namespace BGC {
+
+SpinupAccelerator::SpinupAccelerator(Teuchos::ParameterList& plist,
+                                     int size,
+                                     const Comm_ptr_type& comm)
+  : comm_(comm),
+    t_old_(0.),
+    step_days_(0.),
+    step_C0_(size, 0.),
+    step_int_(size, 0.),
+    step_loss_(size, 0.),
+    cycle_started_(false),
+    cycle_days_(0.),
+    C0_(size, 0.),
+    int_(size, 0.),
+    loss_(size, 0.),
+    converged_(false),
+    num_cycles_(0),
+    max_change_(-1.)
+{
+  period_ = plist.get<double>("forcing period [s]", 365.25 * 86400.);
+  t_cycle_start_ = plist.get<double>("start time [s]", 0.);
+  rtol_ = plist.get<double>("tolerance [-]", 1.e-3);
+  atol_ = plist.get<double>("absolute tolerance [kg C m^-3]", 1.e-8);
+  max_factor_ = plist.get<double>("maximum jump factor [-]", 100.);
+  if (period_ <= 0. || rtol_ <= 0. || max_factor_ < 1.) {
+    Errors::Message msg("SpinupAccelerator: \"forcing period [s]\" and \"tolerance [-]\" must be "
+                        "positive, and \"maximum jump factor [-]\" at least 1.");
+    Exceptions::amanzi_throw(msg);
+  }
+}
+
+
+void
+SpinupAccelerator::BeginStep(double t_old, double t_new)
+{
+  t_old_ = t_old;
+  step_days_ = (t_new - t_old) / 86400.;
+  std::fill(step_int_.begin(), step_int_.end(), 0.);
+  std::fill(step_loss_.begin(), step_loss_.end(), 0.);
+}
+
+
+bool
+SpinupAccelerator::CommitStep(double t_new, double* C)
+{
+  if (converged_) return false;
+
+  // tolerate roundoff in steps that land on cycle boundaries
+  double eps = 1.e-6 * period_;
+  if (!cycle_started_) {
+    // the first cycle starts with the step that reaches the next boundary
+    if (t_old_ > t_cycle_start_ + eps)
+      t_cycle_start_ += std::ceil((t_old_ - t_cycle_start_ - eps) / period_) * period_;
+    if (t_new <= t_cycle_start_ + eps) return false;
+    C0_ = step_C0_;
+    cycle_started_ = true;
+  }
+
+  int n = int_.size();
+  for (int i = 0; i != n; ++i) {
+    int_[i] += step_int_[i];
+    loss_[i] += step_loss_[i];
+  }
+  cycle_days_ += step_days_;
+  if (t_new < t_cycle_start_ + period_ - eps) return false;
+
+  // jump to the steady state estimate
+  double max_change = 0.;
+  for (int i = 0; i != n; ++i) {
+    if (loss_[i] <= 0. || int_[i] <= 0.) continue;
+    double C_mean = int_[i] / cycle_days_;
+    double input = std::max(C[i] - C0_[i] + loss_[i], 0.);
+    double C_star = C_mean * input / loss_[i];
+    // bounded relative to the pool and its input, which allows a pool that
+    // starts empty to grow
+    C_star = std::min(std::max(C_star, C_mean / max_factor_), (C_mean + input) * max_factor_);
+
+    // C* is the cycle mean at steady state, so the trajectory is shifted by
+    // the change in the mean, keeping its phase in the cycle
+    max_change = std::max(max_change, std::abs(C_star - C_mean) / (C_mean + atol_));
+    C[i] = std::max(C[i] + C_star - C_mean, 0.);
+  }
+  comm_->MaxAll(&max_change, &max_change_, 1);
+  converged_ = max_change_ < rtol_;
+  num_cycles_++;
+
+  // start the next cycle, from the jumped pools
+  t_cycle_start_ += period_;
+  C0_.assign(C, C + n);
+  cycle_days_ = 0.;
+  std::fill(int_.begin(), int_.end(), 0.);
+  std::fill(loss_.begin(), loss_.end(), 0.);
+  return true;
+}
+
+} // namespace BGC
+} // namespace Amanzi
@@ -0,0 +1,113 @@
+/*
+  Copyright 2010-202x held jointly by participating institutions.
+  ATS is released under the three-clause BSD License.
+  The terms of use and "as is" disclaimer for this license are
+  provided in the top-level COPYRIGHT file.
+
+  Authors:
+*/
+
+//! Accelerates the spin-up of soil carbon pools under periodic forcing.
+/*!
+
+Soil carbon pools relax to equilibrium on the timescale of their slowest
+turnover, which takes thousands of years of repeated forcing when integrated
+explicitly.  Over each forcing cycle, this records, for every pool of every
+cell, the time-integrated pool size and the carbon lost to decomposition.
+Treating the pool as first order, dC/dt = I - k C, with cycle-mean input I
+and turnover k, gives the steady state
+
+  C* = I / k = mean(C) * (Delta C + L) / L,
+
+where Delta C is the change in the pool over the cycle and L its
+decomposition loss.  C* is the cycle mean at steady state, so at the end of
+each cycle the pools are shifted by C* - mean(C).
+Transfers between pools and cryoturbation enter through I, so the jumps are
+repeated every cycle until the largest relative change is below tolerance.
+Pools that did not decompose in a cycle, e.g. in permafrost, are left alone.
+
+.. _spinup-accelerator-spec:
+.. admonition:: spinup-accelerator-spec
+
+  * `"forcing period [s]`" ``[double]`` **31557600** Length of a forcing
+    cycle, by default one year.
+
+  * `"start time [s]`" ``[double]`` **0** Cycles start at this time plus
+    multiples of the period; a run starting mid-cycle waits for the next one.
+    Cycles end with the first step reaching the end of the period.
+
+  * `"tolerance [-]`" ``[double]`` **1e-3** Spin-up is converged when no
+    pool changes by more than this, relative, in a jump.
+
+  * `"absolute tolerance [kg C m^-3]`" ``[double]`` **1e-8** Added to the pool
+    size in the relative change.
+
+  * `"maximum jump factor [-]`" ``[double]`` **100** A jump shrinks the mean
+    of a pool by at most this factor, and grows it to at most this factor
+    times the sum of the mean and the input over the cycle.
+
+Convergence is exposed by the PK, see BGCSimple's `"spin-up converged key`",
+so that the cycle driver can checkpoint the converged state, to be used as an
+initial condition.
+
+*/
+
+#pragma once
+
+#include <vector>
+
+#include "Teuchos_ParameterList.hpp"
+#include "AmanziComm.hh"
+
+namespace Amanzi {
+namespace BGC {
+
+class SpinupAccelerator {
+ public:
+  // size is the number of pools on this rank, over all cells.
+  SpinupAccelerator(Teuchos::ParameterList& plist, int size, const Comm_ptr_type& comm);
+
+  // Starts a step, discarding anything recorded for a previous attempt.
+  void BeginStep(double t_old, double t_new);
+
+  // Records pool i, of size C at the start of the step, in which it lost
+  // loss to decomposition.
+  void Record(int i, double C, double loss)
+  {
+    step_C0_[i] = C;
+    step_int_[i] = C * step_days_;
+    step_loss_[i] = loss;
+  }
+
+  // Accepts the step ending at t_new, given the pools C at its end.  If this
+  // ends a forcing cycle and spin-up has not converged, jumps C toward
+  // steady state and returns true.  Collective.
+  bool CommitStep(double t_new, double* C);
+
+  bool converged() const { return converged_; }
+  int num_cycles() const { return num_cycles_; }
+  double max_change() const { return max_change_; }
+
+ private:
+  Comm_ptr_type comm_;
+  double period_;
+  double t_cycle_start_;
+  double rtol_, atol_;
+  double max_factor_;
+
+  // current step
+  double t_old_, step_days_;
+  std::vector<double> step_C0_, step_int_, step_loss_;
+
+  // current cycle
+  bool cycle_started_;
+  double cycle_days_;
+  std::vector<double> C0_, int_, loss_;
+
+  bool converged_;
+  int num_cycles_;
+  double max_change_;
+};
+
+} // namespace BGC
+} // namespace Amanzi
@@ -0,0 +1,114 @@
+/*
+  Copyright 2010-202x held jointly by participating institutions.
+  ATS is released under the three-clause BSD License.
+  The terms of use and "as is" disclaimer for this license are
+  provided in the top-level COPYRIGHT file.
+
+  Authors:
+*/
+
+#include <cmath>
+
+#include <UnitTest++.h>
+
+#include "Teuchos_ParameterList.hpp"
+
+#include "AmanziComm.hh"
+#include "errors.hh"
+#include "spinup_accelerator.hh"
+
+using namespace Amanzi;
+
+namespace {
+
+// Two pools in a chain, stepped daily with explicit Euler: the fast pool has
+// input I and turnover k1 [d^-1], and passes a fraction f of its losses to
+// the slow pool, of turnover k2.  The steady state, C1 = I / k1 and
+// C2 = f I / k2, is reached on the slow pool's timescale of a decade.
+struct TwoPools {
+  double I = 1., f = 0.3, k1 = 1. / 100, k2 = 1. / 3650;
+  double C[2] = { 0., 0. };
+  double t = 0.;
+
+  // Advances a year, returning true if the accelerator jumped.
+  bool year(BGC::SpinupAccelerator* spinup)
+  {
+    bool jumped = false;
+    for (int d = 0; d != 365; ++d) {
+      double loss[2] = { k1 * C[0], k2 * C[1] };
+      if (spinup) {
+        spinup->BeginStep(t, t + 86400.);
+        for (int i = 0; i != 2; ++i) spinup->Record(i, C[i], loss[i]);
+      }
+      C[0] += I - loss[0];
+      C[1] += f * loss[0] - loss[1];
+      t += 86400.;
+      if (spinup) jumped |= spinup->CommitStep(t, C);
+    }
+    return jumped;
+  }
+
+  double error() const
+  {
+    return std::max(std::abs(C[0] * k1 / I - 1.), std::abs(C[1] * k2 / (f * I) - 1.));
+  }
+};
+
+} // namespace
+
+
+SUITE(BGC_SPINUP_ACCELERATOR)
+{
+  // Jumps reach the steady state of both pools in a few cycles, while
+  // integration alone is still far from it after decades.
+  TEST(SPINUP_TWO_POOLS)
+  {
+    Teuchos::ParameterList plist("spin-up acceleration");
+    plist.set<double>("forcing period [s]", 365. * 86400.);
+    BGC::SpinupAccelerator spinup(plist, 2, getDefaultComm());
+
+    TwoPools accelerated;
+    int years = 0;
+    while (!spinup.converged() && years != 100) {
+      CHECK(accelerated.year(&spinup));
+      years++;
+    }
+    CHECK(spinup.converged());
+    CHECK_EQUAL(years, spinup.num_cycles());
+    CHECK(years <= 10);
+    CHECK(spinup.max_change() < 1.e-3);
+    CHECK(accelerated.error() < 1.e-3);
+
+    // once converged, pools are no longer jumped
+    CHECK(!accelerated.year(&spinup));
+    CHECK(accelerated.error() < 1.e-3);
+
+    TwoPools integrated;
+    for (int y = 0; y != 3 * years; ++y) integrated.year(nullptr);
+    CHECK(integrated.error() > 1.e-2);
+  }
+
+
+  // A run starting mid-cycle waits for the next cycle to start.
+  TEST(SPINUP_MID_CYCLE_START)
+  {
+    Teuchos::ParameterList plist("spin-up acceleration");
+    plist.set<double>("forcing period [s]", 365. * 86400.);
+    BGC::SpinupAccelerator spinup(plist, 2, getDefaultComm());
+
+    TwoPools pools;
+    pools.t = 100. * 86400.;
+    CHECK(!pools.year(&spinup));
+    CHECK_EQUAL(0, spinup.num_cycles());
+    CHECK(pools.year(&spinup));
+    CHECK_EQUAL(1, spinup.num_cycles());
+  }
+
+
+  TEST(SPINUP_INVALID)
+  {
+    Teuchos::ParameterList plist("spin-up acceleration");
+    plist.set<double>("maximum jump factor [-]", 0.5);
+    CHECK_THROW(BGC::SpinupAccelerator(plist, 2, getDefaultComm()), Errors::Message);
+  }
+}
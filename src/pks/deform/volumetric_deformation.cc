@@ -12,6 +12,7 @@
 //! Subsidence through bulk ice loss and cell volumetric change.
 #include "CompositeVectorFunctionFactory.hh"
 #include "pk_helpers.hh"
+#include "mesh_geometry_cache.hh"
 #include "volumetric_deformation.hh"
 
 #define DEBUG 0
@@ -632,7 +633,9 @@ VolumetricDeformation::AdvanceStep(double t_old, double t_new, bool reinit)
       }
       AmanziGeometry::Point_List surface_finpos;
       surf3d_mesh_nc_->deform(surface_nodeids, surface_newpos, false, &surface_finpos);
+      MeshGeometryCache::Invalidate(*surf3d_mesh_nc_);
     }
+    MeshGeometryCache::Invalidate(*mesh_nc_);
 
     // Note, this order is intentionally odd.  The deforming cell volume
     // evaluator uses base porosity as it's dependency.  But the reality is
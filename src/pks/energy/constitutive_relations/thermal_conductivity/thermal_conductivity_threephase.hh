@@ -55,6 +55,29 @@ class ThermalConductivityThreePhase {
     AMANZI_ASSERT(false);
     return 0.;
   }
+
+  // Optional fast path for models with factors that depend only on porosity
+  // (and parameters).  These are prepared per cell, reused for as long as
+  // porosity is unchanged, and passed back to ThermalConductivityPrepared().
+  virtual int NumPreparedFactors() { return 0; }
+  virtual void PrepareFactors(double porosity, double* factors) {}
+
+  // Evaluates cells ids[0..n), indexing all arrays by cell; factors holds
+  // NumPreparedFactors() values per cell.
+  virtual void ThermalConductivityPrepared(int n,
+                                           const int* ids,
+                                           const double* factors,
+                                           const double* porosity,
+                                           const double* sat_liq,
+                                           const double* sat_ice,
+                                           const double* temp,
+                                           double* result)
+  {
+    for (int i = 0; i != n; ++i) {
+      int c = ids[i];
+      result[c] = ThermalConductivity(porosity[c], sat_liq[c], sat_ice[c], temp[c]);
+    }
+  }
 };
 
 } // namespace Energy
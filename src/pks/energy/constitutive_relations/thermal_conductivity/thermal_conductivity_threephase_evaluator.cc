@@ -13,6 +13,8 @@
 
 */
 
+#include <limits>
+
 #include "dbc.hh"
 #include "thermal_conductivity_threephase_factory.hh"
 #include "thermal_conductivity_threephase_evaluator.hh"
@@ -53,6 +55,8 @@ ThermalConductivityThreePhaseEvaluator::ThermalConductivityThreePhaseEvaluator(
       Teuchos::RCP<ThermalConductivityThreePhase> tc =
         fac.createThermalConductivityModel(tcp_sublist);
       tcs_.push_back(std::make_pair(region_name, tc));
+      prepared_factors_.emplace_back();
+      prepared_poro_.emplace_back();
     } else {
       Errors::Message message("ThermalConductivityThreePhaseEvaluator: region-based lists.  "
                               "(Perhaps you have an old-style input file?)");
@@ -99,12 +103,31 @@ ThermalConductivityThreePhaseEvaluator::Evaluate_(const State& S,
         mesh->get_set_entities(
           region_name, AmanziMesh::CELL, AmanziMesh::Parallel_type::OWNED, &id_list);
 
-        // loop over indices
-        for (AmanziMesh::Entity_ID_List::const_iterator id = id_list.begin(); id != id_list.end();
-             ++id) {
-          result_v[0][*id] = lcv->second->ThermalConductivity(
-            poro_v[0][*id], sat_v[0][*id], sat2_v[0][*id], temp_v[0][*id]);
+        // refresh the porosity-only factors of cells whose porosity changed
+        int m = lcv - tcs_.begin();
+        int n_factors = lcv->second->NumPreparedFactors();
+        if (n_factors > 0) {
+          int ncells = result_v.MyLength();
+          if (prepared_poro_[m].size() != (std::size_t)ncells) {
+            prepared_poro_[m].assign(ncells, std::numeric_limits<double>::quiet_NaN());
+            prepared_factors_[m].resize(ncells * n_factors);
+          }
+          for (auto c : id_list) {
+            if (poro_v[0][c] != prepared_poro_[m][c]) {
+              lcv->second->PrepareFactors(poro_v[0][c], &prepared_factors_[m][n_factors * c]);
+              prepared_poro_[m][c] = poro_v[0][c];
+            }
+          }
         }
+
+        lcv->second->ThermalConductivityPrepared(id_list.size(),
+                                                 id_list.data(),
+                                                 prepared_factors_[m].data(),
+                                                 poro_v[0],
+                                                 sat_v[0],
+                                                 sat2_v[0],
+                                                 temp_v[0],
+                                                 result_v[0]);
       } else {
         std::stringstream m;
         m << "Thermal conductivity evaluator: unknown region on cells: \"" << region_name << "\"";
@@ -59,6 +59,11 @@ class ThermalConductivityThreePhaseEvaluator : public EvaluatorSecondaryMonotype
  protected:
   std::vector<RegionModelPair> tcs_;
 
+  // Per model, the porosity-only factors of each cell and the porosity they
+  // were prepared with.
+  std::vector<std::vector<double>> prepared_factors_;
+  std::vector<std::vector<double>> prepared_poro_;
+
   // Keys for fields
   // dependencies
   Key poro_key_;
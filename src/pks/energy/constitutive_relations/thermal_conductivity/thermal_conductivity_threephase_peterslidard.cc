@@ -32,12 +32,33 @@ ThermalConductivityThreePhasePetersLidard::ThermalConductivity(double poro,
                                                                double sat_ice,
                                                                double temp)
 {
-  double k_dry = (d_ * (1 - poro) * k_soil_ + k_gas_ * poro) / (d_ * (1 - poro) + poro);
-  double k_sat_u = pow(k_soil_, (1 - poro)) * pow(k_liquid_, poro);
-  double k_sat_f = pow(k_soil_, (1 - poro)) * pow(k_ice_, poro);
-  double kersten_u = pow(sat_liq + eps_, alpha_u_);
-  double kersten_f = pow(sat_ice + eps_, alpha_f_);
-  return kersten_f * k_sat_f + kersten_u * k_sat_u + (1.0 - kersten_f - kersten_u) * k_dry;
+  double factors[3];
+  PrepareFactors(poro, factors);
+  return ThermalConductivity_(factors, sat_liq, sat_ice);
+};
+
+void
+ThermalConductivityThreePhasePetersLidard::PrepareFactors(double poro, double* factors)
+{
+  factors[0] = (d_ * (1 - poro) * k_soil_ + k_gas_ * poro) / (d_ * (1 - poro) + poro);
+  factors[1] = pow(k_soil_, (1 - poro)) * pow(k_liquid_, poro);
+  factors[2] = pow(k_soil_, (1 - poro)) * pow(k_ice_, poro);
+};
+
+void
+ThermalConductivityThreePhasePetersLidard::ThermalConductivityPrepared(int n,
+                                                                       const int* ids,
+                                                                       const double* factors,
+                                                                       const double* porosity,
+                                                                       const double* sat_liq,
+                                                                       const double* sat_ice,
+                                                                       const double* temp,
+                                                                       double* result)
+{
+  for (int i = 0; i != n; ++i) {
+    int c = ids[i];
+    result[c] = ThermalConductivity_(&factors[3 * c], sat_liq[c], sat_ice[c]);
+  }
 };
 
 void
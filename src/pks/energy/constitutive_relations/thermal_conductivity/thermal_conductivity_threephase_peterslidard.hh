@@ -53,6 +53,7 @@ Example:
 #ifndef PK_ENERGY_RELATIONS_THERMAL_CONDUCTIVITY_THREEPHASE_PETERSLIDARD_HH_
 #define PK_ENERGY_RELATIONS_THERMAL_CONDUCTIVITY_THREEPHASE_PETERSLIDARD_HH_
 
+#include <cmath>
 #include "Teuchos_ParameterList.hpp"
 
 #include "Factory.hh"
@@ -67,9 +68,29 @@ class ThermalConductivityThreePhasePetersLidard : public ThermalConductivityThre
 
   double ThermalConductivity(double porosity, double sat_liq, double sat_ice, double temp);
 
+  // k_dry, k_sat_unfrozen, and k_sat_frozen depend only on porosity.
+  int NumPreparedFactors() override { return 3; }
+  void PrepareFactors(double porosity, double* factors) override;
+  void ThermalConductivityPrepared(int n,
+                                   const int* ids,
+                                   const double* factors,
+                                   const double* porosity,
+                                   const double* sat_liq,
+                                   const double* sat_ice,
+                                   const double* temp,
+                                   double* result) override;
+
  private:
   void InitializeFromPlist_();
 
+  double ThermalConductivity_(const double* factors, double sat_liq, double sat_ice) const
+  {
+    double kersten_u = std::pow(sat_liq + eps_, alpha_u_);
+    double kersten_f = std::pow(sat_ice + eps_, alpha_f_);
+    return kersten_f * factors[2] + kersten_u * factors[1] +
+           (1.0 - kersten_f - kersten_u) * factors[0];
+  }
+
   Teuchos::ParameterList plist_;
 
   double eps_;
@@ -818,10 +818,9 @@ EnergyBase::CalculateConsistentFaces(const Teuchos::Ptr<CompositeVector>& u)
   Epetra_MultiVector& u_f = *u->ViewComponent("face", false);
 
   int f_owned = u_f.MyLength();
+  int cells[2];
   for (int f = 0; f != f_owned; ++f) {
-    AmanziMesh::Entity_ID_List cells;
-    mesh_->face_get_cells(f, AmanziMesh::Parallel_type::ALL, &cells);
-    int ncells = cells.size();
+    int ncells = mesh_geom_->face_cells(f, false, cells);
 
     double face_value = 0.0;
     for (int n = 0; n != ncells; ++n) { face_value += u_c[0][cells[n]]; }
@@ -326,12 +326,12 @@ EnergyBase::ErrorNorm(Teuchos::RCP<const TreeVector> u, Teuchos::RCP<const TreeV
       // error in flux -- relative to cell's extensive conserved quantity
       int nfaces = dvec->size(*comp, false);
 
+      int cells[2];
       for (unsigned int f = 0; f != nfaces; ++f) {
-        AmanziMesh::Entity_ID_List cells;
-        mesh_->face_get_cells(f, AmanziMesh::Parallel_type::OWNED, &cells);
+        int ncells = mesh_geom_->face_cells(f, true, cells);
         double cv_min =
-          cells.size() == 1 ? cv[0][cells[0]] : std::min(cv[0][cells[0]], cv[0][cells[1]]);
-        double mass_min = cells.size() == 1 ? wc[0][cells[0]] / cv[0][cells[0]] :
+          ncells == 1 ? cv[0][cells[0]] : std::min(cv[0][cells[0]], cv[0][cells[1]]);
+        double mass_min = ncells == 1 ? wc[0][cells[0]] / cv[0][cells[0]] :
                                               std::min(wc[0][cells[0]] / cv[0][cells[0]],
                                                        wc[0][cells[1]] / cv[0][cells[1]]);
         mass_min = std::max(mass_min, mass_atol_);
@@ -0,0 +1,88 @@
+/*
+  Copyright 2010-202x held jointly by participating institutions.
+  ATS is released under the three-clause BSD License.
+  The terms of use and "as is" disclaimer for this license are
+  provided in the top-level COPYRIGHT file.
+
+  Authors:
+*/
+
+#include "EvaluatorSecondary.hh"
+#include "State.hh"
+
+#include "evaluation_plan.hh"
+
+namespace Amanzi {
+
+bool
+EvaluationPlan::Update(State& S, const Key& key, const Tag& tag, const Key& request)
+{
+  KeyTag root{ key, tag };
+  auto index = root_index_.find({ root, request });
+  int r = index == root_index_.end() ? Compile_(S, root, request) : index->second;
+
+  // ask this root's leaves, flagging all roots downstream of a changed leaf
+  for (int l : root_leaves_[r]) {
+    const KeyTag& leaf = leaves_[l];
+    if (S.GetEvaluator(leaf.first, leaf.second).Update(S, name_)) {
+      for (int downstream : leaf_roots_[l]) pending_[downstream] = true;
+    }
+  }
+
+  if (!pending_[r]) {
+    num_skipped_++;
+    return false;
+  }
+  pending_[r] = false;
+  num_updated_++;
+  return S.GetEvaluator(key, tag).Update(S, request);
+}
+
+
+// -----------------------------------------------------------------------------
+// Finds the leaves of root's graph, adding them to the plan.
+// -----------------------------------------------------------------------------
+int
+EvaluationPlan::Compile_(State& S, const KeyTag& root, const Key& request)
+{
+  int r = roots_.size();
+  root_index_[{ root, request }] = r;
+  roots_.emplace_back(root);
+  root_leaves_.emplace_back();
+  pending_.push_back(true);
+
+  const Evaluator& root_eval = S.GetEvaluator(root.first, root.second);
+  for (auto entry = S.data_begin(); entry != S.data_end(); ++entry) {
+    for (const auto& rec : *entry->second) {
+      KeyTag keytag{ entry->first, rec.first };
+      if (!S.HasEvaluator(keytag.first, keytag.second)) continue;
+      auto eval = S.GetEvaluatorPtr(keytag.first, keytag.second);
+      if (Teuchos::rcp_dynamic_cast<EvaluatorSecondary>(eval) != Teuchos::null) continue;
+      if (keytag != root && !root_eval.IsDependency(S, keytag.first, keytag.second)) continue;
+
+      auto leaf = leaf_index_.find(keytag);
+      if (leaf == leaf_index_.end()) {
+        leaf = leaf_index_.emplace(keytag, leaves_.size()).first;
+        leaves_.emplace_back(keytag);
+        leaf_roots_.emplace_back();
+      }
+      leaf_roots_[leaf->second].push_back(r);
+      root_leaves_[r].push_back(leaf->second);
+    }
+  }
+  return r;
+}
+
+
+bool
+updateEvaluator(const Teuchos::RCP<EvaluationPlan>& plan,
+                State& S,
+                const Key& key,
+                const Tag& tag,
+                const Key& request)
+{
+  if (plan != Teuchos::null) return plan->Update(S, key, tag, request);
+  return S.GetEvaluator(key, tag).Update(S, request);
+}
+
+} // namespace Amanzi
@@ -0,0 +1,87 @@
+/*
+  Copyright 2010-202x held jointly by participating institutions.
+  ATS is released under the three-clause BSD License.
+  The terms of use and "as is" disclaimer for this license are
+  provided in the top-level COPYRIGHT file.
+
+  Authors:
+*/
+
+/*
+  Skips updates of secondary variables whose inputs have not changed.
+
+  Updating an evaluator walks its whole dependency graph, asking each
+  evaluator whether it has changed, even when nothing upstream has.  A PK that
+  updates the same few keys many times per step, e.g. once per residual, pays
+  for that walk each time.
+
+  An evaluation plan is compiled, per key a PK updates, on the first update
+  through the plan, which must come after State's Setup().  It finds the leaves
+  of the key's graph, i.e. the primary, independent, and other evaluators that
+  are not secondary evaluators, and records, for each leaf, the keys
+  downstream of it.  An update through the plan then asks only the leaves
+  whether they have changed, each of which is a local check, and flags the
+  keys downstream of a changed leaf.  The (recursive) update of the key itself
+  is only done if it is flagged.
+
+  This assumes that secondary evaluators change only when their dependencies
+  change, i.e. that they have no inputs other than those they declare.
+*/
+
+#pragma once
+
+#include <map>
+#include <vector>
+
+#include "Teuchos_RCP.hpp"
+
+#include "Key.hh"
+#include "Tag.hh"
+
+namespace Amanzi {
+
+class State;
+
+class EvaluationPlan {
+ public:
+  // Leaves are asked whether they have changed on behalf of name.
+  explicit EvaluationPlan(const Key& name) : name_(name + " evaluation plan") {}
+
+  // As S.GetEvaluator(key, tag).Update(S, request), returning true if key has
+  // changed since it was last updated on behalf of request.
+  bool Update(State& S, const Key& key, const Tag& tag, const Key& request);
+
+  // Local number of updates done and skipped.
+  int num_updated() const { return num_updated_; }
+  int num_skipped() const { return num_skipped_; }
+
+ private:
+  int Compile_(State& S, const KeyTag& root, const Key& request);
+
+ private:
+  Key name_;
+
+  // roots are keys updated on behalf of a requestor
+  std::map<std::pair<KeyTag, Key>, int> root_index_;
+  std::vector<KeyTag> roots_;
+  std::vector<std::vector<int>> root_leaves_;
+  std::vector<bool> pending_; // a leaf upstream has changed since the last update
+
+  std::map<KeyTag, int> leaf_index_;
+  std::vector<KeyTag> leaves_;
+  std::vector<std::vector<int>> leaf_roots_;
+
+  int num_updated_ = 0;
+  int num_skipped_ = 0;
+};
+
+
+// Updates key at tag on behalf of request, through plan if it is not null.
+bool
+updateEvaluator(const Teuchos::RCP<EvaluationPlan>& plan,
+                State& S,
+                const Key& key,
+                const Tag& tag,
+                const Key& request);
+
+} // namespace Amanzi
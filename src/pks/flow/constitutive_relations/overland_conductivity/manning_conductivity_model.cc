@@ -29,19 +29,35 @@ double
 ManningConductivityModel::Conductivity(double depth, double slope, double coef)
 {
   if (depth <= 0.) return 0.;
-  double scaling = coef * std::sqrt(std::max(slope, slope_regularization_));
-  return depth * std::pow(std::min(depth, depth_max_), manning_exp_) / scaling;
+  return Conductivity_(depth, Scaling(slope, coef));
 }
 
 double
 ManningConductivityModel::DConductivityDDepth(double depth, double slope, double coef)
 {
   if (depth <= 0.) return 0.;
-  double scaling = coef * std::sqrt(std::max(slope, slope_regularization_));
-  if (depth > depth_max_) {
-    return std::pow(depth_max_, manning_exp_) / scaling;
-  } else {
-    return std::pow(depth, manning_exp_) * (manning_exp_ + 1) / scaling;
+  return DConductivityDDepth_(depth, Scaling(slope, coef));
+}
+
+void
+ManningConductivityModel::ConductivityPrepared(int n,
+                                               double depth_factor,
+                                               const double* depth,
+                                               const double* scaling,
+                                               double* result)
+{
+  for (int i = 0; i != n; ++i) result[i] = Conductivity_(depth_factor * depth[i], scaling[i]);
+}
+
+void
+ManningConductivityModel::DConductivityDDepthPrepared(int n,
+                                                      double depth_factor,
+                                                      const double* depth,
+                                                      const double* scaling,
+                                                      double* result)
+{
+  for (int i = 0; i != n; ++i) {
+    result[i] = DConductivityDDepth_(depth_factor * depth[i], scaling[i]);
   }
 }
 
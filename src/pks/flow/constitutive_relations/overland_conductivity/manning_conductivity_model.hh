@@ -16,6 +16,9 @@
 #ifndef AMANZI_FLOWRELATIONS_MANNING_CONDUCTIVITY_MODEL_
 #define AMANZI_FLOWRELATIONS_MANNING_CONDUCTIVITY_MODEL_
 
+#include <algorithm>
+#include <cmath>
+
 #include "Teuchos_ParameterList.hpp"
 
 namespace Amanzi {
@@ -28,7 +31,43 @@ class ManningConductivityModel {
   double Conductivity(double depth, double slope, double coef);
   double DConductivityDDepth(double depth, double slope, double coef);
 
+  // The slope and coefficient dependence, which changes much less often than
+  // depth and may be prepared once per cell and reused.
+  double Scaling(double slope, double coef)
+  {
+    return coef * std::sqrt(std::max(slope, slope_regularization_));
+  }
+
+  // Conductivity and its depth derivative of n entities with depth
+  // depth_factor * depth[i], given their prepared scaling.
+  void ConductivityPrepared(int n,
+                            double depth_factor,
+                            const double* depth,
+                            const double* scaling,
+                            double* result);
+  void DConductivityDDepthPrepared(int n,
+                                   double depth_factor,
+                                   const double* depth,
+                                   const double* scaling,
+                                   double* result);
+
  protected:
+  double Conductivity_(double depth, double scaling)
+  {
+    if (depth <= 0.) return 0.;
+    return depth * std::pow(std::min(depth, depth_max_), manning_exp_) / scaling;
+  }
+
+  double DConductivityDDepth_(double depth, double scaling)
+  {
+    if (depth <= 0.) return 0.;
+    if (depth > depth_max_) {
+      return std::pow(depth_max_, manning_exp_) / scaling;
+    } else {
+      return std::pow(depth, manning_exp_) * (manning_exp_ + 1) / scaling;
+    }
+  }
+
   double slope_regularization_;
   double manning_exp_;
   double depth_max_;
@@ -12,6 +12,8 @@
 
 */
 
+#include <limits>
+
 #include "Mesh_Algorithms.hh"
 #include "overland_conductivity_evaluator.hh"
 #include "manning_conductivity_model.hh"
@@ -108,18 +110,9 @@ OverlandConductivityEvaluator::Evaluate_(const State& S,
     Epetra_MultiVector& result_v = *result[0]->ViewComponent(comp, false);
 
     int ncomp = result[0]->size(comp, false);
-    if (dt_swe_factor_ > 0) {
-      for (int i = 0; i != ncomp; ++i) {
-        int ii = is_internal_comp ? AmanziMesh::getBoundaryFaceInternalCell(mesh, i) : i;
-        double new_snow = dt_swe_factor_ * depth_v[0][i];
-        result_v[0][i] = model_->Conductivity(new_snow, slope_v[0][ii], coef_v[0][ii]);
-      }
-    } else {
-      for (int i = 0; i != ncomp; ++i) {
-        int ii = is_internal_comp ? AmanziMesh::getBoundaryFaceInternalCell(mesh, i) : i;
-        result_v[0][i] = model_->Conductivity(depth_v[0][i], slope_v[0][ii], coef_v[0][ii]);
-      }
-    }
+    const auto& scaling = PrepareScaling_(mesh, comp, ncomp, slope_v, coef_v);
+    double depth_factor = dt_swe_factor_ > 0 ? dt_swe_factor_ : 1.;
+    model_->ConductivityPrepared(ncomp, depth_factor, depth_v[0], scaling.data(), result_v[0]);
 
     if (dens_) {
       const Epetra_MultiVector& dens_v =
@@ -159,19 +152,13 @@ OverlandConductivityEvaluator::EvaluatePartialDerivative_(
       Epetra_MultiVector& result_v = *result[0]->ViewComponent(comp, false);
 
       int ncomp = result[0]->size(comp, false);
+      const auto& scaling = PrepareScaling_(mesh, comp, ncomp, slope_v, coef_v);
       if (dt_swe_factor_ > 0.) {
-        for (int i = 0; i != ncomp; ++i) {
-          int ii = is_internal_comp ? AmanziMesh::getBoundaryFaceInternalCell(mesh, i) : i;
-          double new_snow = dt_swe_factor_ * depth_v[0][i];
-          result_v[0][i] =
-            model_->DConductivityDDepth(new_snow, slope_v[0][ii], coef_v[0][ii]) * dt_swe_factor_;
-        }
+        model_->DConductivityDDepthPrepared(
+          ncomp, dt_swe_factor_, depth_v[0], scaling.data(), result_v[0]);
+        for (int i = 0; i != ncomp; ++i) result_v[0][i] *= dt_swe_factor_;
       } else {
-        for (int i = 0; i != ncomp; ++i) {
-          int ii = is_internal_comp ? AmanziMesh::getBoundaryFaceInternalCell(mesh, i) : i;
-          result_v[0][i] =
-            model_->DConductivityDDepth(depth_v[0][i], slope_v[0][ii], coef_v[0][ii]);
-        }
+        model_->DConductivityDDepthPrepared(ncomp, 1., depth_v[0], scaling.data(), result_v[0]);
       }
 
       if (dens_) {
@@ -196,18 +183,9 @@ OverlandConductivityEvaluator::EvaluatePartialDerivative_(
       Epetra_MultiVector& result_v = *result[0]->ViewComponent(comp, false);
 
       int ncomp = result[0]->size(comp, false);
-      if (dt_swe_factor_ > 0.) {
-        for (int i = 0; i != ncomp; ++i) {
-          int ii = is_internal_comp ? AmanziMesh::getBoundaryFaceInternalCell(mesh, i) : i;
-          double new_snow = dt_swe_factor_ * depth_v[0][i];
-          result_v[0][i] = model_->Conductivity(new_snow, slope_v[0][ii], coef_v[0][ii]);
-        }
-      } else {
-        for (int i = 0; i != ncomp; ++i) {
-          int ii = is_internal_comp ? AmanziMesh::getBoundaryFaceInternalCell(mesh, i) : i;
-          result_v[0][i] = model_->Conductivity(depth_v[0][i], slope_v[0][ii], coef_v[0][ii]);
-        }
-      }
+      const auto& scaling = PrepareScaling_(mesh, comp, ncomp, slope_v, coef_v);
+      double depth_factor = dt_swe_factor_ > 0. ? dt_swe_factor_ : 1.;
+      model_->ConductivityPrepared(ncomp, depth_factor, depth_v[0], scaling.data(), result_v[0]);
     }
 
   } else {
@@ -217,6 +195,39 @@ OverlandConductivityEvaluator::EvaluatePartialDerivative_(
 }
 
 
+const std::vector<double>&
+OverlandConductivityEvaluator::PrepareScaling_(const AmanziMesh::Mesh& mesh,
+                                               const std::string& comp,
+                                               int ncomp,
+                                               const Epetra_MultiVector& slope,
+                                               const Epetra_MultiVector& coef)
+{
+  // slope and coefficient are only defined on cells, boundary faces use the
+  // internal cell
+  bool is_internal_comp = comp == "boundary_face";
+
+  auto& prep = prepared_[comp];
+  if (prep.scaling.size() != (std::size_t)ncomp) {
+    prep.slope.assign(ncomp, std::numeric_limits<double>::quiet_NaN());
+    prep.coef.assign(ncomp, std::numeric_limits<double>::quiet_NaN());
+    prep.scaling.resize(ncomp);
+    prep.cell.resize(ncomp);
+    for (int i = 0; i != ncomp; ++i)
+      prep.cell[i] = is_internal_comp ? AmanziMesh::getBoundaryFaceInternalCell(mesh, i) : i;
+  }
+
+  for (int i = 0; i != ncomp; ++i) {
+    int ii = prep.cell[i];
+    if (slope[0][ii] != prep.slope[i] || coef[0][ii] != prep.coef[i]) {
+      prep.scaling[i] = model_->Scaling(slope[0][ii], coef[0][ii]);
+      prep.slope[i] = slope[0][ii];
+      prep.coef[i] = coef[0][ii];
+    }
+  }
+  return prep.scaling;
+}
+
+
 void
 OverlandConductivityEvaluator::EnsureCompatibility_ToDeps_(State& S)
 {
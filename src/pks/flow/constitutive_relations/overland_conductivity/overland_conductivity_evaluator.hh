@@ -47,6 +47,8 @@ some extra factors (timestep size) to ensure the correct flow law in that case.
 */
 #pragma once
 
+#include <map>
+
 #include "Factory.hh"
 #include "EvaluatorSecondaryMonotype.hh"
 
@@ -74,8 +76,24 @@ class OverlandConductivityEvaluator : public EvaluatorSecondaryMonotypeCV {
   virtual void EnsureCompatibility_ToDeps_(State& S) override;
 
  private:
+  // Updates the Manning scaling of each of the ncomp entities of comp whose
+  // slope or coefficient changed since it was prepared, and returns it.
+  const std::vector<double>& PrepareScaling_(const AmanziMesh::Mesh& mesh,
+                                             const std::string& comp,
+                                             int ncomp,
+                                             const Epetra_MultiVector& slope,
+                                             const Epetra_MultiVector& coef);
+
   Teuchos::RCP<ManningConductivityModel> model_;
 
+  struct PreparedScaling {
+    std::vector<int> cell; // cell of the slope and coefficient
+    std::vector<double> slope;
+    std::vector<double> coef;
+    std::vector<double> scaling;
+  };
+  std::map<std::string, PreparedScaling> prepared_;
+
   Key mobile_depth_key_;
   Key slope_key_;
   Key coef_key_;
@@ -1036,11 +1036,9 @@ OverlandPressureFlow::UpdateBoundaryConditions_(const Tag& tag)
 
   // check that there are no internal faces and mark all remaining boundary
   // conditions as the default, zero flux conditions
-  int nfaces_owned = mesh_->num_entities(AmanziMesh::FACE, AmanziMesh::Parallel_type::OWNED);
+  int nfaces_owned = mesh_geom_->num_faces_owned();
   for (int f = 0; f != nfaces_owned; ++f) {
-    AmanziMesh::Entity_ID_List cells;
-    mesh_->face_get_cells(f, AmanziMesh::Parallel_type::ALL, &cells);
-    int ncells = cells.size();
+    int ncells = mesh_geom_->face_cell(f, 1) < 0 ? 1 : 2;
 
     if ((markers[f] != Operators::OPERATOR_BC_NONE) && (ncells == 2)) {
       Errors::Message msg("Tried to set a boundary condition on internal face GID ");
@@ -162,16 +162,8 @@ Preferential::UpdatePermeabilityData_(const Tag& tag)
 
         for (int f = 0; f != markers.size(); ++f) {
           if (markers[f] == Operators::OPERATOR_BC_NEUMANN) {
-            AmanziMesh::Entity_ID_List cells;
-            mesh_->face_get_cells(f, AmanziMesh::Parallel_type::ALL, &cells);
-            AMANZI_ASSERT(cells.size() == 1);
-            int c = cells[0];
-            AmanziMesh::Entity_ID_List faces;
-            std::vector<int> dirs;
-            mesh_->cell_get_faces_and_dirs(c, &faces, &dirs);
-            int i = std::find(faces.begin(), faces.end(), f) - faces.begin();
-
-            flux_dir_f[0][f] = values[f] * dirs[i];
+            AMANZI_ASSERT(mesh_geom_->face_cell(f, 1) < 0);
+            flux_dir_f[0][f] = values[f] * mesh_geom_->face_dir(f, 0);
           }
         }
       }
@@ -215,17 +207,13 @@ Preferential::UpdatePermeabilityData_(const Tag& tag)
       Epetra_MultiVector& uw_rel_perm_f = *uw_rel_perm->ViewComponent("face", false);
       const Epetra_MultiVector& pres =
         *S_->Get<CompositeVector>(key_, tag).ViewComponent("cell", false);
-      const auto& fmap = mesh_->face_map(true);
-      const auto& bfmap = mesh_->exterior_face_map(true);
       for (int bf = 0; bf != rel_perm_bf.MyLength(); ++bf) {
-        auto f = fmap.LID(bfmap.GID(bf));
-        AmanziMesh::Entity_ID_List fcells;
-        mesh_->face_get_cells(f, AmanziMesh::Parallel_type::ALL, &fcells);
-        AMANZI_ASSERT(fcells.size() == 1);
-        if (pres[0][fcells[0]] < 101225.) {
+        int f = mesh_geom_->boundary_face_face(bf);
+        int c = mesh_geom_->boundary_face_cell(bf);
+        if (pres[0][c] < 101225.) {
           uw_rel_perm_f[0][f] = rel_perm_bf[0][bf];
-        } else if (pres[0][fcells[0]] < 101325.) {
-          double frac = (101325. - pres[0][fcells[0]]) / 100.;
+        } else if (pres[0][c] < 101325.) {
+          double frac = (101325. - pres[0][c]) / 100.;
           uw_rel_perm_f[0][f] = rel_perm_bf[0][bf] * frac + uw_rel_perm_f[0][f] * (1 - frac);
         }
       }
@@ -36,7 +36,7 @@ Richards::ApplyDiffusion_(const Tag& tag, const Teuchos::Ptr<CompositeVector>& g
   // update the matrix
   matrix_->Init();
 
-  S_->GetEvaluator(mass_dens_key_, tag).Update(*S_, name_);
+  UpdateEvaluator_(mass_dens_key_, tag);
   matrix_diff_->SetDensity(S_->GetPtr<CompositeVector>(mass_dens_key_, tag));
   matrix_diff_->SetScalarCoefficient(S_->GetPtr<CompositeVector>(uw_coef_key_, tag), Teuchos::null);
 
@@ -135,7 +135,7 @@ void
 Richards::SetAbsolutePermeabilityTensor_(const Tag& tag)
 {
   // currently assumes isotropic perm, should be updated
-  S_->GetEvaluator(perm_key_, tag).Update(*S_, name_);
+  UpdateEvaluator_(perm_key_, tag);
   const Epetra_MultiVector& perm =
     *S_->Get<CompositeVector>(perm_key_, tag).ViewComponent("cell", false);
   unsigned int ncells = perm.MyLength();
@@ -791,12 +791,12 @@ Richards::UpdatePermeabilityData_(const Tag& tag)
   if (fixed_kr_) return false;
 
   Teuchos::RCP<const CompositeVector> rel_perm = S_->GetPtr<CompositeVector>(coef_key_, tag);
-  bool update_perm = S_->GetEvaluator(coef_key_, tag).Update(*S_, name_);
+  bool update_perm = UpdateEvaluator_(coef_key_, tag);
 
   // requirements due to the upwinding method
   if (Krel_method_ == Operators::UPWIND_METHOD_TOTAL_FLUX) {
-    bool update_dir = S_->GetEvaluator(mass_dens_key_, tag).Update(*S_, name_);
-    update_dir |= S_->GetEvaluator(key_, tag).Update(*S_, name_);
+    bool update_dir = UpdateEvaluator_(mass_dens_key_, tag);
+    update_dir |= UpdateEvaluator_(key_, tag);
 
     if (update_dir) {
       // update the direction of the flux -- note this is NOT the flux
@@ -821,16 +821,8 @@ Richards::UpdatePermeabilityData_(const Tag& tag)
 
         for (int f = 0; f != markers.size(); ++f) {
           if (markers[f] == Operators::OPERATOR_BC_NEUMANN) {
-            AmanziMesh::Entity_ID_List cells;
-            mesh_->face_get_cells(f, AmanziMesh::Parallel_type::ALL, &cells);
-            AMANZI_ASSERT(cells.size() == 1);
-            int c = cells[0];
-            AmanziMesh::Entity_ID_List faces;
-            std::vector<int> dirs;
-            mesh_->cell_get_faces_and_dirs(c, &faces, &dirs);
-            int i = std::find(faces.begin(), faces.end(), f) - faces.begin();
-
-            flux_dir_f[0][f] = values[f] * dirs[i];
+            AMANZI_ASSERT(mesh_geom_->face_cell(f, 1) < 0);
+            flux_dir_f[0][f] = values[f] * mesh_geom_->face_dir(f, 0);
           }
         }
       }
@@ -870,17 +862,13 @@ Richards::UpdatePermeabilityData_(const Tag& tag)
       Epetra_MultiVector& uw_rel_perm_f = *uw_rel_perm->ViewComponent("face", false);
       const Epetra_MultiVector& pres =
         *S_->Get<CompositeVector>(key_, tag).ViewComponent("cell", false);
-      const auto& fmap = mesh_->face_map(true);
-      const auto& bfmap = mesh_->exterior_face_map(true);
       for (int bf = 0; bf != rel_perm_bf.MyLength(); ++bf) {
-        auto f = fmap.LID(bfmap.GID(bf));
-        AmanziMesh::Entity_ID_List fcells;
-        mesh_->face_get_cells(f, AmanziMesh::Parallel_type::ALL, &fcells);
-        AMANZI_ASSERT(fcells.size() == 1);
-        if (pres[0][fcells[0]] < 101225.) {
+        int f = mesh_geom_->boundary_face_face(bf);
+        int c = mesh_geom_->boundary_face_cell(bf);
+        if (pres[0][c] < 101225.) {
           uw_rel_perm_f[0][f] = rel_perm_bf[0][bf];
-        } else if (pres[0][fcells[0]] < 101325.) {
-          double frac = (101325. - pres[0][fcells[0]]) / 100.;
+        } else if (pres[0][c] < 101325.) {
+          double frac = (101325. - pres[0][c]) / 100.;
           uw_rel_perm_f[0][f] = rel_perm_bf[0][bf] * frac + uw_rel_perm_f[0][f] * (1 - frac);
         }
       }
@@ -1215,6 +1203,7 @@ Richards::UpdateBoundaryConditions_(const Tag& tag, bool kr)
       *S_->Get<CompositeVector>(ss_flux_key_, tag).ViewComponent("cell", false);
     unsigned int ncells_surface = ss_flux.MyLength();
     bc_counts[bc_counts.size() - 1] = ncells_surface;
+    const auto& face_areas = mesh_geom_->face_areas();
     for (unsigned int c = 0; c != ncells_surface; ++c) {
       // -- get the surface cell's equivalent subsurface face
       AmanziMesh::Entity_ID f = surface->entity_get_parent(AmanziMesh::CELL, c);
@@ -1230,22 +1219,18 @@ Richards::UpdateBoundaryConditions_(const Tag& tag, bool kr)
       //       as Neumann BCs are in units of mols / s / A.  The right A must
       //       be chosen, as it is the subsurface mesh's face area, not the
       //       surface mesh's cell area.
-      values[f] = ss_flux[0][c] / mesh_->face_area(f);
+      values[f] = ss_flux[0][c] / face_areas[f];
 
       if (!kr && rel_perm[0][f] > 0.) values[f] /= rel_perm[0][f];
     }
   }
 
   // mark all remaining boundary conditions as zero flux conditions
-  AmanziMesh::Entity_ID_List cells;
   int n_default = 0;
-  int nfaces_owned = mesh_->num_entities(AmanziMesh::FACE, AmanziMesh::Parallel_type::OWNED);
+  int nfaces_owned = mesh_geom_->num_faces_owned();
   for (int f = 0; f < nfaces_owned; f++) {
     if (markers[f] == Operators::OPERATOR_BC_NONE) {
-      mesh_->face_get_cells(f, AmanziMesh::Parallel_type::ALL, &cells);
-      int ncells = cells.size();
-
-      if (ncells == 1) {
+      if (mesh_geom_->face_cell(f, 1) < 0) {
         n_default++;
         markers[f] = Operators::OPERATOR_BC_NEUMANN;
         values[f] = 0.0;
@@ -1400,10 +1385,9 @@ Richards::CalculateConsistentFaces(const Teuchos::Ptr<CompositeVector>& u)
   Epetra_MultiVector& u_f = *u->ViewComponent("face", false);
 
   int f_owned = u_f.MyLength();
+  int cells[2];
   for (int f = 0; f != f_owned; ++f) {
-    AmanziMesh::Entity_ID_List cells;
-    mesh_->face_get_cells(f, AmanziMesh::Parallel_type::ALL, &cells);
-    int ncells = cells.size();
+    int ncells = mesh_geom_->face_cells(f, false, cells);
 
     double face_value = 0.0;
     for (int n = 0; n != ncells; ++n) { face_value += u_c[0][cells[n]]; }
@@ -0,0 +1,124 @@
+/*
+  Copyright 2010-202x held jointly by participating institutions.
+  ATS is released under the three-clause BSD License.
+  The terms of use and "as is" disclaimer for this license are
+  provided in the top-level COPYRIGHT file.
+
+  Authors:
+*/
+
+#include <algorithm>
+
+#include "errors.hh"
+#include "mesh_geometry_cache.hh"
+
+namespace Amanzi {
+
+std::map<const AmanziMesh::Mesh*, Teuchos::RCP<MeshGeometryCache>> MeshGeometryCache::caches_;
+std::mutex MeshGeometryCache::caches_mutex_;
+std::size_t MeshGeometryCache::caches_swept_size_ = 8;
+
+
+MeshGeometryCache::MeshGeometryCache(const Teuchos::RCP<const AmanziMesh::Mesh>& mesh)
+  : mesh_(mesh), geometry_valid_(false)
+{
+  ncells_owned_ = mesh_->num_entities(AmanziMesh::CELL, AmanziMesh::Parallel_type::OWNED);
+  ncells_ = mesh_->num_entities(AmanziMesh::CELL, AmanziMesh::Parallel_type::ALL);
+  nfaces_owned_ = mesh_->num_entities(AmanziMesh::FACE, AmanziMesh::Parallel_type::OWNED);
+  nfaces_ = mesh_->num_entities(AmanziMesh::FACE, AmanziMesh::Parallel_type::ALL);
+
+  // face to cells
+  face_cells_.assign(2 * nfaces_, -1);
+  AmanziMesh::Entity_ID_List cells;
+  for (int f = 0; f != nfaces_; ++f) {
+    mesh_->face_get_cells(f, AmanziMesh::Parallel_type::ALL, &cells);
+    AMANZI_ASSERT(cells.size() > 0 && cells.size() <= 2);
+    for (int i = 0; i != cells.size(); ++i) face_cells_[2 * f + i] = cells[i];
+  }
+
+  // direction and local index of each face in its cells
+  face_dirs_.assign(2 * nfaces_, 0);
+  face_local_.assign(2 * nfaces_, -1);
+  AmanziMesh::Entity_ID_List faces;
+  std::vector<int> dirs;
+  for (int c = 0; c != ncells_; ++c) {
+    mesh_->cell_get_faces_and_dirs(c, &faces, &dirs);
+    for (int n = 0; n != faces.size(); ++n) {
+      int f = faces[n];
+      int i = face_cells_[2 * f] == c ? 0 : 1;
+      AMANZI_ASSERT(face_cells_[2 * f + i] == c);
+      face_dirs_[2 * f + i] = dirs[n];
+      face_local_[2 * f + i] = n;
+    }
+  }
+
+  // boundary faces
+  const auto& fmap = mesh_->face_map(true);
+  const auto& bfmap = mesh_->exterior_face_map(true);
+  bface_face_.resize(bfmap.NumMyElements());
+  for (int bf = 0; bf != bface_face_.size(); ++bf) {
+    bface_face_[bf] = fmap.LID(bfmap.GID(bf));
+    AMANZI_ASSERT(bface_face_[bf] >= 0);
+  }
+}
+
+
+Teuchos::RCP<MeshGeometryCache>
+MeshGeometryCache::Get(const Teuchos::RCP<const AmanziMesh::Mesh>& mesh)
+{
+  // Only weak references are kept, so that caches (and the meshes they
+  // reference) are released with their last user, e.g. at the end of an
+  // ensemble member.  A live cache keeps its mesh, and so its address, alive.
+  std::lock_guard<std::mutex> lock(caches_mutex_);
+  auto entry = caches_.find(mesh.get());
+  if (entry != caches_.end() && entry->second.is_valid_ptr()) return entry->second.create_strong();
+
+  // Drop the entries of caches since released when inserting, once the map
+  // has doubled since the last sweep, so that setting up many meshes (e.g.
+  // columns) costs O(N log N) rather than O(N^2).
+  if (caches_.size() >= 2 * caches_swept_size_) {
+    for (auto it = caches_.begin(); it != caches_.end();) {
+      if (it->second.is_valid_ptr()) {
+        ++it;
+      } else {
+        it = caches_.erase(it);
+      }
+    }
+    caches_swept_size_ = std::max<std::size_t>(caches_.size(), 8);
+  }
+
+  auto cache = Teuchos::rcp(new MeshGeometryCache(mesh));
+  caches_[mesh.get()] = cache.create_weak();
+  return cache;
+}
+
+
+void
+MeshGeometryCache::Invalidate(const AmanziMesh::Mesh& mesh)
+{
+  std::lock_guard<std::mutex> lock(caches_mutex_);
+  auto entry = caches_.find(&mesh);
+  if (entry != caches_.end() && entry->second.is_valid_ptr()) {
+    auto cache = entry->second.create_strong();
+    std::lock_guard<std::mutex> geometry_lock(cache->geometry_mutex_);
+    cache->geometry_valid_.store(false, std::memory_order_release);
+  }
+}
+
+
+void
+MeshGeometryCache::UpdateGeometry_() const
+{
+  // the first thread to get here computes the geometry, others wait
+  std::lock_guard<std::mutex> lock(geometry_mutex_);
+  if (geometry_valid_.load(std::memory_order_relaxed)) return;
+
+  cell_volumes_.resize(ncells_);
+  for (int c = 0; c != ncells_; ++c) cell_volumes_[c] = mesh_->cell_volume(c);
+
+  face_areas_.resize(nfaces_);
+  for (int f = 0; f != nfaces_; ++f) face_areas_[f] = mesh_->face_area(f);
+  geometry_valid_.store(true, std::memory_order_release);
+}
+
+} // namespace Amanzi
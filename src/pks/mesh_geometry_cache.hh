@@ -0,0 +1,124 @@
+/*
+  Copyright 2010-202x held jointly by participating institutions.
+  ATS is released under the three-clause BSD License.
+  The terms of use and "as is" disclaimer for this license are
+  provided in the top-level COPYRIGHT file.
+
+  Authors:
+*/
+
+/*
+  Flat arrays of mesh geometry and face topology for hot loops in PKs.
+
+  Querying the mesh per entity is a virtual call, and topology queries fill a
+  small vector.  This caches, on all (owned and ghosted) entities:
+
+  - cell volumes and face areas,
+  - the (up to) two cells of each face, the face's direction relative to each
+    cell's outward normal, and its local index in each cell,
+  - for each boundary face, in the order of the exterior face map, the face
+    and its interior cell.
+
+  Caches are shared by all users of a mesh, see Get(), and are destroyed with
+  their last user.  Topology is fixed, but geometry changes when the mesh
+  deforms; whatever deforms a mesh (or restores its coordinates) must call
+  Invalidate(), and geometry is recomputed on the next access.  Hot loops
+  should grab the arrays once, outside of the loop.
+
+  Get(), Invalidate() and the (lazy) geometry accessors are thread-safe, but
+  meshes must not be deformed while their geometry is being read.
+*/
+
+#pragma once
+
+#include <atomic>
+#include <map>
+#include <mutex>
+#include <vector>
+
+#include "Teuchos_RCP.hpp"
+#include "Mesh.hh"
+
+namespace Amanzi {
+
+class MeshGeometryCache {
+ public:
+  explicit MeshGeometryCache(const Teuchos::RCP<const AmanziMesh::Mesh>& mesh);
+
+  // The cache for mesh, constructing it if it is not in use.
+  static Teuchos::RCP<MeshGeometryCache> Get(const Teuchos::RCP<const AmanziMesh::Mesh>& mesh);
+
+  // Marks the geometry of mesh, if cached, as out of date.
+  static void Invalidate(const AmanziMesh::Mesh& mesh);
+
+  int num_cells_owned() const { return ncells_owned_; }
+  int num_cells() const { return ncells_; }
+  int num_faces_owned() const { return nfaces_owned_; }
+  int num_faces() const { return nfaces_; }
+  int num_boundary_faces() const { return bface_face_.size(); }
+
+  // geometry
+  const std::vector<double>& cell_volumes() const
+  {
+    if (!geometry_valid_.load(std::memory_order_acquire)) UpdateGeometry_();
+    return cell_volumes_;
+  }
+  const std::vector<double>& face_areas() const
+  {
+    if (!geometry_valid_.load(std::memory_order_acquire)) UpdateGeometry_();
+    return face_areas_;
+  }
+
+  // Cells of face f, as in face_get_cells(): the number of cells, which are
+  // written into cells.  If owned, only owned cells are returned.
+  int face_cells(int f, bool owned, int cells[2]) const
+  {
+    int n = 0;
+    for (int i = 0; i != 2; ++i) {
+      int c = face_cells_[2 * f + i];
+      if (c >= 0 && (!owned || c < ncells_owned_)) cells[n++] = c;
+    }
+    return n;
+  }
+
+  // The i-th cell of face f (i = 0, 1), or -1 for the missing neighbor of a
+  // boundary face.
+  int face_cell(int f, int i) const { return face_cells_[2 * f + i]; }
+
+  // Direction of face f relative to the outward normal of its i-th cell, as
+  // returned by cell_get_faces_and_dirs().
+  int face_dir(int f, int i) const { return face_dirs_[2 * f + i]; }
+
+  // Index of face f in the face list of its i-th cell.
+  int face_local_index(int f, int i) const { return face_local_[2 * f + i]; }
+
+  // boundary faces, indexed as in exterior_face_map(true)
+  int boundary_face_face(int bf) const { return bface_face_[bf]; }
+  int boundary_face_cell(int bf) const { return face_cells_[2 * bface_face_[bf]]; }
+
+ private:
+  void UpdateGeometry_() const;
+
+ private:
+  Teuchos::RCP<const AmanziMesh::Mesh> mesh_;
+
+  int ncells_owned_, ncells_;
+  int nfaces_owned_, nfaces_;
+
+  mutable std::atomic<bool> geometry_valid_;
+  mutable std::mutex geometry_mutex_;
+  mutable std::vector<double> cell_volumes_;
+  mutable std::vector<double> face_areas_;
+
+  std::vector<int> face_cells_;
+  std::vector<int> face_dirs_;
+  std::vector<int> face_local_;
+  std::vector<int> bface_face_;
+
+  // weak references, keyed by mesh
+  static std::map<const AmanziMesh::Mesh*, Teuchos::RCP<MeshGeometryCache>> caches_;
+  static std::mutex caches_mutex_;
+  static std::size_t caches_swept_size_; // size after the last sweep
+};
+
+} // namespace Amanzi
@@ -0,0 +1,154 @@
+/*
+  Copyright 2010-202x held jointly by participating institutions.
+  ATS is released under the three-clause BSD License.
+  The terms of use and "as is" disclaimer for this license are
+  provided in the top-level COPYRIGHT file.
+
+  Authors:
+*/
+
+#include <cmath>
+#include <utility>
+#include <vector>
+
+#include "errors.hh"
+#include "anderson_accelerator.hh"
+
+namespace Amanzi {
+
+AndersonAccelerator::AndersonAccelerator(int depth, double relaxation)
+  : depth_(depth), beta_(relaxation)
+{
+  if (depth_ < 0 || beta_ <= 0.) {
+    Errors::Message msg("AndersonAccelerator: depth must be >= 0 and relaxation must be > 0.");
+    Exceptions::amanzi_throw(msg);
+  }
+}
+
+
+void
+AndersonAccelerator::Reset()
+{
+  x_prev_ = Teuchos::null;
+  dX_.clear();
+  dR_.clear();
+}
+
+
+void
+AndersonAccelerator::Update(Epetra_MultiVector& x, const Epetra_MultiVector& g)
+{
+  if (r_ == Teuchos::null) {
+    r_ = Teuchos::rcp(new Epetra_MultiVector(x));
+    r_prev_ = Teuchos::rcp(new Epetra_MultiVector(x));
+  }
+  r_->Update(1., g, -1., x, 0.);
+
+  // differences with the previous iterate, reusing the oldest vectors
+  if (depth_ > 0 && x_prev_ != Teuchos::null) {
+    Teuchos::RCP<Epetra_MultiVector> dx, dr;
+    if ((int)dX_.size() == depth_) {
+      dx = dX_.front();
+      dr = dR_.front();
+      dX_.pop_front();
+      dR_.pop_front();
+    } else {
+      dx = Teuchos::rcp(new Epetra_MultiVector(x));
+      dr = Teuchos::rcp(new Epetra_MultiVector(x));
+    }
+    dx->Update(1., x, -1., *x_prev_, 0.);
+    dr->Update(1., *r_, -1., *r_prev_, 0.);
+    dX_.push_back(dx);
+    dR_.push_back(dr);
+  }
+  if (x_prev_ == Teuchos::null) x_prev_ = Teuchos::rcp(new Epetra_MultiVector(x));
+  *x_prev_ = x;
+  *r_prev_ = *r_;
+
+  // least squares for gamma, by the (small) normal equations
+  int m = dR_.size();
+  std::vector<double> A(m * m), gamma(m);
+  for (int i = 0; i != m; ++i) {
+    for (int j = 0; j <= i; ++j) A[i * m + j] = A[j * m + i] = Dot_(*dR_[i], *dR_[j]);
+    gamma[i] = Dot_(*dR_[i], *r_);
+  }
+  double trace = 0.;
+  for (int i = 0; i != m; ++i) trace += A[i * m + i];
+  for (int i = 0; i != m; ++i) A[i * m + i] += 1.e-12 * trace + 1.e-300;
+
+  // Gaussian elimination with partial pivoting
+  for (int k = 0; k != m; ++k) {
+    int p = k;
+    for (int i = k + 1; i != m; ++i)
+      if (std::abs(A[i * m + k]) > std::abs(A[p * m + k])) p = i;
+    if (p != k) {
+      for (int j = 0; j != m; ++j) std::swap(A[k * m + j], A[p * m + j]);
+      std::swap(gamma[k], gamma[p]);
+    }
+    for (int i = k + 1; i != m; ++i) {
+      double f = A[i * m + k] / A[k * m + k];
+      for (int j = k; j != m; ++j) A[i * m + j] -= f * A[k * m + j];
+      gamma[i] -= f * gamma[k];
+    }
+  }
+  for (int i = m - 1; i >= 0; --i) {
+    for (int j = i + 1; j != m; ++j) gamma[i] -= A[i * m + j] * gamma[j];
+    gamma[i] /= A[i * m + i];
+  }
+
+  // next iterate
+  x.Update(beta_, *r_, 1.);
+  for (int i = 0; i != m; ++i) x.Update(-gamma[i], *dX_[i], -gamma[i] * beta_, *dR_[i], 1.);
+}
+
+
+std::vector<Teuchos::RCP<const Epetra_MultiVector>>
+AndersonAccelerator::history() const
+{
+  std::vector<Teuchos::RCP<const Epetra_MultiVector>> history;
+  if (x_prev_ == Teuchos::null) return history;
+  history.push_back(x_prev_);
+  history.push_back(r_prev_);
+  for (int i = 0; i != dX_.size(); ++i) {
+    history.push_back(dX_[i]);
+    history.push_back(dR_[i]);
+  }
+  return history;
+}
+
+
+void
+AndersonAccelerator::set_history(
+  const std::vector<Teuchos::RCP<const Epetra_MultiVector>>& history)
+{
+  int m = ((int)history.size() - 2) / 2;
+  if (history.size() % 2 != 0 || m > depth_) {
+    Errors::Message msg;
+    msg << "AndersonAccelerator: a history of depth " << depth_ << " has 0 or 2 to "
+        << 2 * (depth_ + 1) << " vectors, not " << history.size() << ".";
+    Exceptions::amanzi_throw(msg);
+  }
+
+  Reset();
+  if (history.empty()) return;
+  x_prev_ = Teuchos::rcp(new Epetra_MultiVector(*history[0]));
+  r_prev_ = Teuchos::rcp(new Epetra_MultiVector(*history[1]));
+  r_ = Teuchos::rcp(new Epetra_MultiVector(*history[1]));
+  for (int i = 0; i != m; ++i) {
+    dX_.push_back(Teuchos::rcp(new Epetra_MultiVector(*history[2 + 2 * i])));
+    dR_.push_back(Teuchos::rcp(new Epetra_MultiVector(*history[3 + 2 * i])));
+  }
+}
+
+
+double
+AndersonAccelerator::Dot_(const Epetra_MultiVector& a, const Epetra_MultiVector& b)
+{
+  std::vector<double> dots(a.NumVectors());
+  a.Dot(b, dots.data());
+  double dot = 0.;
+  for (double d : dots) dot += d;
+  return dot;
+}
+
+} // namespace Amanzi
@@ -0,0 +1,70 @@
+/*
+  Copyright 2010-202x held jointly by participating institutions.
+  ATS is released under the three-clause BSD License.
+  The terms of use and "as is" disclaimer for this license are
+  provided in the top-level COPYRIGHT file.
+
+  Authors:
+*/
+
+/*
+  Anderson acceleration of a fixed point iteration x = G(x).
+
+  Given the current iterate x_k and its image g_k = G(x_k), with residual
+  r_k = g_k - x_k, the next iterate is
+
+    x_{k+1} = x_k + beta r_k - sum_i gamma_i (dX_i + beta dR_i)
+
+  where dX_i and dR_i are the differences of the last (up to) m iterates and
+  residuals, and gamma minimizes | r_k - sum_i gamma_i dR_i |.  With m = 0
+  this is a relaxed fixed point (Picard) iteration.
+
+  Vectors are Epetra_MultiVectors of the same map; dot products are global,
+  summed over all vectors.
+*/
+
+#ifndef ATS_MPC_ANDERSON_ACCELERATOR_HH_
+#define ATS_MPC_ANDERSON_ACCELERATOR_HH_
+
+#include <deque>
+#include <vector>
+
+#include "Teuchos_RCP.hpp"
+#include "Epetra_MultiVector.h"
+
+namespace Amanzi {
+
+class AndersonAccelerator {
+ public:
+  // depth is m above, relaxation is beta.
+  AndersonAccelerator(int depth, double relaxation);
+
+  // Forgets all previous iterates, e.g. to start a new fixed point solve.
+  void Reset();
+
+  // Given the current iterate x and g = G(x), overwrites x with the next
+  // iterate.
+  void Update(Epetra_MultiVector& x, const Epetra_MultiVector& g);
+
+  // The history, for checkpointing: the last iterate and its residual,
+  // followed by the pairs of differences, oldest first.  Empty before the
+  // first Update().
+  std::vector<Teuchos::RCP<const Epetra_MultiVector>> history() const;
+
+  // Restores a copy of a history returned by history().
+  void set_history(const std::vector<Teuchos::RCP<const Epetra_MultiVector>>& history);
+
+ private:
+  static double Dot_(const Epetra_MultiVector& a, const Epetra_MultiVector& b);
+
+ private:
+  int depth_;
+  double beta_;
+
+  Teuchos::RCP<Epetra_MultiVector> x_prev_, r_prev_, r_;
+  std::deque<Teuchos::RCP<Epetra_MultiVector>> dX_, dR_;
+};
+
+} // namespace Amanzi
+
+#endif
@@ -0,0 +1,124 @@
+/*
+  Copyright 2010-202x held jointly by participating institutions.
+  ATS is released under the three-clause BSD License.
+  The terms of use and "as is" disclaimer for this license are
+  provided in the top-level COPYRIGHT file.
+
+  Authors:
+*/
+
+#include <cmath>
+
+#include "errors.hh"
+#include "chemistry_activity_tracker.hh"
+
+namespace Amanzi {
+
+namespace {
+
+void
+store(const Epetra_MultiVector* v, std::vector<double>& ref)
+{
+  if (v == nullptr) {
+    ref.clear();
+    return;
+  }
+  int n = v->MyLength();
+  ref.resize(v->NumVectors() * n);
+  for (int k = 0; k != v->NumVectors(); ++k)
+    for (int c = 0; c != n; ++c) ref[k * n + c] = (*v)[k][c];
+}
+
+} // namespace
+
+
+ChemistryActivityTracker::ChemistryActivityTracker(Teuchos::ParameterList& plist,
+                                                   const Key& tcc_key,
+                                                   const Key& temp_key,
+                                                   const Key& sat_key,
+                                                   const Tag& tag,
+                                                   const Key& name)
+  : tcc_key_(tcc_key),
+    temp_key_(temp_key),
+    sat_key_(sat_key),
+    tag_(tag),
+    name_(name),
+    solved_(false),
+    t_solved_(0.),
+    num_active_(0),
+    num_skipped_(0)
+{
+  rtol_ = plist.get<double>("concentration relative tolerance", 1.e-8);
+  atol_ = plist.get<double>("concentration absolute tolerance", 1.e-20);
+  temp_tol_ = plist.get<double>("temperature tolerance [K]", 1.e-3);
+  sat_tol_ = plist.get<double>("saturation tolerance [-]", 1.e-6);
+  max_interval_ = plist.get<double>("maximum skipped interval [s]", 86400.);
+  if (rtol_ < 0. || atol_ < 0. || temp_tol_ < 0. || sat_tol_ < 0. || max_interval_ < 0.) {
+    Errors::Message msg("ChemistryActivityTracker: tolerances and intervals must be non-negative.");
+    Exceptions::amanzi_throw(msg);
+  }
+}
+
+
+int
+ChemistryActivityTracker::Update(double t_old, State& S)
+{
+  const Epetra_MultiVector& tcc = *GetField_(tcc_key_, S);
+  const Epetra_MultiVector* temp = GetField_(temp_key_, S);
+  const Epetra_MultiVector* sat = GetField_(sat_key_, S);
+
+  int ncells = tcc.MyLength();
+
+  // a repeated step, rewound past the last solve, has no valid reference
+  if (solved_ && t_old < t_solved_) solved_ = false;
+
+  int num_active = ncells;
+  if (solved_) {
+    num_active = 0;
+    for (int c = 0; c != ncells; ++c) {
+      bool active = false;
+      for (int k = 0; k != tcc.NumVectors() && !active; ++k) {
+        double ref = tcc_ref_[k * ncells + c];
+        active = std::abs(tcc[k][c] - ref) > rtol_ * std::abs(ref) + atol_;
+      }
+      if (!active && temp != nullptr)
+        active = std::abs((*temp)[0][c] - temp_ref_[c]) > temp_tol_;
+      if (!active && sat != nullptr) active = std::abs((*sat)[0][c] - sat_ref_[c]) > sat_tol_;
+      if (active) num_active++;
+    }
+  }
+
+  tcc.Comm().SumAll(&num_active, &num_active_, 1);
+  return num_active_;
+}
+
+
+bool
+ChemistryActivityTracker::Skip(double t_new)
+{
+  bool skip = solved_ && num_active_ == 0 && t_new - t_solved_ < max_interval_;
+  if (skip) num_skipped_++;
+  return skip;
+}
+
+
+void
+ChemistryActivityTracker::Solved(double t_new, State& S)
+{
+  store(GetField_(tcc_key_, S), tcc_ref_);
+  store(GetField_(temp_key_, S), temp_ref_);
+  store(GetField_(sat_key_, S), sat_ref_);
+  t_solved_ = t_new;
+  solved_ = true;
+}
+
+
+const Epetra_MultiVector*
+ChemistryActivityTracker::GetField_(const Key& key, State& S) const
+{
+  if (key.empty() || !S.HasRecord(key, tag_)) return nullptr;
+  if (S.HasEvaluator(key, tag_)) S.GetEvaluator(key, tag_).Update(S, name_);
+  return S.Get<CompositeVector>(key, tag_).ViewComponent("cell", false).get();
+}
+
+} // namespace Amanzi
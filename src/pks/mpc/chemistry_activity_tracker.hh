@@ -0,0 +1,108 @@
+/*
+  Copyright 2010-202x held jointly by participating institutions.
+  ATS is released under the three-clause BSD License.
+  The terms of use and "as is" disclaimer for this license are
+  provided in the top-level COPYRIGHT file.
+
+  Authors:
+*/
+
+/*
+  Skips geochemistry steps in operator-split reactive transport while the
+  whole domain is quiescent.
+
+  A cell is active if, since the last chemistry solve, any of its total
+  component concentrations changed by more than
+
+    rtol * |tcc| + atol,
+
+  or its temperature or saturation changed by more than their tolerances.
+  The skip is all or nothing: the chemistry PK advances all cells in one call,
+  so a step is skipped only when no cell on any rank is active, and otherwise
+  every cell is solved.  The skipped time is then included in the next solve,
+  which advances chemistry from the end of the last solve.  A solve is forced
+  once the skipped time reaches a maximum interval, so that slow kinetics are
+  not lost.  If that longer solve fails, the reference is dropped, so that the
+  retried (and possibly cut) step advances chemistry over its own interval
+  only, rather than failing over the same long interval again.
+
+  Temperature and saturation are used if they exist in State, and so are
+  optional, e.g. for isothermal problems.
+
+  Parameters:
+    "concentration relative tolerance" (1e-8), rtol above
+    "concentration absolute tolerance" (1e-20), atol above
+    "temperature tolerance [K]" (1e-3)
+    "saturation tolerance [-]" (1e-6)
+    "maximum skipped interval [s]" (86400), chemistry is solved at least
+      this often
+*/
+
+#pragma once
+
+#include <vector>
+
+#include "Teuchos_ParameterList.hpp"
+#include "Epetra_MultiVector.h"
+
+#include "State.hh"
+
+namespace Amanzi {
+
+class ChemistryActivityTracker {
+ public:
+  // Temperature and saturation keys may be empty.
+  ChemistryActivityTracker(Teuchos::ParameterList& plist,
+                           const Key& tcc_key,
+                           const Key& temp_key,
+                           const Key& sat_key,
+                           const Tag& tag,
+                           const Key& name);
+
+  // Counts the active cells for a step from t_old, returning the global
+  // number.  All cells are active if there is no valid last solve, i.e.
+  // before the first, after a failed solve, or after the step was rewound
+  // past it.  Collective.
+  int Update(double t_old, State& S);
+
+  // May chemistry be skipped for the step ending at t_new?  Counts skips.
+  bool Skip(double t_new);
+
+  // Start of the interval the next chemistry solve must cover, for a step
+  // from t_old.
+  double t_start(double t_old) const { return solved_ ? t_solved_ : t_old; }
+
+  // Records a chemistry solve ending at t_new, with the resulting state.
+  void Solved(double t_new, State& S);
+
+  // Records a failed chemistry solve, dropping the last solve as reference.
+  void Failed() { solved_ = false; }
+
+  int num_active() const { return num_active_; }
+  int num_skipped() const { return num_skipped_; }
+
+ private:
+  const Epetra_MultiVector* GetField_(const Key& key, State& S) const;
+
+ private:
+  Key tcc_key_, temp_key_, sat_key_;
+  Tag tag_;
+  Key name_;
+
+  double rtol_, atol_;
+  double temp_tol_, sat_tol_;
+  double max_interval_;
+
+  bool solved_;
+  double t_solved_;
+
+  // state at the last solve
+  std::vector<double> tcc_ref_;
+  std::vector<double> temp_ref_;
+  std::vector<double> sat_ref_;
+
+  int num_active_;
+  int num_skipped_;
+};
+
+} // namespace Amanzi
@@ -0,0 +1,70 @@
+/*
+  Copyright 2010-202x held jointly by participating institutions.
+  ATS is released under the three-clause BSD License.
+  The terms of use and "as is" disclaimer for this license are
+  provided in the top-level COPYRIGHT file.
+
+  Authors:
+*/
+
+#include <limits>
+
+#include "chemistry_load_monitor.hh"
+
+namespace Amanzi {
+
+ChemistryLoadMonitor::ChemistryLoadMonitor(const Teuchos::RCP<const AmanziMesh::Mesh>& mesh)
+  : comm_(mesh->get_comm()),
+    max_(0.),
+    mean_(0.),
+    imbalance_(1.),
+    slowest_rank_(0),
+    max_cell_cost_(0.),
+    min_cell_cost_(0.),
+    mean_cell_cost_(0.),
+    sum_max_(0.),
+    sum_mean_(0.),
+    num_steps_(0)
+{
+  ncells_owned_ = mesh->num_entities(AmanziMesh::CELL, AmanziMesh::Parallel_type::OWNED);
+  comm_->SumAll(&ncells_owned_, &ncells_global_, 1);
+}
+
+
+void
+ChemistryLoadMonitor::Record(double seconds)
+{
+  double sum = 0.;
+  comm_->MaxAll(&seconds, &max_, 1);
+  comm_->SumAll(&seconds, &sum, 1);
+  mean_ = sum / comm_->NumProc();
+  imbalance_ = mean_ > 0. ? max_ / mean_ : 1.;
+
+  int rank = seconds == max_ ? comm_->MyPID() : -1;
+  comm_->MaxAll(&rank, &slowest_rank_, 1);
+
+  // ranks without cells do not bound the cost per cell
+  double cell_cost = ncells_owned_ > 0 ? seconds / ncells_owned_ : 0.;
+  comm_->MaxAll(&cell_cost, &max_cell_cost_, 1);
+  if (ncells_owned_ == 0) cell_cost = std::numeric_limits<double>::max();
+  comm_->MinAll(&cell_cost, &min_cell_cost_, 1);
+  mean_cell_cost_ = ncells_global_ > 0 ? sum / ncells_global_ : 0.;
+
+  sum_max_ += max_;
+  sum_mean_ += mean_;
+  num_steps_++;
+}
+
+
+void
+ChemistryLoadMonitor::Write(std::ostream& os) const
+{
+  os << "chemistry load: max = " << max_ << " s, mean = " << mean_
+     << " s, imbalance = " << imbalance_ << " (rank " << slowest_rank_
+     << "); cumulative imbalance = " << cumulative_imbalance() << ", lost = " << lost_time()
+     << " s" << std::endl
+     << "  cost per cell: max = " << max_cell_cost_ << " s, min = " << min_cell_cost_
+     << " s, mean = " << mean_cell_cost_ << " s" << std::endl;
+}
+
+} // namespace Amanzi
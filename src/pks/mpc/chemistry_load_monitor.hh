@@ -0,0 +1,81 @@
+/*
+  Copyright 2010-202x held jointly by participating institutions.
+  ATS is released under the three-clause BSD License.
+  The terms of use and "as is" disclaimer for this license are
+  provided in the top-level COPYRIGHT file.
+
+  Authors:
+*/
+
+/*
+  Diagnostics of the load imbalance of geochemistry across ranks.
+
+  Chemistry is advanced on each rank's owned cells, and its cost per cell
+  varies by orders of magnitude, so ranks holding reaction fronts stall the
+  others at the next collective.  Each chemistry step, every rank records its
+  wall time, which the monitor reduces to:
+
+  - the imbalance, the max over ranks divided by the mean, and the time lost
+    waiting on the slowest rank, for the last step and accumulated over the
+    run;
+  - the cost per cell, a rank's time divided by its number of owned cells,
+    as the max and min over ranks and the global mean.
+
+  An imbalance with uniform cost per cell comes from the partition's cell
+  counts; one with a spread in cost per cell comes from the chemistry itself,
+  and would need cells to be redistributed by their cost.  This only measures;
+  it does not move work between ranks.
+
+  Record() is collective.
+*/
+
+#pragma once
+
+#include <ostream>
+
+#include "Teuchos_RCP.hpp"
+#include "AmanziComm.hh"
+#include "Mesh.hh"
+
+namespace Amanzi {
+
+class ChemistryLoadMonitor {
+ public:
+  explicit ChemistryLoadMonitor(const Teuchos::RCP<const AmanziMesh::Mesh>& mesh);
+
+  // Records this rank's wall time [s] of one chemistry step.
+  void Record(double seconds);
+
+  // max / mean over ranks of the last step's time, and of the total time
+  double imbalance() const { return imbalance_; }
+  double cumulative_imbalance() const { return sum_mean_ > 0. ? sum_max_ / sum_mean_ : 1.; }
+
+  // wall time lost, per rank, to waiting on the slowest rank [s]
+  double lost_time() const { return sum_max_ - sum_mean_; }
+
+  // rank of the slowest process in the last step
+  int slowest_rank() const { return slowest_rank_; }
+
+  // cost per owned cell of the last step [s]: max and min over ranks, and the
+  // total time over the total number of cells
+  double max_cell_cost() const { return max_cell_cost_; }
+  double min_cell_cost() const { return min_cell_cost_; }
+  double mean_cell_cost() const { return mean_cell_cost_; }
+
+  int num_steps() const { return num_steps_; }
+
+  // Writes the last step and cumulative statistics.
+  void Write(std::ostream& os) const;
+
+ private:
+  Comm_ptr_type comm_;
+  int ncells_owned_, ncells_global_;
+
+  double max_, mean_, imbalance_;
+  int slowest_rank_;
+  double max_cell_cost_, min_cell_cost_, mean_cell_cost_;
+  double sum_max_, sum_mean_;
+  int num_steps_;
+};
+
+} // namespace Amanzi
@@ -0,0 +1,93 @@
+/*
+  Copyright 2010-202x held jointly by participating institutions.
+  ATS is released under the three-clause BSD License.
+  The terms of use and "as is" disclaimer for this license are
+  provided in the top-level COPYRIGHT file.
+
+  Authors:
+*/
+
+#include <cmath>
+#include <vector>
+
+#include "errors.hh"
+#include "coupling_iteration.hh"
+
+namespace Amanzi {
+
+namespace {
+
+// 2-norm over all vectors
+double
+norm2(const Epetra_MultiVector& v)
+{
+  std::vector<double> norms(v.NumVectors());
+  v.Norm2(norms.data());
+  double norm = 0.;
+  for (double n : norms) norm += n * n;
+  return std::sqrt(norm);
+}
+
+} // namespace
+
+
+CouplingIteration::CouplingIteration(Teuchos::ParameterList& plist,
+                                     const Teuchos::RCP<VerboseObject>& vo)
+  : vo_(vo),
+    anderson_(plist.get<int>("Anderson depth", 3), plist.get<double>("relaxation", 1.)),
+    num_its_(0),
+    residual_(0.),
+    converged_(false)
+{
+  max_its_ = plist.get<int>("maximum iterations", 10);
+  rtol_ = plist.get<double>("tolerance", 1.e-6);
+  atol_ = plist.get<double>("absolute tolerance", 0.);
+  fail_if_not_converged_ = plist.get<bool>("fail if not converged", true);
+  if (max_its_ < 1) {
+    Errors::Message msg("CouplingIteration: \"maximum iterations\" must be >= 1.");
+    Exceptions::amanzi_throw(msg);
+  }
+}
+
+
+bool
+CouplingIteration::Solve(const Map& G, Epetra_MultiVector& x)
+{
+  Teuchos::OSTab tab = vo_->getOSTab();
+  anderson_.Reset();
+
+  // the image g = G(x) and the difference g - x
+  Epetra_MultiVector g(x.Map(), x.NumVectors());
+  Epetra_MultiVector dx(x.Map(), x.NumVectors());
+
+  converged_ = false;
+  num_its_ = 0;
+  while (true) {
+    num_its_++;
+    if (G(x, g)) return true;
+
+    dx.Update(1., g, -1., x, 0.);
+    double norm_dx = norm2(dx);
+    double norm_g = norm2(g);
+    residual_ = norm_g > 0. ? norm_dx / norm_g : norm_dx;
+    if (vo_->os_OK(Teuchos::VERB_HIGH))
+      *vo_->os() << "coupling iteration " << num_its_ << ": relative residual = " << residual_
+                 << std::endl;
+
+    converged_ = norm_dx <= rtol_ * norm_g || norm_dx <= atol_;
+    if (converged_ || num_its_ == max_its_) break;
+    anderson_.Update(x, g);
+  }
+
+  if (!converged_) {
+    if (vo_->os_OK(Teuchos::VERB_LOW)) {
+      Teuchos::OSTab tab2 = vo_->getOSTab();
+      *vo_->os() << vo_->color("yellow") << "Coupling iteration not converged after " << num_its_
+                 << " iterations, relative residual = " << residual_ << vo_->reset() << std::endl;
+    }
+    if (fail_if_not_converged_) return true;
+  }
+  return false;
+}
+
+} // namespace Amanzi
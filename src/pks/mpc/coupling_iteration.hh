@@ -0,0 +1,71 @@
+/*
+  Copyright 2010-202x held jointly by participating institutions.
+  ATS is released under the three-clause BSD License.
+  The terms of use and "as is" disclaimer for this license are
+  provided in the top-level COPYRIGHT file.
+
+  Authors:
+*/
+
+/*
+  An Anderson-accelerated fixed point iteration, x = G(x), of the coupling
+  between operator-split systems, with the parameters of the
+  coupling-iteration-spec (see mpc_coupled_water_split_flux.hh).
+
+  Each evaluation of G solves the split systems given x, and so may fail.  The
+  iteration stops when
+
+    | G(x) - x | <= tolerance * | G(x) |  or  | G(x) - x | <= absolute tolerance,
+
+  or after the maximum number of evaluations of G.
+*/
+
+#ifndef ATS_MPC_COUPLING_ITERATION_HH_
+#define ATS_MPC_COUPLING_ITERATION_HH_
+
+#include <functional>
+
+#include "Teuchos_ParameterList.hpp"
+#include "Teuchos_RCP.hpp"
+#include "Epetra_MultiVector.h"
+
+#include "VerboseObject.hh"
+#include "anderson_accelerator.hh"
+
+namespace Amanzi {
+
+class CouplingIteration {
+ public:
+  // Computes g = G(x), returning true on failure.
+  using Map = std::function<bool(const Epetra_MultiVector& x, Epetra_MultiVector& g)>;
+
+  // plist is the "coupling iteration" sublist; iterations are reported to vo.
+  CouplingIteration(Teuchos::ParameterList& plist, const Teuchos::RCP<VerboseObject>& vo);
+
+  // Iterates from the initial guess x, leaving in x the last iterate G was
+  // evaluated at.  Returns true if G failed, or if the iteration did not
+  // converge and "fail if not converged" is set.
+  bool Solve(const Map& G, Epetra_MultiVector& x);
+
+  // diagnostics of the last solve
+  int num_iterations() const { return num_its_; }
+  double residual() const { return residual_; }
+  bool converged() const { return converged_; }
+
+ private:
+  Teuchos::RCP<VerboseObject> vo_;
+  AndersonAccelerator anderson_;
+
+  int max_its_;
+  double rtol_;
+  double atol_;
+  bool fail_if_not_converged_;
+
+  int num_its_;
+  double residual_;
+  bool converged_;
+};
+
+} // namespace Amanzi
+
+#endif
@@ -47,11 +47,12 @@ respective methods.
 
 #include "PK.hh"
 #include "PK_Factory.hh"
+#include "pk_history.hh"
 
 namespace Amanzi {
 
 template <class PK_t>
-class MPC : virtual public PK {
+class MPC : virtual public PK, virtual public PK_History {
  public:
   MPC(Teuchos::ParameterList& pk_tree,
       const Teuchos::RCP<Teuchos::ParameterList>& global_list,
@@ -101,6 +102,10 @@ class MPC : virtual public PK {
   // Tag the primary variable as changed in the DAG
   virtual void ChangedSolutionPK(const Tag& tag) override;
 
+  // Restart history of the sub-PKs from primary variables set outside of a
+  // step.
+  virtual void ResetHistory(double t) override;
+
  protected:
   // constructs sub-pks
   void init_(Comm_ptr_type comm = Teuchos::null);
@@ -258,6 +263,17 @@ MPC<PK_t>::ChangedSolutionPK(const Tag& tag)
 };
 
 
+// -----------------------------------------------------------------------------
+// Resets the history of sub-PKs that keep one.
+// -----------------------------------------------------------------------------
+template <class PK_t>
+void
+MPC<PK_t>::ResetHistory(double t)
+{
+  for (auto& pk : sub_pks_) resetHistory(*pk, t);
+};
+
+
 template <class PK_t>
 Teuchos::RCP<PK_t>
 MPC<PK_t>::get_subpk(int i)
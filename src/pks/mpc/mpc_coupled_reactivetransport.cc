@@ -45,6 +45,25 @@ MPCCoupledReactiveTransport::MPCCoupledReactiveTransport(
   mol_dens_key_ = Keys::readKey(*plist_, domain_, "molar density liquid", "molar_density_liquid");
   mol_dens_surf_key_ =
     Keys::readKey(*plist_, domain_surf_, "surface molar density liquid", "molar_density_liquid");
+
+  if (plist_->get<bool>("monitor chemistry load", false)) {
+    chem_load_ = Teuchos::rcp(new ChemistryLoadMonitor(S_->GetMesh(domain_)));
+    chem_load_surf_ =
+      Teuchos::rcp(new ChemistryLoadMonitor(S_->GetMesh(domain_surf_)));
+  }
+
+  if (plist_->isSublist("chemistry activity")) {
+    auto& activity_list = plist_->sublist("chemistry activity");
+    Key temp_key = Keys::readKey(*plist_, domain_, "temperature", "temperature");
+    Key sat_key = Keys::readKey(*plist_, domain_, "saturation liquid", "saturation_liquid");
+    chem_activity_ = Teuchos::rcp(new ChemistryActivityTracker(
+      activity_list, tcc_key_, temp_key, sat_key, tag_next_, name()));
+
+    Key temp_surf_key = Keys::readKey(*plist_, domain_surf_, "surface temperature", "temperature");
+    Key pd_surf_key = Keys::readKey(*plist_, domain_surf_, "ponded depth", "ponded_depth");
+    chem_activity_surf_ = Teuchos::rcp(new ChemistryActivityTracker(
+      activity_list, tcc_surf_key_, temp_surf_key, pd_surf_key, tag_next_, name()));
+  }
 }
 
 
@@ -200,8 +219,41 @@ MPCCoupledReactiveTransport::AdvanceStep(double t_old, double t_new, bool reinit
   S_->GetEvaluator(mol_dens_surf_key_, tag_next_).Update(*S_, name_);
   Teuchos::RCP<const Epetra_MultiVector> mol_dens_surf =
     S_->Get<CompositeVector>(mol_dens_surf_key_, tag_next_).ViewComponent("cell", true);
-  fail = advanceChemistry(
-    chemistry_pk_surf_, t_old, t_new, reinit, *mol_dens_surf, tcc_surf, *alquimia_surf_timer_);
+  double t_chem_old = t_old;
+  bool skip_surf = false;
+  if (chem_activity_surf_ != Teuchos::null) {
+    chem_activity_surf_->Update(t_old, *S_);
+    skip_surf = chem_activity_surf_->Skip(t_new);
+    t_chem_old = chem_activity_surf_->t_start(t_old);
+  }
+
+  Teuchos::Time chem_surf_timer("surface chemistry step", true);
+  if (skip_surf) {
+    if (vo_->os_OK(Teuchos::VERB_HIGH))
+      *vo_->os() << "No active surface chemistry cells, skipping surface chemistry." << std::endl;
+  } else {
+    fail = advanceChemistry(chemistry_pk_surf_,
+                            t_chem_old,
+                            t_new,
+                            reinit,
+                            *mol_dens_surf,
+                            tcc_surf,
+                            *alquimia_surf_timer_);
+    if (chem_activity_surf_ != Teuchos::null) {
+      if (fail) {
+        chem_activity_surf_->Failed();
+      } else {
+        chem_activity_surf_->Solved(t_new, *S_);
+      }
+    }
+  }
+  if (chem_load_surf_ != Teuchos::null) {
+    chem_load_surf_->Record(chem_surf_timer.stop());
+    if (vo_->os_OK(Teuchos::VERB_HIGH)) {
+      *vo_->os() << "surface ";
+      chem_load_surf_->Write(*vo_->os());
+    }
+  }
   changedEvaluatorPrimary(tcc_surf_key_, tag_next_, *S_);
   if (fail) {
     if (vo_->os_OK(Teuchos::VERB_MEDIUM))
@@ -218,7 +270,33 @@ MPCCoupledReactiveTransport::AdvanceStep(double t_old, double t_new, bool reinit
   S_->GetEvaluator(mol_dens_key_, tag_next_).Update(*S_, name_);
   Teuchos::RCP<const Epetra_MultiVector> mol_dens =
     S_->Get<CompositeVector>(mol_dens_key_, tag_next_).ViewComponent("cell", true);
-  fail = advanceChemistry(chemistry_pk_, t_old, t_new, reinit, *mol_dens, tcc, *alquimia_timer_);
+  t_chem_old = t_old;
+  bool skip = false;
+  if (chem_activity_ != Teuchos::null) {
+    chem_activity_->Update(t_old, *S_);
+    skip = chem_activity_->Skip(t_new);
+    t_chem_old = chem_activity_->t_start(t_old);
+  }
+
+  Teuchos::Time chem_timer("chemistry step", true);
+  if (skip) {
+    if (vo_->os_OK(Teuchos::VERB_HIGH))
+      *vo_->os() << "No active chemistry cells, skipping chemistry." << std::endl;
+  } else {
+    fail = advanceChemistry(
+      chemistry_pk_, t_chem_old, t_new, reinit, *mol_dens, tcc, *alquimia_timer_);
+    if (chem_activity_ != Teuchos::null) {
+      if (fail) {
+        chem_activity_->Failed();
+      } else {
+        chem_activity_->Solved(t_new, *S_);
+      }
+    }
+  }
+  if (chem_load_ != Teuchos::null) {
+    chem_load_->Record(chem_timer.stop());
+    if (vo_->os_OK(Teuchos::VERB_HIGH)) chem_load_->Write(*vo_->os());
+  }
   changedEvaluatorPrimary(tcc_key_, tag_next_, *S_);
   if (fail) {
     if (vo_->os_OK(Teuchos::VERB_MEDIUM))
@@ -11,6 +11,17 @@
   This is the mpc_pk component of the Amanzi code.
 
   Process kernel for coupling of Transport_PK and Chemistry_PK.
+
+  If "monitor chemistry load" is true (default false), the wall time of
+  each chemistry step on each rank is reduced to the load imbalance across
+  ranks and the cost per cell of each rank, which are written at verbosity
+  "high", see ChemistryLoadMonitor.  This is a diagnostic only: work is not
+  redistributed.
+
+  If a "chemistry activity" sublist is provided, chemistry is skipped, on
+  the whole domain, in steps where no cell's concentrations, temperature or
+  saturation changed since the last chemistry solve, see ChemistryActivityTracker.  On the
+  surface, ponded depth takes the place of saturation.
 */
 
 
@@ -24,6 +35,8 @@
 #include "transport_ats.hh"
 #include "Chemistry_PK.hh"
 #include "weak_mpc.hh"
+#include "chemistry_load_monitor.hh"
+#include "chemistry_activity_tracker.hh"
 
 namespace Amanzi {
 
@@ -51,6 +64,8 @@ class MPCCoupledReactiveTransport : public WeakMPC {
   Key mol_dens_key_, mol_dens_surf_key_;
 
   Teuchos::RCP<Teuchos::Time> alquimia_timer_, alquimia_surf_timer_;
+  Teuchos::RCP<ChemistryLoadMonitor> chem_load_, chem_load_surf_;
+  Teuchos::RCP<ChemistryActivityTracker> chem_activity_, chem_activity_surf_;
 
   // storage for the component concentration intermediate values
   Teuchos::RCP<MPCCoupledTransport> coupled_transport_pk_;
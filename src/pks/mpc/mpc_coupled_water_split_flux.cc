@@ -7,6 +7,9 @@
   Authors: Ethan Coon
 */
 
+#include <algorithm>
+#include <cmath>
+
 #include "mpc_coupled_water_split_flux.hh"
 #include "mpc_surface_subsurface_helpers.hh"
 #include "pk_helpers.hh"
@@ -70,6 +73,29 @@ MPCCoupledWaterSplitFlux::MPCCoupledWaterSplitFlux(
     p_lateral_flow_source_suffix_ = Keys::getVarName(p_lateral_flow_source_);
     cv_key_ = Keys::readKey(*plist_, domain_star_, "cell volume", "cell_volume");
   }
+
+  // -- optionally iterate the exchange to convergence
+  iterate_ = plist_->isSublist("coupling iteration");
+  if (iterate_) {
+    if (coupling_ != "flux") {
+      Errors::Message msg("MPCCoupledWaterSplitFlux: \"coupling iteration\" requires \"coupling "
+                          "type\" \"flux\".");
+      Exceptions::amanzi_throw(msg);
+    }
+    for (auto subcycle : subcycling_) {
+      if (subcycle) {
+        Errors::Message msg(
+          "MPCCoupledWaterSplitFlux: \"coupling iteration\" does not support subcycling.");
+        Exceptions::amanzi_throw(msg);
+      }
+    }
+
+    exchange_source_key_ =
+      Keys::readKey(*plist_, domain_star_, "water exchange source", "water_exchange_source");
+    source_star_key_ = Keys::readKey(*plist_, domain_star_, "water source star", "water_source");
+    exfilt_key_ = Keys::readKey(*plist_, domain_, "exfiltration flux", "surface_subsurface_flux");
+    exfilt_suffix_ = Keys::getVarName(exfilt_key_);
+  }
 };
 
 
@@ -107,6 +133,17 @@ MPCCoupledWaterSplitFlux::Setup()
     S_->RequireEvaluator(p_conserved_variable_star_, tags_[0].second);
     //S_->RequireEvaluator(p_conserved_variable_star_, tags_[0].first);
   }
+
+  if (iterate_) {
+    S_->Require<CompositeVector, CompositeVectorSpace>(
+        exchange_source_key_, tags_[0].second, exchange_source_key_)
+      .SetMesh(S_->GetMesh(domain_star_))
+      ->SetComponent("cell", AmanziMesh::CELL, 1);
+    requireEvaluatorPrimary(exchange_source_key_, tags_[0].second, *S_);
+
+    coupling_iteration_ =
+      Teuchos::rcp(new CouplingIteration(plist_->sublist("coupling iteration"), vo_));
+  }
 }
 
 
@@ -151,6 +188,27 @@ MPCCoupledWaterSplitFlux::Initialize()
     }
   }
 
+  // no exchange until the first primary solve
+  if (iterate_) {
+    // the exchange reaches the star system only through its water source.
+    // Dependencies of evaluators are known once State is set up, so this is
+    // checked here rather than in Setup().
+    if (!S_->HasEvaluator(source_star_key_, tags_[0].second) ||
+        !S_->GetEvaluator(source_star_key_, tags_[0].second)
+           .IsDependency(*S_, exchange_source_key_, tags_[0].second)) {
+      Errors::Message msg;
+      msg << "MPCCoupledWaterSplitFlux: \"coupling iteration\" requires that the star system's "
+          << "water source \"" << source_star_key_ << "\" depends upon the water exchange source \""
+          << exchange_source_key_ << "\".";
+      Exceptions::amanzi_throw(msg);
+    }
+
+    S_->GetW<CompositeVector>(exchange_source_key_, tags_[0].second, exchange_source_key_)
+      .PutScalar(0.);
+    S_->GetRecordW(exchange_source_key_, tags_[0].second, exchange_source_key_).set_initialized();
+    changedEvaluatorPrimary(exchange_source_key_, tags_[0].second, *S_);
+  }
+
   int i = 0;
   for (const auto& tag : tags_) {
     if (subcycling_[i]) S_->GetRecordW("dt", tag.second, name()).set_initialized();
@@ -165,6 +223,8 @@ MPCCoupledWaterSplitFlux::Initialize()
 bool
 MPCCoupledWaterSplitFlux::AdvanceStep(double t_old, double t_new, bool reinit)
 {
+  if (iterate_) return AdvanceStepIterated_(t_old, t_new, reinit);
+
   bool fail = false;
   fail = AdvanceStep_i_(0, t_old, t_new, reinit);
   if (fail) return fail;
@@ -174,6 +234,123 @@ MPCCoupledWaterSplitFlux::AdvanceStep(double t_old, double t_new, bool reinit)
 }
 
 
+// -----------------------------------------------------------------------------
+// Iterate the star and primary solves until the lateral flow source passed to
+// the primary system is consistent with the star solution.
+// -----------------------------------------------------------------------------
+bool
+MPCCoupledWaterSplitFlux::AdvanceStepIterated_(double t_old, double t_new, bool reinit)
+{
+  bool fail = AdvanceStep_i_(0, t_old, t_new, reinit);
+  if (fail) return fail;
+
+  // the iterate x is the lateral flux, and G solves the primary system with
+  // x, then re-solves the star system with the resulting exchange
+  const auto& cv = *S_->Get<CompositeVector>(cv_key_, tags_[0].second).ViewComponent("cell", false);
+  Epetra_MultiVector x(cv.Map(), 1);
+  ComputeLateralFlux_(x);
+
+  bool first = true;
+  auto G = [&](const Epetra_MultiVector& q, Epetra_MultiVector& g) {
+    // restart the primary system from the start of the step
+    if (!first) sub_pks_[1]->FailStep(t_old, t_new, tags_[1].second);
+    first = false;
+
+    SetLateralFlux_(q);
+    if (AdvanceStep_i_(1, t_old, t_new, reinit)) return true;
+
+    CopyExchangeToStar_();
+    sub_pks_[0]->FailStep(t_old, t_new, tags_[0].second);
+    if (AdvanceStep_i_(0, t_old, t_new, reinit)) return true;
+    ComputeLateralFlux_(g);
+    return false;
+  };
+  return coupling_iteration_->Solve(G, x);
+}
+
+
+// -----------------------------------------------------------------------------
+// The lateral flow source, on star cells, implied by the star solve: the
+// change in star water content less the exchange, per unit area.
+// -----------------------------------------------------------------------------
+void
+MPCCoupledWaterSplitFlux::ComputeLateralFlux_(Epetra_MultiVector& q)
+{
+  double dt = S_->get_time(tags_[0].second) - S_->get_time(tags_[0].first);
+  q.Update(1.0 / dt,
+           *S_->Get<CompositeVector>(p_conserved_variable_star_, tags_[0].second)
+              .ViewComponent("cell", false),
+           -1.0 / dt,
+           *S_->Get<CompositeVector>(p_conserved_variable_star_, tags_[0].first)
+              .ViewComponent("cell", false),
+           0.);
+  q.ReciprocalMultiply(
+    1.0,
+    *S_->Get<CompositeVector>(cv_key_, tags_[0].second).ViewComponent("cell", false),
+    q,
+    0.);
+  q.Update(-1.0,
+           *S_->Get<CompositeVector>(exchange_source_key_, tags_[0].second)
+              .ViewComponent("cell", false),
+           1.0);
+}
+
+
+void
+MPCCoupledWaterSplitFlux::SetLateralFlux_(const Epetra_MultiVector& q)
+{
+  if (is_domain_set_) {
+    const auto& domain_set = *S_->GetDomainSet(domain_set_);
+    auto ds_iter = domain_set.begin();
+    for (int c = 0; c != q.MyLength(); ++c) {
+      Tag ds_tag_next = get_ds_tag_next_(*ds_iter);
+      Key p_key = Keys::getKey(*ds_iter, p_lateral_flow_source_suffix_);
+      auto p_owner = S_->GetRecord(p_key, ds_tag_next).owner();
+      (*S_->GetW<CompositeVector>(p_key, ds_tag_next, p_owner).ViewComponent("cell", false))[0][0] =
+        q[0][c];
+      changedEvaluatorPrimary(p_key, ds_tag_next, *S_);
+      ++ds_iter;
+    }
+  } else {
+    *S_->GetW<CompositeVector>(p_lateral_flow_source_, tags_[1].second, p_lateral_flow_source_)
+       .ViewComponent("cell", false) = q;
+    changedEvaluatorPrimary(p_lateral_flow_source_, tags_[1].second, *S_);
+  }
+}
+
+
+void
+MPCCoupledWaterSplitFlux::CopyExchangeToStar_()
+{
+  auto& source =
+    *S_->GetW<CompositeVector>(exchange_source_key_, tags_[0].second, exchange_source_key_)
+       .ViewComponent("cell", false);
+  if (is_domain_set_) {
+    const auto& domain_set = *S_->GetDomainSet(domain_set_);
+    auto ds_iter = domain_set.begin();
+    for (int c = 0; c != source.MyLength(); ++c) {
+      Key exfilt_key = Keys::getKey(*ds_iter, exfilt_suffix_);
+      Tag ds_tag_next = get_ds_tag_next_(*ds_iter);
+      const auto& exfilt =
+        *S_->Get<CompositeVector>(exfilt_key, ds_tag_next).ViewComponent("cell", false);
+      AMANZI_ASSERT(exfilt.MyLength() == 1);
+      source[0][c] = exfilt[0][0];
+      ++ds_iter;
+    }
+  } else {
+    source = *S_->Get<CompositeVector>(exfilt_key_, tags_[1].second).ViewComponent("cell", false);
+  }
+
+  // the exfiltration is extensive, the source per unit area
+  source.ReciprocalMultiply(
+    1.0,
+    *S_->Get<CompositeVector>(cv_key_, tags_[0].second).ViewComponent("cell", false),
+    source,
+    0.);
+  changedEvaluatorPrimary(exchange_source_key_, tags_[0].second, *S_);
+}
+
+
 void
 MPCCoupledWaterSplitFlux::CommitStep(double t_old, double t_new, const Tag& tag)
 {
@@ -42,16 +42,68 @@ Note that this can be used with either a 3D subsurface solve, by setting the
      (pass the divergence of fluxes as a source), or `"hybrid`" a mixture of
      the two that seems the most robust.
 
+   * `"coupling iteration`" ``[coupling-iteration-spec]`` **optional** If
+     provided, the exchange is iterated to convergence within each step.  See
+     below.
+
    INCLUDES:
    - ``[mpc-spec]`` *Is an* MPC_.
    - ``[mpc-subcycled-spec]`` *Is a* MPCSubcycled_
 
+By default, each step solves the star system and then the primary system once,
+and the splitting error limits the step size.  With a `"coupling iteration`"
+sublist, the two solves are instead repeated until the lateral flow source
+passed to the primary system is consistent with the star solution.  The water
+exchanged between the surface and subsurface in the primary solve is passed
+back to the star system as a source, the star system is re-solved from the
+start of the step, and a new lateral flow source is computed.  This fixed
+point iteration, on the lateral flow source, is accelerated by Anderson
+mixing.
+
+This requires `"coupling type`" `"flux`" and no subcycling.  The star
+system's water source must include the `"water exchange source key`", which
+is provided here.
+
+.. _coupling-iteration-spec:
+.. admonition:: coupling-iteration-spec
+
+   * `"maximum iterations`" ``[int]`` **10** Maximum number of star and
+     primary solves per step.
+
+   * `"tolerance`" ``[double]`` **1e-6** Convergence tolerance on the change
+     in the lateral flow source, relative to its norm.
+
+   * `"absolute tolerance`" ``[double]`` **0** Convergence tolerance on the
+     norm of the change in the lateral flow source. ``[mol m^-2 s^-1]``
+
+   * `"Anderson depth`" ``[int]`` **3** Number of previous iterates used in
+     the Anderson mixing.  0 is a (relaxed) fixed point iteration.
+
+   * `"relaxation`" ``[double]`` **1** Damping of the fixed point update.
+
+   * `"fail if not converged`" ``[bool]`` **true** If true, the step fails
+     when not converged within the maximum iterations, otherwise a warning is
+     written and the last iterate is accepted.
+
+   KEYS:
+
+   - `"water exchange source`" **STAR_DOMAIN-water_exchange_source** Water
+     exchanged with the subsurface in the primary solve. ``[mol m^-2 s^-1]``
+   - `"water source star`" **STAR_DOMAIN-water_source** The star system's
+     water source, which must depend upon the water exchange source.
+   - `"exfiltration flux`" **DOMAIN-surface_subsurface_flux** Water exchanged
+     with the subsurface, as computed by the primary system. ``[mol s^-1]``
+
+The number of iterations and relative residual of the last step are written
+at verbosity `"high`" and above.
+
 */
 
 #pragma once
 
 #include "PK.hh"
 #include "mpc_subcycled.hh"
+#include "coupling_iteration.hh"
 
 namespace Amanzi {
 
@@ -71,7 +123,24 @@ class MPCCoupledWaterSplitFlux : public MPCSubcycled {
   virtual bool AdvanceStep(double t_old, double t_new, bool reinit = false) override;
   virtual void CommitStep(double t_old, double t_new, const Tag& tag) override;
 
+  // coupling iteration diagnostics, for the last step
+  int num_coupling_iterations() const
+  {
+    return iterate_ ? coupling_iteration_->num_iterations() : 0;
+  }
+  double coupling_residual() const { return iterate_ ? coupling_iteration_->residual() : 0.; }
+
  protected:
+  // iterates the star and primary solves to a consistent lateral flux
+  bool AdvanceStepIterated_(double t_old, double t_new, bool reinit);
+
+  // lateral flow source, on star cells, implied by the star solve
+  void ComputeLateralFlux_(Epetra_MultiVector& q);
+  void SetLateralFlux_(const Epetra_MultiVector& q);
+
+  // copies the primary system's exfiltration into the star exchange source
+  void CopyExchangeToStar_();
+
   void CopyPrimaryToStar_();
   void CopyStarToPrimary_();
 
@@ -125,6 +194,14 @@ class MPCCoupledWaterSplitFlux : public MPCSubcycled {
 
   bool is_domain_set_;
 
+  // coupling iteration
+  bool iterate_;
+  Teuchos::RCP<CouplingIteration> coupling_iteration_;
+  Key exchange_source_key_;
+  Key source_star_key_;
+  Key exfilt_key_;
+  Key exfilt_suffix_;
+
  private:
   // factory registration
   static RegisteredPKFactory<MPCCoupledWaterSplitFlux> reg_;
@@ -14,6 +14,7 @@
 
 #include "mpc_morphology_pk.hh"
 #include "Mesh.hh"
+#include "mesh_geometry_cache.hh"
 
 namespace Amanzi {
 
@@ -440,6 +441,7 @@ Morphology_PK::Update_MeshVertices_(const Teuchos::Ptr<State>& S)
       mesh_ss_->node_set_coordinates(nodes[i], coords);
     }
   }
+  MeshGeometryCache::Invalidate(*mesh_ss_);
 
   deform_eval_ =
     Teuchos::rcp_dynamic_cast<EvaluatorPrimary>(S->GetEvaluator(elevation_increase_key_));
@@ -35,6 +35,16 @@ MPCReactiveTransport::MPCReactiveTransport(Teuchos::ParameterList& pk_tree,
   tcc_key_ = Keys::readKey(
     *plist_, domain_, "total component concentration", "total_component_concentration");
   mol_dens_key_ = Keys::readKey(*plist_, domain_, "molar density liquid", "molar_density_liquid");
+
+  if (plist_->get<bool>("monitor chemistry load", false))
+    chem_load_ = Teuchos::rcp(new ChemistryLoadMonitor(S_->GetMesh(domain_)));
+
+  if (plist_->isSublist("chemistry activity")) {
+    Key temp_key = Keys::readKey(*plist_, domain_, "temperature", "temperature");
+    Key sat_key = Keys::readKey(*plist_, domain_, "saturation liquid", "saturation_liquid");
+    chem_activity_ = Teuchos::rcp(new ChemistryActivityTracker(
+      plist_->sublist("chemistry activity"), tcc_key_, temp_key, sat_key, tag_next_, name()));
+  }
 }
 
 
@@ -141,9 +151,37 @@ MPCReactiveTransport::AdvanceStep(double t_old, double t_new, bool reinit)
   Teuchos::RCP<const Epetra_MultiVector> mol_dens =
     S_->Get<CompositeVector>(mol_dens_key_, tag_next_).ViewComponent("cell", true);
 
-  fail |=
-    advanceChemistry(chemistry_pk_, t_old, t_new, reinit, *mol_dens, tcc_copy, *alquimia_timer_);
+  // skip chemistry if nothing has changed since the last solve
+  double t_chem_old = t_old;
+  if (chem_activity_ != Teuchos::null) {
+    int num_active = chem_activity_->Update(t_old, *S_);
+    if (chem_activity_->Skip(t_new)) {
+      if (vo_->os_OK(Teuchos::VERB_HIGH))
+        *vo_->os() << "No active chemistry cells, skipping chemistry." << std::endl;
+      chem_step_succeeded_ = true;
+      return fail;
+    }
+    t_chem_old = chem_activity_->t_start(t_old);
+    if (vo_->os_OK(Teuchos::VERB_HIGH))
+      *vo_->os() << num_active << " active chemistry cells, advancing chemistry from "
+                 << t_chem_old << std::endl;
+  }
+
+  Teuchos::Time chem_timer("chemistry step", true);
+  fail |= advanceChemistry(
+    chemistry_pk_, t_chem_old, t_new, reinit, *mol_dens, tcc_copy, *alquimia_timer_);
+  if (chem_load_ != Teuchos::null) {
+    chem_load_->Record(chem_timer.stop());
+    if (vo_->os_OK(Teuchos::VERB_HIGH)) chem_load_->Write(*vo_->os());
+  }
   changedEvaluatorPrimary(tcc_key_, tag_next_, *S_);
+  if (chem_activity_ != Teuchos::null) {
+    if (fail) {
+      chem_activity_->Failed();
+    } else {
+      chem_activity_->Solved(t_new, *S_);
+    }
+  }
   if (!fail) chem_step_succeeded_ = true;
   return fail;
 };
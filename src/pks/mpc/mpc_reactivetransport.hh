@@ -11,6 +11,16 @@
   This is the mpc_pk component of the Amanzi code.
 
   Process kernel for coupling of Transport_PK and Chemistry_PK.
+
+  If "monitor chemistry load" is true (default false), the wall time of
+  each chemistry step on each rank is reduced to the load imbalance across
+  ranks and the cost per cell of each rank, which are written at verbosity
+  "high", see ChemistryLoadMonitor.  This is a diagnostic only: work is not
+  redistributed.
+
+  If a "chemistry activity" sublist is provided, chemistry is skipped, on
+  the whole domain, in steps where no cell's concentrations, temperature or
+  saturation changed since the last chemistry solve, see ChemistryActivityTracker.
 */
 
 
@@ -23,6 +33,8 @@
 #include "transport_ats.hh"
 #include "Chemistry_PK.hh"
 #include "weak_mpc.hh"
+#include "chemistry_load_monitor.hh"
+#include "chemistry_activity_tracker.hh"
 
 namespace Amanzi {
 
@@ -50,6 +62,8 @@ class MPCReactiveTransport : public WeakMPC {
   Key mol_dens_key_;
 
   Teuchos::RCP<Teuchos::Time> alquimia_timer_;
+  Teuchos::RCP<ChemistryLoadMonitor> chem_load_;
+  Teuchos::RCP<ChemistryActivityTracker> chem_activity_;
 
   // storage for the component concentration intermediate values
   Teuchos::RCP<Transport::Transport_ATS> transport_pk_;
@@ -45,6 +45,8 @@ MPCSubsurface::MPCSubsurface(Teuchos::ParameterList& pk_tree_list,
 {
   // set up keys
   dump_ = plist_->get<bool>("dump preconditioner", false);
+  if (plist_->get<bool>("use evaluation plan", false))
+    eval_plan_ = Teuchos::rcp(new EvaluationPlan(name_));
   domain_name_ = plist_->get<std::string>("domain name", "domain");
 
   temp_key_ = Keys::readKey(*plist_, domain_name_, "temperature", "temperature");
@@ -599,7 +601,7 @@ MPCSubsurface::UpdatePreconditioner(double t, Teuchos::RCP<const TreeVector> up,
     // Update and upwind enthalpy * kr * rho/mu
     if (ddivhq_dp_ != Teuchos::null) {
       // -- update values
-      S_->GetEvaluator(hkr_key_, tag_next_).Update(*S_, name_);
+      updateEvaluator(eval_plan_, *S_, hkr_key_, tag_next_, name_);
       S_->GetEvaluator(hkr_key_, tag_next_).UpdateDerivative(*S_, name_, pres_key_, tag_next_);
       S_->GetEvaluator(hkr_key_, tag_next_).UpdateDerivative(*S_, name_, temp_key_, tag_next_);
 
@@ -80,7 +80,11 @@ except in expert cases or for comparison's sake, but the options are:
 
 - `"none`" No preconditioner never works.
 
-- `"block diagonal`" This is what one would get from the default StrongMPC_.  This probably never works.
+- `"block diagonal`" This is what one would get from the default StrongMPC_.
+  This probably never works on its own, but is the natural choice in
+  Jacobian-free Newton-Krylov mode (see `"Jacobian-free Newton-Krylov`" in
+  `PK: BDF`_), where the coupling is captured by the Jacobian-free product and
+  no off-diagonal blocks need be assembled.
 
 - `"no flow coupling`" This keeps the accumulation terms, but turns off all the
   non-local blocks.  This is equivalent to `Coupled Cells MPC`_.
@@ -126,6 +130,10 @@ algorithms are supported by the `EWC Globalization Delegate`_ object.
 
     * `"ewc delegate`" ``[mpc-delegate-ewc-spec]`` A `EWC Globalization Delegate`_ spec.
 
+    * `"use evaluation plan`" ``[bool]`` **false** If true, enthalpy times
+      relative permeability is only updated for the preconditioner if a
+      primary or independent variable upstream of it has changed.
+
     INCLUDES:
 
     - ``[strong-mpc-spec]`` *Is a* StrongMPC_.
@@ -137,6 +145,7 @@ algorithms are supported by the `EWC Globalization Delegate`_ object.
 
 #include "TreeOperator.hh"
 #include "pk_physical_bdf_default.hh"
+#include "evaluation_plan.hh"
 #include "strong_mpc.hh"
 
 namespace Amanzi {
@@ -263,6 +272,9 @@ class MPCSubsurface : public StrongMPC<PK_PhysicalBDF_Default> {
   int update_pcs_;
   Teuchos::RCP<Debugger> db_;
 
+  // optional, skips updates of secondary variables whose inputs are unchanged
+  Teuchos::RCP<EvaluationPlan> eval_plan_;
+
  private:
   // factory registration
   static RegisteredPKFactory<MPCSubsurface> reg_;
@@ -7,6 +7,7 @@
   Authors:
 */
 
+#include "surface_subsurface_map.hh"
 #include "mpc_surface_subsurface_helpers.hh"
 #include "errors.hh"
 
@@ -17,22 +18,21 @@ CopySurfaceToSubsurface(const CompositeVector& surf, CompositeVector& sub)
 {
   const Epetra_MultiVector& surf_c = *surf.ViewComponent("cell", false);
 
-  for (unsigned int sc = 0; sc != surf_c.MyLength(); ++sc) {
-    AmanziMesh::Entity_ID f = surf.Mesh()->entity_get_parent(AmanziMesh::CELL, sc);
-    SetDomainFaceValue(sub, f, surf_c[0][sc]);
-  }
+  std::string face_comp;
+  const auto& fs = SurfaceSubsurfaceMap::Get(surf.Mesh())->FaceIndices(sub, face_comp);
+  Epetra_MultiVector& sub_f = *sub.ViewComponent(face_comp, false);
+  for (int sc = 0; sc != surf_c.MyLength(); ++sc) sub_f[0][fs[sc]] = surf_c[0][sc];
 }
 
 void
 CopySubsurfaceToSurface(const CompositeVector& sub, CompositeVector& surf)
 {
-  //  const Epetra_MultiVector& sub_f = *sub.ViewComponent("face",false);
   Epetra_MultiVector& surf_c = *surf.ViewComponent("cell", false);
 
-  for (unsigned int sc = 0; sc != surf_c.MyLength(); ++sc) {
-    AmanziMesh::Entity_ID f = surf.Mesh()->entity_get_parent(AmanziMesh::CELL, sc);
-    surf_c[0][sc] = GetDomainFaceValue(sub, f);
-  }
+  std::string face_comp;
+  const auto& fs = SurfaceSubsurfaceMap::Get(surf.Mesh())->FaceIndices(sub, face_comp);
+  const Epetra_MultiVector& sub_f = *sub.ViewComponent(face_comp, false);
+  for (int sc = 0; sc != surf_c.MyLength(); ++sc) surf_c[0][sc] = sub_f[0][fs[sc]];
 }
 
 void
@@ -44,12 +44,14 @@ MergeSubsurfaceAndSurfacePressure(const CompositeVector& h_prev,
   const Epetra_MultiVector& h_c = *h_prev.ViewComponent("cell", false);
   double p_atm = 101325.;
 
-  for (unsigned int sc = 0; sc != surf_p_c.MyLength(); ++sc) {
-    AmanziMesh::Entity_ID f = surf_p.Mesh()->entity_get_parent(AmanziMesh::CELL, sc);
+  std::string face_comp;
+  const auto& fs = SurfaceSubsurfaceMap::Get(surf_p.Mesh())->FaceIndices(sub_p, face_comp);
+  Epetra_MultiVector& sub_p_f = *sub_p.ViewComponent(face_comp, false);
+  for (int sc = 0; sc != surf_p_c.MyLength(); ++sc) {
     if (h_c[0][sc] > 0. && surf_p_c[0][sc] > p_atm) {
-      SetDomainFaceValue(sub_p, f, surf_p_c[0][sc]);
+      sub_p_f[0][fs[sc]] = surf_p_c[0][sc];
     } else {
-      surf_p_c[0][sc] = GetDomainFaceValue(sub_p, f);
+      surf_p_c[0][sc] = sub_p_f[0][fs[sc]];
     }
   }
 }
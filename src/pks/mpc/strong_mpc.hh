@@ -15,6 +15,18 @@ Globally implicit coupling solves all sub-PKs as a single system of equations.
 .. _strong-mpc-spec:
 .. admonition:: strong-mpc-spec
 
+    * `"concurrent evaluator updates`" ``[Array(string)]`` **optional** Keys
+      of secondary variables, at the next tag, to update at the start of each
+      residual evaluation, before the sub-PKs' residuals.  Keys whose
+      dependency graphs share no evaluator and no mesh are updated
+      concurrently, e.g. those of surface and subsurface sub-PKs that are not
+      coupled through secondary variables.  Keys on subdomains aliasing one
+      mesh, as in a replicated domain set, are updated serially.
+
+    * `"evaluator threads`" ``[int]`` **1** Number of threads used to update
+      the above.  More than one requires a thread-safe build of Teuchos, and
+      is only supported on a single rank.
+
     INCLUDES:
 
     - ``[mpc-spec]`` *Is a* MPC_.
@@ -28,6 +40,7 @@ Globally implicit coupling solves all sub-PKs as a single system of equations.
 
 #include "mpc.hh"
 #include "pk_bdf_default.hh"
+#include "parallel_evaluator_executor.hh"
 
 namespace Amanzi {
 
@@ -51,6 +64,7 @@ class StrongMPC : public MPC<PK_t>, public PK_BDF_Default {
   // -- Commit any secondary (dependent) variables.
   virtual void CommitStep(double t_old, double t_new, const Tag& tag) override;
   virtual void FailStep(double t_old, double t_new, const Tag& tag) override;
+  virtual void ResetHistory(double t) override;
 
   //
   // These methods override methods in PK_BDF_Default
@@ -104,6 +118,9 @@ class StrongMPC : public MPC<PK_t>, public PK_BDF_Default {
   using MPC<PK_t>::pk_tree_;
   using MPC<PK_t>::pks_list_;
 
+  // optional, updates secondary variables concurrently before the residual
+  Teuchos::RCP<ParallelEvaluatorExecutor> evaluator_executor_;
+
  private:
   // factory registration
   static RegisteredPKFactory<StrongMPC> reg_;
@@ -166,6 +183,16 @@ StrongMPC<PK_t>::Initialize()
 
   // Initialize my timestepper.
   PK_BDF_Default::Initialize();
+
+  if (plist_->isParameter("concurrent evaluator updates")) {
+    std::vector<KeyTag> keys;
+    for (const auto& key :
+         plist_->get<Teuchos::Array<std::string>>("concurrent evaluator updates")) {
+      keys.emplace_back(KeyTag{ key, tag_next_ });
+    }
+    evaluator_executor_ = Teuchos::rcp(new ParallelEvaluatorExecutor(
+      name_, keys, plist_->get<int>("evaluator threads", 1), solution_->Comm()));
+  }
 };
 
 
@@ -188,6 +215,15 @@ StrongMPC<PK_t>::FailStep(double t_old, double t_new, const Tag& tag)
   //PK_BDF_Default::FailStep(t_old, t_new, tag);
 }
 
+// Sub-PKs first, as they may update what this time integrator restarts from.
+template <class PK_t>
+void
+StrongMPC<PK_t>::ResetHistory(double t)
+{
+  MPC<PK_t>::ResetHistory(t);
+  PK_BDF_Default::ResetHistory(t);
+}
+
 
 // -----------------------------------------------------------------------------
 // Compute the non-linear functional g = g(t,u,udot).
@@ -201,6 +237,7 @@ StrongMPC<PK_t>::FunctionalResidual(double t_old,
                                     Teuchos::RCP<TreeVector> g)
 {
   Solution_to_State(*u_new, tag_next_);
+  if (evaluator_executor_ != Teuchos::null) evaluator_executor_->Update(*S_);
 
   // loop over sub-PKs
   for (std::size_t i = 0; i != sub_pks_.size(); ++i) {
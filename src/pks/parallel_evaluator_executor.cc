@@ -0,0 +1,148 @@
+/*
+  Copyright 2010-202x held jointly by participating institutions.
+  ATS is released under the three-clause BSD License.
+  The terms of use and "as is" disclaimer for this license are
+  provided in the top-level COPYRIGHT file.
+
+  Authors:
+*/
+
+#include <algorithm>
+#include <atomic>
+#include <exception>
+#include <map>
+#include <numeric>
+#include <thread>
+
+#include "Teuchos_ConfigDefs.hpp"
+
+#include "errors.hh"
+#include "CompositeVector.hh"
+#include "State.hh"
+
+#include "parallel_evaluator_executor.hh"
+
+namespace Amanzi {
+
+ParallelEvaluatorExecutor::ParallelEvaluatorExecutor(const Key& name,
+                                                     const std::vector<KeyTag>& keys,
+                                                     int num_threads,
+                                                     const Comm_ptr_type& comm)
+  : name_(name), keys_(keys), num_threads_(num_threads), compiled_(false)
+{
+  if (num_threads_ < 1) {
+    Errors::Message msg;
+    msg << name_ << ": \"evaluator threads\" must be positive.";
+    Exceptions::amanzi_throw(msg);
+  }
+
+  if (num_threads_ > 1) {
+#ifndef HAVE_TEUCHOS_THREAD_SAFE
+    Errors::Message msg;
+    msg << name_ << ": \"evaluator threads\" > 1 requires a thread-safe build of Teuchos.";
+    Exceptions::amanzi_throw(msg);
+#endif
+    if (comm->NumProc() > 1) {
+      Errors::Message msg;
+      msg << name_ << ": \"evaluator threads\" > 1 is only supported on a single rank.";
+      Exceptions::amanzi_throw(msg);
+    }
+  }
+}
+
+
+void
+ParallelEvaluatorExecutor::Update(State& S)
+{
+  if (!compiled_) Compile_(S);
+
+  auto update_group = [&](int g) {
+    for (int k : groups_[g]) S.GetEvaluator(keys_[k].first, keys_[k].second).Update(S, name_);
+  };
+
+  int num_threads = std::min<int>(num_threads_, groups_.size());
+  if (num_threads <= 1) {
+    for (int g = 0; g != groups_.size(); ++g) update_group(g);
+    return;
+  }
+
+  std::atomic<int> next(0);
+  std::vector<std::exception_ptr> errors(num_threads);
+  auto work = [&](int i) {
+    try {
+      for (int g = next++; g < groups_.size(); g = next++) update_group(g);
+    } catch (...) {
+      errors[i] = std::current_exception();
+    }
+  };
+
+  std::vector<std::thread> threads;
+  for (int i = 1; i != num_threads; ++i) threads.emplace_back(work, i);
+  work(0);
+  for (auto& thread : threads) thread.join();
+
+  for (const auto& error : errors) {
+    if (error) std::rethrow_exception(error);
+  }
+}
+
+
+// -----------------------------------------------------------------------------
+// Groups keys whose dependency graphs share an evaluator or a mesh.
+// -----------------------------------------------------------------------------
+void
+ParallelEvaluatorExecutor::Compile_(const State& S)
+{
+  // union-find over keys, by the first key found to depend on each evaluator
+  std::vector<int> parent(keys_.size());
+  std::iota(parent.begin(), parent.end(), 0);
+  auto find = [&](int k) {
+    while (parent[k] != k) k = parent[k] = parent[parent[k]];
+    return k;
+  };
+
+  std::map<const Evaluator*, int> owner;
+  std::map<const AmanziMesh::Mesh*, int> mesh_owner;
+  std::vector<int> num_nodes(keys_.size(), 0);
+  for (int k = 0; k != keys_.size(); ++k) {
+    const KeyTag& key = keys_[k];
+    const Evaluator& eval = S.GetEvaluator(key.first, key.second);
+    for (auto entry = S.data_begin(); entry != S.data_end(); ++entry) {
+      for (const auto& rec : *entry->second) {
+        if (!S.HasEvaluator(entry->first, rec.first)) continue;
+        if (KeyTag{ entry->first, rec.first } != key &&
+            !eval.IsDependency(S, entry->first, rec.first))
+          continue;
+
+        num_nodes[k]++;
+        // evaluators may be shared across tags or keys
+        auto node = owner.emplace(&S.GetEvaluator(entry->first, rec.first), k).first;
+        parent[find(k)] = find(node->second);
+
+        // meshes may be shared, e.g. by aliased subdomains
+        if (rec.second->ValidType<CompositeVector>()) {
+          const AmanziMesh::Mesh* mesh = rec.second->Get<CompositeVector>().Mesh().get();
+          auto mesh_node = mesh_owner.emplace(mesh, k).first;
+          parent[find(k)] = find(mesh_node->second);
+        }
+      }
+    }
+  }
+
+  std::map<int, std::vector<int>> groups;
+  std::map<int, int> group_size;
+  for (int k = 0; k != keys_.size(); ++k) {
+    int g = find(k);
+    groups[g].push_back(k);
+    group_size[g] += num_nodes[k];
+  }
+
+  groups_.clear();
+  std::vector<std::pair<int, int>> order;
+  for (const auto& group : group_size) order.emplace_back(-group.second, group.first);
+  std::sort(order.begin(), order.end());
+  for (const auto& g : order) groups_.emplace_back(groups[g.second]);
+  compiled_ = true;
+}
+
+} // namespace Amanzi
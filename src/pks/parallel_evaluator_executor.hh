@@ -0,0 +1,82 @@
+/*
+  Copyright 2010-202x held jointly by participating institutions.
+  ATS is released under the three-clause BSD License.
+  The terms of use and "as is" disclaimer for this license are
+  provided in the top-level COPYRIGHT file.
+
+  Authors:
+*/
+
+/*
+  Updates a set of secondary variables concurrently, on a pool of threads.
+
+  Coupled PKs update many secondary variables, e.g. water contents and energy
+  balances on each of a set of domains.  Updated one at a time, as when each
+  sub-PK updates what it needs, these memory-bound sweeps are done serially,
+  even when they share no data.
+
+  On the first update, which must come after State's Setup(), the keys are
+  grouped so that no evaluator, and no mesh, is in the dependency graphs of
+  two groups.  Each group is then a task that may be updated without
+  synchronization with the others: groups, largest first, are handed to the
+  next free thread, and keys within a group are updated in order.  Keys whose
+  graphs overlap, including through a shared primary variable, end up in the
+  same group, so this helps only when keys live on distinct meshes, e.g. the
+  surface and subsurface sub-PKs of a StrongMPC, and those are not coupled
+  through their secondary variables.
+
+  Meshes compute some geometry lazily, on first use, which is not
+  thread-safe, so keys on the same mesh are grouped together.  This includes
+  subdomains that alias one mesh, as in a replicated domain set, which are
+  therefore updated serially.  Domain sets are in any case usually advanced
+  by MPCWeakSubdomain, which is not a StrongMPC and does not use this.
+
+  Evaluators then run on multiple threads at once, which requires:
+
+  - a thread-safe build of Teuchos (Teuchos_ENABLE_THREAD_SAFE), as
+    evaluators copy RCPs to shared objects such as meshes, and
+  - a single rank, as evaluators may communicate, and threads sharing a
+    communicator would call collectives in different orders on each rank.
+
+  With one thread, or a single group, keys are updated serially.
+*/
+
+#pragma once
+
+#include <vector>
+
+#include "AmanziComm.hh"
+#include "Key.hh"
+#include "Tag.hh"
+
+namespace Amanzi {
+
+class State;
+
+class ParallelEvaluatorExecutor {
+ public:
+  // Keys are updated on behalf of name.
+  ParallelEvaluatorExecutor(const Key& name,
+                            const std::vector<KeyTag>& keys,
+                            int num_threads,
+                            const Comm_ptr_type& comm);
+
+  // Updates all keys.  Exceptions thrown by evaluators are rethrown, after
+  // all tasks are done.
+  void Update(State& S);
+
+  int num_groups() const { return groups_.size(); }
+
+ private:
+  void Compile_(const State& S);
+
+ private:
+  Key name_;
+  std::vector<KeyTag> keys_;
+  int num_threads_;
+
+  bool compiled_;
+  std::vector<std::vector<int>> groups_; // indices into keys_, largest first
+};
+
+} // namespace Amanzi
@@ -63,8 +63,34 @@ PK_BDF_Default::Initialize()
       .setParametersNotAlreadySet(plist_->sublist("verbose object"));
     bdf_plist.sublist("verbose object").set("name", name() + "_TI");
 
+    // -- the time integrator may see this PK through wrappers which change
+    //    how its preconditioner is updated or applied.  The predictor is
+    //    outermost, so that it sees only the nonlinear solver's residual
+    //    evaluations, and not those made by JFNK's finite differences.
+    BDFFnBase<TreeVector>* fn = this;
+    if (plist_->isSublist("Jacobian-free Newton-Krylov")) {
+      Teuchos::ParameterList& jfnk_plist = plist_->sublist("Jacobian-free Newton-Krylov");
+      jfnk_plist.sublist("verbose object")
+        .setParametersNotAlreadySet(plist_->sublist("verbose object"));
+      jfnk_ = Teuchos::rcp(new BDFFnJFNK(jfnk_plist, *fn));
+      fn = jfnk_.get();
+    }
+    if (plist_->isSublist("preconditioner reuse")) {
+      Teuchos::ParameterList& reuse_plist = plist_->sublist("preconditioner reuse");
+      reuse_plist.sublist("verbose object")
+        .setParametersNotAlreadySet(plist_->sublist("verbose object"));
+      precon_reuse_ = Teuchos::rcp(new BDFFnPreconditionerReuse(reuse_plist, *fn));
+      fn = precon_reuse_.get();
+    }
+    if (plist_->isSublist("predictor")) {
+      Teuchos::ParameterList& pred_plist = plist_->sublist("predictor");
+      pred_plist.sublist("verbose object")
+        .setParametersNotAlreadySet(plist_->sublist("verbose object"));
+      predictor_ = Teuchos::rcp(new BDFFnPredictor(pred_plist, *fn));
+      fn = predictor_.get();
+    }
     time_stepper_ =
-      Teuchos::rcp(new BDF1_TI<TreeVector, TreeVectorSpace>(*this, bdf_plist, solution_, S_));
+      Teuchos::rcp(new BDF1_TI<TreeVector, TreeVectorSpace>(*fn, bdf_plist, solution_, S_));
 
     double dt_init = time_stepper_->initial_timestep();
     S_->Assign("dt_internal", Tag(name_), name_, dt_init);
@@ -82,6 +108,7 @@ PK_BDF_Default::Initialize()
 
     // -- set initial state
     time_stepper_->SetInitialState(S_->get_time(), solution_, solution_dot);
+    if (predictor_ != Teuchos::null) predictor_->CommitSolution(S_->get_time(), solution_);
   }
 };
 
@@ -112,6 +139,26 @@ PK_BDF_Default::CommitStep(double t_old, double t_new, const Tag& tag)
     double dt = t_new - t_old;
     if (time_stepper_ != Teuchos::null && dt > 0) {
       time_stepper_->CommitSolution(dt, solution_, true);
+      if (predictor_ != Teuchos::null) predictor_->CommitSolution(t_new, solution_);
+    }
+  }
+}
+
+
+// -----------------------------------------------------------------------------
+// Restarts the time integrator from the primary variables, which were set
+// outside of a step.
+// -----------------------------------------------------------------------------
+void
+PK_BDF_Default::ResetHistory(double t)
+{
+  if (time_stepper_ != Teuchos::null) {
+    State_to_Solution(tag_next_, *solution_);
+    auto solution_dot = Teuchos::rcp(new TreeVector(*solution_, INIT_MODE_ZERO));
+    time_stepper_->SetInitialState(t, solution_, solution_dot);
+    if (predictor_ != Teuchos::null) {
+      predictor_->Reset();
+      predictor_->CommitSolution(t, solution_);
     }
   }
 }
@@ -154,6 +201,10 @@ PK_BDF_Default::AdvanceStep(double t_old, double t_new, bool reinit)
       bool valid = ValidStep();
       if (valid) {
         if (vo_->os_OK(Teuchos::VERB_LOW)) *vo_->os() << "successful advance" << std::endl;
+        if (precon_reuse_ != Teuchos::null && vo_->os_OK(Teuchos::VERB_MEDIUM)) {
+          *vo_->os() << "preconditioner: " << precon_reuse_->num_rebuilds() << " rebuilds, "
+                     << precon_reuse_->num_reuses() << " reuses" << std::endl;
+        }
         // update the timestep size
         if (dt_solver < dt_internal && dt_solver >= dt) {
           // We took a smaller step than we recommended, and it worked fine (not
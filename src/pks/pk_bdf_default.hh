@@ -30,6 +30,23 @@ PKs.
     * `"inverse`" ``[inverse-typed-spec]`` **optional** A Preconditioner_.
       Note that this is only used if this PK is not strongly coupled to other PKs.
 
+    * `"Jacobian-free Newton-Krylov`" ``[jfnk-spec]`` **optional** If
+      provided, nonlinear corrections are computed by a Jacobian-free
+      Newton-Krylov solve which uses this PK's preconditioner as a right
+      preconditioner.  See `Jacobian-free Newton-Krylov`_.  Note that this is
+      only used if this PK is not strongly coupled to other PKs.
+
+    * `"preconditioner reuse`" ``[preconditioner-reuse-spec]`` **optional** If
+      provided, the preconditioner is reused across nonlinear iterations and
+      time steps until it needs rebuilding.  See `Preconditioner reuse`_.
+      Note that this is only used if this PK is not strongly coupled to other
+      PKs.
+
+    * `"predictor`" ``[predictor-spec]`` **optional** If provided, the
+      initial guess of each nonlinear solve is improved using the solution
+      history.  See `Predictor`_.  Note that this is only used if this PK is
+      not strongly coupled to other PKs.
+
     INCLUDES:
 
     - ``[pk-spec]`` This *is a* PK_.
@@ -46,11 +63,15 @@ PKs.
 #include "BDFFnBase.hh"
 #include "BDF1_TI.hh"
 #include "PK_BDF.hh"
+#include "bdf_fn_jfnk.hh"
+#include "bdf_fn_precon_reuse.hh"
+#include "bdf_fn_predictor.hh"
+#include "pk_history.hh"
 
 
 namespace Amanzi {
 
-class PK_BDF_Default : public PK_BDF {
+class PK_BDF_Default : public PK_BDF, virtual public PK_History {
  public:
   PK_BDF_Default(Teuchos::ParameterList& pk_tree,
                  const Teuchos::RCP<Teuchos::ParameterList>& glist,
@@ -80,6 +101,10 @@ class PK_BDF_Default : public PK_BDF {
   // -- Commit any secondary (dependent) variables.
   virtual void CommitStep(double t_old, double t_new, const Tag& tag) override;
 
+  // -- Restart the time integrator from primary variables set outside of a
+  //    step.
+  virtual void ResetHistory(double t) override;
+
   // update the continuation parameter
   virtual void UpdateContinuationParameter(double lambda) override;
 
@@ -115,6 +140,10 @@ class PK_BDF_Default : public PK_BDF {
 
   // timestep control
   Teuchos::RCP<BDF1_TI<TreeVector, TreeVectorSpace>> time_stepper_;
+  // optional wrappers seen by the time integrator
+  Teuchos::RCP<BDFFnPreconditionerReuse> precon_reuse_;
+  Teuchos::RCP<BDFFnJFNK> jfnk_;
+  Teuchos::RCP<BDFFnPredictor> predictor_;
 
   // timing
   Teuchos::RCP<Teuchos::Time> step_walltime_;
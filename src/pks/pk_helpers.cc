@@ -10,6 +10,7 @@
 //! A set of helper functions for doing common things in PKs.
 #include "Mesh_Algorithms.hh"
 #include "Chemistry_PK.hh"
+#include "mesh_geometry_cache.hh"
 #include "pk_helpers.hh"
 
 namespace Amanzi {
@@ -315,6 +316,7 @@ copyVectorToMeshCoordinates(const CompositeVector& vec, AmanziMesh::Mesh& mesh)
     }
   }
   mesh.deform(node_ids, new_positions);
+  MeshGeometryCache::Invalidate(mesh);
 }
 
 int
@@ -0,0 +1,47 @@
+/*
+  Copyright 2010-202x held jointly by participating institutions.
+  ATS is released under the three-clause BSD License.
+  The terms of use and "as is" disclaimer for this license are
+  provided in the top-level COPYRIGHT file.
+
+  Authors:
+*/
+
+//! Interface of PKs that keep history across time steps.
+/*!
+
+Time integrators and predictors keep the history of the solution, and the old
+value of a conserved quantity is copied forward at each commit.  When primary
+variables are set outside of a step, e.g. by spin-up acceleration, that
+history no longer applies.  ResetHistory() restarts it from the primary
+variables at the PK's next tag, as if the simulation started there at time t.
+
+Unlike a commit, this is never called as part of a step, so PKs may assume
+all evaluators are initialized.  MPCs forward it to their sub-PKs.
+
+*/
+
+#pragma once
+
+#include "PK.hh"
+
+namespace Amanzi {
+
+class PK_History {
+ public:
+  virtual ~PK_History() = default;
+
+  // Restarts history from the primary variables, set at time t.
+  virtual void ResetHistory(double t) = 0;
+};
+
+
+// Calls ResetHistory() on pk, if it keeps history.
+inline void
+resetHistory(PK& pk, double t)
+{
+  auto pk_history = dynamic_cast<PK_History*>(&pk);
+  if (pk_history != nullptr) pk_history->ResetHistory(t);
+}
+
+} // namespace Amanzi
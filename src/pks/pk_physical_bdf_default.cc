@@ -134,12 +134,12 @@ PK_PhysicalBDF_Default::ErrorNorm(Teuchos::RCP<const TreeVector> u,
       // error in flux -- relative to cell's extensive conserved quantity
       int nfaces = dvec->size(*comp, false);
 
+      int cells[2];
       for (unsigned int f = 0; f != nfaces; ++f) {
-        AmanziMesh::Entity_ID_List cells;
-        mesh_->face_get_cells(f, AmanziMesh::Parallel_type::OWNED, &cells);
+        int ncells = mesh_geom_->face_cells(f, true, cells);
         double cv_min =
-          cells.size() == 1 ? cv[0][cells[0]] : std::min(cv[0][cells[0]], cv[0][cells[1]]);
-        double conserved_min = cells.size() == 1 ?
+          ncells == 1 ? cv[0][cells[0]] : std::min(cv[0][cells[0]], cv[0][cells[1]]);
+        double conserved_min = ncells == 1 ?
                                  conserved[0][cells[0]] :
                                  std::min(conserved[0][cells[0]], conserved[0][cells[1]]);
 
@@ -202,6 +202,16 @@ PK_PhysicalBDF_Default::CommitStep(double t_old, double t_new, const Tag& tag_ne
 }
 
 
+// The conserved quantity, recomputed from the new primary variable, becomes
+// the old value of the next step.
+void
+PK_PhysicalBDF_Default::ResetHistory(double t)
+{
+  assign(conserved_key_, tag_current_, tag_next_, *S_);
+  PK_BDF_Default::ResetHistory(t);
+}
+
+
 void
 PK_PhysicalBDF_Default::FailStep(double t_old, double t_new, const Tag& tag)
 {
@@ -103,6 +103,9 @@ class PK_PhysicalBDF_Default : public PK_BDF_Default, public PK_Physical_Default
   virtual void CommitStep(double t_old, double t_new, const Tag& tag) override;
   virtual void FailStep(double t_old, double t_new, const Tag& tag) override;
 
+  // -- Restart history from primary variables set outside of a step.
+  virtual void ResetHistory(double t) override;
+
   // -- Experimental approach -- calling this indicates that the time
   //    integration scheme is changing the value of the solution in
   //    state.
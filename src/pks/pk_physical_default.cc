@@ -30,6 +30,9 @@ PK_Physical_Default::PK_Physical_Default(Teuchos::ParameterList& pk_tree,
 
   // primary variable max change
   max_valid_change_ = plist_->get<double>("max valid change", -1.0);
+
+  if (plist_->get<bool>("use evaluation plan", false))
+    eval_plan_ = Teuchos::rcp(new EvaluationPlan(name_));
 }
 
 // -----------------------------------------------------------------------------
@@ -41,6 +44,7 @@ PK_Physical_Default::Setup()
 {
   // get the mesh
   mesh_ = S_->GetMesh(domain_);
+  mesh_geom_ = MeshGeometryCache::Get(mesh_);
 
   // set up the debugger
   Teuchos::RCP<Teuchos::ParameterList> vo_plist = plist_;
@@ -150,4 +154,14 @@ PK_Physical_Default::Initialize()
 };
 
 
+// -----------------------------------------------------------------------------
+// Update a secondary variable on behalf of this PK.
+// -----------------------------------------------------------------------------
+bool
+PK_Physical_Default::UpdateEvaluator_(const Key& key, const Tag& tag)
+{
+  return updateEvaluator(eval_plan_, *S_, key, tag, name_);
+}
+
+
 } // namespace Amanzi
@@ -29,6 +29,12 @@ all leaves of the PK tree will inherit from `PKPhysicalBase`.
       invalid and the timestep shrinks.  By default, any change is valid.
       Units are the same as the primary variable.
 
+    * `"use evaluation plan`" ``[bool]`` **false** If true, secondary
+      variables this PK updates through UpdateEvaluator_() are only updated
+      if a primary or independent variable upstream of them has changed,
+      rather than walking their dependency graph on each update.  Requires
+      that secondary variables declare all of their dependencies.
+
     INCLUDES:
 
     - ``[pk-spec]`` This *is a* PK_.
@@ -42,6 +48,8 @@ all leaves of the PK tree will inherit from `PKPhysicalBase`.
 #include "TreeVector.hh"
 
 #include "Debugger.hh"
+#include "mesh_geometry_cache.hh"
+#include "evaluation_plan.hh"
 
 #include "EvaluatorPrimary.hh"
 #include "PK.hh"
@@ -70,10 +78,21 @@ class PK_Physical_Default : public PK_Physical {
   virtual void CommitStep(double t_old, double t_new, const Tag& tag) override;
   virtual void FailStep(double t_old, double t_new, const Tag& tag) override;
 
+ protected:
+  // Updates key at tag on behalf of this PK, returning true if it has
+  // changed, through the evaluation plan if one is used.
+  bool UpdateEvaluator_(const Key& key, const Tag& tag);
+
  protected:
   // step validity
   double max_valid_change_;
 
+  // flat geometry and topology of mesh_, for hot loops
+  Teuchos::RCP<MeshGeometryCache> mesh_geom_;
+
+  // optional, skips updates of secondary variables whose inputs are unchanged
+  Teuchos::RCP<EvaluationPlan> eval_plan_;
+
   // ENORM struct
   typedef struct ENorm_t {
     double value;
@@ -0,0 +1,91 @@
+/*
+  Copyright 2010-202x held jointly by participating institutions.
+  ATS is released under the three-clause BSD License.
+  The terms of use and "as is" disclaimer for this license are
+  provided in the top-level COPYRIGHT file.
+
+  Authors:
+*/
+
+/*
+  A secondary variable, key = 2 * dependency, both at the next tag, for
+  testing how evaluators are updated.  Evaluations are counted, and if
+  throws is set, evaluation throws instead.
+*/
+
+#pragma once
+
+#include <atomic>
+
+#include "Teuchos_ParameterList.hpp"
+
+#include "errors.hh"
+#include "CompositeVector.hh"
+#include "State.hh"
+#include "EvaluatorSecondaryMonotype.hh"
+
+namespace Amanzi {
+namespace Testing {
+
+class DoubledEvaluator : public EvaluatorSecondaryMonotypeCV {
+ public:
+  DoubledEvaluator(Teuchos::ParameterList& plist, const Key& dependency)
+    : EvaluatorSecondaryMonotypeCV(plist), dependency_(dependency)
+  {
+    dependencies_.insert(KeyTag{ dependency_, Tags::NEXT });
+  }
+
+  DoubledEvaluator(const DoubledEvaluator& other)
+    : EvaluatorSecondaryMonotypeCV(other), dependency_(other.dependency_)
+  {}
+
+  Teuchos::RCP<Evaluator> Clone() const override
+  {
+    return Teuchos::rcp(new DoubledEvaluator(*this));
+  }
+
+  // Requires key, on mesh, with this evaluator.
+  static Teuchos::RCP<DoubledEvaluator> Require(State& S,
+                                                const Key& key,
+                                                const Key& dependency,
+                                                const Teuchos::RCP<const AmanziMesh::Mesh>& mesh)
+  {
+    S.Require<CompositeVector, CompositeVectorSpace>(key, Tags::NEXT, key)
+      .SetMesh(mesh)
+      ->SetGhosted(false)
+      ->AddComponent("cell", AmanziMesh::CELL, 1);
+    Teuchos::ParameterList plist(key);
+    plist.set<std::string>("tag", Tags::NEXT.get());
+    auto eval = Teuchos::rcp(new DoubledEvaluator(plist, dependency));
+    S.SetEvaluator(key, Tags::NEXT, eval);
+    return eval;
+  }
+
+  std::atomic<int> num_evaluations{ 0 };
+  bool throws = false;
+
+ protected:
+  void Evaluate_(const State& S, const std::vector<CompositeVector*>& result) override
+  {
+    num_evaluations++;
+    if (throws) {
+      Errors::Message msg("DoubledEvaluator: evaluation failed.");
+      Exceptions::amanzi_throw(msg);
+    }
+    result[0]->Update(2., S.Get<CompositeVector>(dependency_, Tags::NEXT), 0.);
+  }
+
+  void EvaluatePartialDerivative_(const State& S,
+                                  const Key& wrt_key,
+                                  const Tag& wrt_tag,
+                                  const std::vector<CompositeVector*>& result) override
+  {
+    result[0]->PutScalar(2.);
+  }
+
+ private:
+  Key dependency_;
+};
+
+} // namespace Testing
+} // namespace Amanzi
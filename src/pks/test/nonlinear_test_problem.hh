@@ -0,0 +1,153 @@
+/*
+  Copyright 2010-202x held jointly by participating institutions.
+  ATS is released under the three-clause BSD License.
+  The terms of use and "as is" disclaimer for this license are
+  provided in the top-level COPYRIGHT file.
+
+  Authors:
+*/
+
+/*
+  A small nonlinear system, posed as a BDFFnBase, for testing the wrappers of
+  BDF PKs.  The residual,
+
+    F(u)_i = u_i^3 + u_i + c u_{i+1} - b_i,
+
+  couples each cell to the next (in local ordering), while the
+  "preconditioner" is the inverse of the diagonal of the Jacobian only,
+  mimicking a coupled PK whose preconditioner drops off-diagonal blocks.
+  Calls are counted.
+*/
+
+#pragma once
+
+#include <cmath>
+
+#include "Teuchos_RCP.hpp"
+
+#include "AmanziComm.hh"
+#include "GeometricModel.hh"
+#include "MeshFactory.hh"
+#include "CompositeVector.hh"
+#include "TreeVector.hh"
+#include "BDFFnBase.hh"
+
+namespace Amanzi {
+namespace Testing {
+
+class NonlinearTestProblem : public BDFFnBase<TreeVector> {
+ public:
+  explicit NonlinearTestProblem(int ncells, double coupling = 0.5) : c_(coupling)
+  {
+    auto comm = getDefaultComm();
+    auto gm = Teuchos::rcp(new AmanziGeometry::GeometricModel(3));
+    AmanziMesh::MeshFactory factory(comm, gm);
+    auto mesh = factory.create(0., 0., 0., 1., 1., 1., ncells, 1, 1);
+
+    CompositeVectorSpace cvs;
+    cvs.SetMesh(mesh)->SetGhosted(false)->AddComponent("cell", AmanziMesh::CELL, 1);
+    auto cv = Teuchos::rcp(new CompositeVector(cvs));
+    cv->PutScalar(0.);
+    space_ = Teuchos::rcp(new TreeVector());
+    space_->SetData(cv);
+
+    b_ = Create();
+    auto& b = *b_->Data()->ViewComponent("cell", false);
+    for (int i = 0; i != b.MyLength(); ++i) b[0][i] = 1. + 0.1 * i;
+  }
+
+  // a new vector, initialized to zero
+  Teuchos::RCP<TreeVector> Create() const
+  {
+    return Teuchos::rcp(new TreeVector(*space_, INIT_MODE_ZERO));
+  }
+
+  void FunctionalResidual(double t_old,
+                          double t_new,
+                          Teuchos::RCP<TreeVector> u_old,
+                          Teuchos::RCP<TreeVector> u_new,
+                          Teuchos::RCP<TreeVector> f) override
+  {
+    num_residuals++;
+    const auto& u = *u_new->Data()->ViewComponent("cell", false);
+    const auto& b = *b_->Data()->ViewComponent("cell", false);
+    auto& r = *f->Data()->ViewComponent("cell", false);
+    int n = u.MyLength();
+    for (int i = 0; i != n; ++i) {
+      r[0][i] = std::pow(u[0][i], 3) + u[0][i] - b[0][i];
+      if (i + 1 < n) r[0][i] += c_ * u[0][i + 1];
+    }
+    last_residual_u = u[0][0];
+  }
+
+  int ApplyPreconditioner(Teuchos::RCP<const TreeVector> r, Teuchos::RCP<TreeVector> Pr) override
+  {
+    num_preconditioner_applications++;
+    const auto& rr = *r->Data()->ViewComponent("cell", false);
+    auto& pr = *Pr->Data()->ViewComponent("cell", false);
+    const auto& u = *u_pc_->Data()->ViewComponent("cell", false);
+    for (int i = 0; i != rr.MyLength(); ++i) pr[0][i] = rr[0][i] / (3. * u[0][i] * u[0][i] + 1.);
+    return 0;
+  }
+
+  // The exact Jacobian, applied at u.
+  void ApplyJacobian(const TreeVector& u_tv, const TreeVector& v_tv, TreeVector& Jv_tv) const
+  {
+    const auto& u = *u_tv.Data()->ViewComponent("cell", false);
+    const auto& v = *v_tv.Data()->ViewComponent("cell", false);
+    auto& Jv = *Jv_tv.Data()->ViewComponent("cell", false);
+    int n = u.MyLength();
+    for (int i = 0; i != n; ++i) {
+      Jv[0][i] = (3. * u[0][i] * u[0][i] + 1.) * v[0][i];
+      if (i + 1 < n) Jv[0][i] += c_ * v[0][i + 1];
+    }
+  }
+
+  double ErrorNorm(Teuchos::RCP<const TreeVector> u, Teuchos::RCP<const TreeVector> du) override
+  {
+    double norm;
+    du->NormInf(&norm);
+    return norm;
+  }
+
+  void UpdatePreconditioner(double t, Teuchos::RCP<const TreeVector> up, double h) override
+  {
+    num_preconditioner_updates++;
+    if (u_pc_ == Teuchos::null) u_pc_ = Create();
+    *u_pc_ = *up;
+  }
+
+  bool IsAdmissible(Teuchos::RCP<const TreeVector> up) override { return true; }
+
+  bool
+  ModifyPredictor(double h, Teuchos::RCP<const TreeVector> u0, Teuchos::RCP<TreeVector> u) override
+  {
+    return false;
+  }
+
+  AmanziSolvers::FnBaseDefs::ModifyCorrectionResult
+  ModifyCorrection(double h,
+                   Teuchos::RCP<const TreeVector> res,
+                   Teuchos::RCP<const TreeVector> u,
+                   Teuchos::RCP<TreeVector> du) override
+  {
+    return AmanziSolvers::FnBaseDefs::CORRECTION_NOT_MODIFIED;
+  }
+
+  void ChangedSolution() override { num_changed_solutions++; }
+
+  int num_residuals = 0;
+  int num_preconditioner_applications = 0;
+  int num_preconditioner_updates = 0;
+  int num_changed_solutions = 0;
+  double last_residual_u = 0.; // u_0 at the last residual evaluation
+
+ private:
+  double c_;
+  Teuchos::RCP<TreeVector> space_;
+  Teuchos::RCP<TreeVector> b_;
+  Teuchos::RCP<TreeVector> u_pc_;
+};
+
+} // namespace Testing
+} // namespace Amanzi
@@ -0,0 +1,149 @@
+/*
+  Copyright 2010-202x held jointly by participating institutions.
+  ATS is released under the three-clause BSD License.
+  The terms of use and "as is" disclaimer for this license are
+  provided in the top-level COPYRIGHT file.
+
+  Authors:
+*/
+
+#include <algorithm>
+
+#include <UnitTest++.h>
+
+#include "Epetra_Map.h"
+#include "Epetra_MultiVector.h"
+
+#include "AmanziComm.hh"
+#include "errors.hh"
+#include "anderson_accelerator.hh"
+
+using namespace Amanzi;
+
+namespace {
+
+// The linear contraction G(x) = A x + b, where A is lower bidiagonal with
+// diagonal entries in [0.5, 0.95) and sub-diagonal 0.1, so that the fixed
+// point iteration converges slowly.  Its fixed point solves (I - A) x = b.
+struct LinearContraction {
+  explicit LinearContraction(int n_local)
+    : map(-1, n_local, 0, *getDefaultComm()), x(map, 2), g(map, 2)
+  {}
+
+  void apply(const Epetra_MultiVector& x_in, Epetra_MultiVector& g_out) const
+  {
+    int n = x_in.MyLength();
+    for (int v = 0; v != x_in.NumVectors(); ++v) {
+      for (int i = 0; i != n; ++i) {
+        double diag = 0.5 + 0.45 * i / n;
+        g_out[v][i] = diag * x_in[v][i] + 1. + v;
+        if (i > 0) g_out[v][i] += 0.1 * x_in[v][i - 1];
+      }
+    }
+  }
+
+  // iterations of Update() to a residual of tol, or max_itrs
+  int solve(AndersonAccelerator& anderson, double tol, int max_itrs)
+  {
+    x.PutScalar(0.);
+    for (int itr = 0; itr != max_itrs; ++itr) {
+      apply(x, g);
+      g.Update(-1., x, 1.);
+      double norms[2];
+      g.NormInf(norms);
+      if (std::max(norms[0], norms[1]) < tol) return itr;
+      g.Update(1., x, 1.);
+      anderson.Update(x, g);
+    }
+    return max_itrs;
+  }
+
+  Epetra_Map map;
+  Epetra_MultiVector x, g;
+};
+
+} // namespace
+
+
+SUITE(ANDERSON_ACCELERATOR)
+{
+  // Depth 0 with no relaxation is the fixed point iteration.
+  TEST(ANDERSON_DEPTH_ZERO_IS_PICARD)
+  {
+    LinearContraction problem(8);
+    AndersonAccelerator anderson(0, 1.);
+    problem.x.PutScalar(1.);
+    problem.apply(problem.x, problem.g);
+    Epetra_MultiVector expected(problem.g);
+    anderson.Update(problem.x, problem.g);
+    expected.Update(-1., problem.x, 1.);
+    double norms[2];
+    expected.NormInf(norms);
+    CHECK_EQUAL(0., norms[0]);
+    CHECK_EQUAL(0., norms[1]);
+  }
+
+
+  // Mixing converges to the same fixed point in far fewer iterations.
+  TEST(ANDERSON_ACCELERATES_LINEAR_CONTRACTION)
+  {
+    LinearContraction problem(8);
+    AndersonAccelerator picard(0, 1.);
+    int picard_itrs = problem.solve(picard, 1.e-10, 1000);
+    Epetra_MultiVector x_picard(problem.x);
+    CHECK(picard_itrs < 1000);
+
+    AndersonAccelerator anderson(5, 1.);
+    int anderson_itrs = problem.solve(anderson, 1.e-10, 1000);
+    CHECK(anderson_itrs < picard_itrs / 2);
+
+    x_picard.Update(-1., problem.x, 1.);
+    double norms[2];
+    x_picard.NormInf(norms);
+    CHECK(norms[0] < 1.e-8 && norms[1] < 1.e-8);
+
+    // after a reset, the history of the previous solve is not used
+    anderson.Reset();
+    CHECK_EQUAL(anderson_itrs, problem.solve(anderson, 1.e-10, 1000));
+  }
+
+
+  // An accelerator restored from the history of another, e.g. on restart,
+  // computes the same next iterate.
+  TEST(ANDERSON_HISTORY_RESTORED)
+  {
+    LinearContraction problem(8);
+    AndersonAccelerator anderson(3, 0.8);
+    CHECK(anderson.history().empty());
+    for (int itr = 0; itr != 5; ++itr) {
+      problem.apply(problem.x, problem.g);
+      anderson.Update(problem.x, problem.g);
+    }
+    auto history = anderson.history();
+    CHECK_EQUAL(8, (int)history.size());
+
+    AndersonAccelerator restored(3, 0.8);
+    restored.set_history(history);
+    problem.apply(problem.x, problem.g);
+    Epetra_MultiVector x_restored(problem.x);
+    anderson.Update(problem.x, problem.g);
+    restored.Update(x_restored, problem.g);
+
+    x_restored.Update(-1., problem.x, 1.);
+    double norms[2];
+    x_restored.NormInf(norms);
+    CHECK_EQUAL(0., norms[0]);
+    CHECK_EQUAL(0., norms[1]);
+
+    // histories deeper than the depth are rejected
+    AndersonAccelerator shallow(2, 0.8);
+    CHECK_THROW(shallow.set_history(history), Errors::Message);
+  }
+
+
+  TEST(ANDERSON_INVALID)
+  {
+    CHECK_THROW(AndersonAccelerator(-1, 1.), Errors::Message);
+    CHECK_THROW(AndersonAccelerator(3, 0.), Errors::Message);
+  }
+}
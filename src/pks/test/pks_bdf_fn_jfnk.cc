@@ -0,0 +1,165 @@
+/*
+  Copyright 2010-202x held jointly by participating institutions.
+  ATS is released under the three-clause BSD License.
+  The terms of use and "as is" disclaimer for this license are
+  provided in the top-level COPYRIGHT file.
+
+  Authors:
+*/
+
+#include <UnitTest++.h>
+
+#include "Teuchos_ParameterList.hpp"
+
+#include "bdf_fn_jfnk.hh"
+#include "nonlinear_test_problem.hh"
+
+using namespace Amanzi;
+
+namespace {
+
+double
+norm2(const TreeVector& v)
+{
+  double norm;
+  v.Norm2(&norm);
+  return norm;
+}
+
+} // namespace
+
+
+SUITE(BDF_FN_JFNK)
+{
+  // One preconditioner application solves the true Jacobian system, and
+  // leaves the solution, and the last residual, at the current iterate.
+  TEST(JFNK_SOLVES_JACOBIAN_SYSTEM)
+  {
+    Testing::NonlinearTestProblem fn(10);
+    Teuchos::ParameterList plist("JFNK");
+    plist.set<double>("linear tolerance", 1.e-10);
+    plist.set<int>("maximum linear iterations", 10);
+    BDFFnJFNK jfnk(plist, fn);
+
+    auto u_old = fn.Create();
+    auto u = fn.Create();
+    u->PutScalar(0.7);
+    auto f = fn.Create();
+    auto du = fn.Create();
+
+    fn.UpdatePreconditioner(1., u, 1.);
+    jfnk.FunctionalResidual(0., 1., u_old, u, f);
+    int n_residuals = fn.num_residuals;
+    auto u_copy = fn.Create();
+    *u_copy = *u;
+
+    CHECK_EQUAL(0, jfnk.ApplyPreconditioner(f, du));
+
+    // J du = f, up to the finite difference error
+    auto Jdu = fn.Create();
+    fn.ApplyJacobian(*u, *du, *Jdu);
+    Jdu->Update(-1., *f, 1.);
+    CHECK(norm2(*Jdu) < 1.e-5 * norm2(*f));
+
+    // the solution is restored, and the residual re-evaluated there
+    u_copy->Update(-1., *u, 1.);
+    CHECK_EQUAL(0., norm2(*u_copy));
+    CHECK_EQUAL(0.7, fn.last_residual_u);
+
+    // one residual per GMRES iteration, plus one to restore
+    int n_pc = fn.num_preconditioner_applications;
+    CHECK(n_pc > 1 && n_pc <= 10);
+    CHECK_EQUAL(n_residuals + n_pc + 1, fn.num_residuals);
+  }
+
+
+  // Newton iterations with the JFNK correction converge quadratically, while
+  // the diagonal preconditioner alone converges only linearly.
+  TEST(JFNK_NEWTON_CONVERGES)
+  {
+    auto newton = [](BDFFnBase<TreeVector>& fn, Testing::NonlinearTestProblem& problem) {
+      auto u_old = problem.Create();
+      auto u = problem.Create();
+      u->PutScalar(1.);
+      auto f = problem.Create();
+      auto du = problem.Create();
+
+      for (int itr = 0; itr != 50; ++itr) {
+        fn.FunctionalResidual(0., 1., u_old, u, f);
+        if (norm2(*f) < 1.e-10) return itr;
+        fn.UpdatePreconditioner(1., u, 1.);
+        fn.ApplyPreconditioner(f, du);
+        u->Update(-1., *du, 1.);
+        fn.ChangedSolution();
+      }
+      return 50;
+    };
+
+    Testing::NonlinearTestProblem fn(10);
+    Teuchos::ParameterList plist("JFNK");
+    plist.set<double>("linear tolerance", 1.e-8);
+    plist.set<int>("maximum linear iterations", 10);
+    BDFFnJFNK jfnk(plist, fn);
+    int jfnk_itrs = newton(jfnk, fn);
+    CHECK(jfnk_itrs <= 7);
+
+    Testing::NonlinearTestProblem fn_diag(10);
+    int diag_itrs = newton(fn_diag, fn_diag);
+    CHECK(jfnk_itrs < diag_itrs);
+  }
+
+
+  // If the iterate changed since the last residual, the residual is
+  // evaluated again, and the Jacobian is differenced about the new iterate.
+  TEST(JFNK_STALE_RESIDUAL_RECOMPUTED)
+  {
+    Testing::NonlinearTestProblem fn(10);
+    Teuchos::ParameterList plist("JFNK");
+    plist.set<double>("linear tolerance", 1.e-10);
+    plist.set<int>("maximum linear iterations", 10);
+    BDFFnJFNK jfnk(plist, fn);
+
+    auto u_old = fn.Create();
+    auto u = fn.Create();
+    u->PutScalar(0.7);
+    auto f = fn.Create();
+    auto du = fn.Create();
+
+    fn.UpdatePreconditioner(1., u, 1.);
+    jfnk.FunctionalResidual(0., 1., u_old, u, f);
+    u->PutScalar(0.9);
+    jfnk.ChangedSolution();
+    int n_residuals = fn.num_residuals;
+
+    CHECK_EQUAL(0, jfnk.ApplyPreconditioner(f, du));
+
+    // J(0.9) du = f
+    auto Jdu = fn.Create();
+    fn.ApplyJacobian(*u, *du, *Jdu);
+    Jdu->Update(-1., *f, 1.);
+    CHECK(norm2(*Jdu) < 1.e-5 * norm2(*f));
+    CHECK_EQUAL(0.9, fn.last_residual_u);
+
+    // one more residual than with a current one
+    int n_pc = fn.num_preconditioner_applications;
+    CHECK_EQUAL(n_residuals + n_pc + 2, fn.num_residuals);
+  }
+
+
+  // Without a residual at the current iterate, there is nothing to
+  // difference about, and the PK's preconditioner is applied.
+  TEST(JFNK_NO_RESIDUAL_FORWARDS)
+  {
+    Testing::NonlinearTestProblem fn(4);
+    Teuchos::ParameterList plist("JFNK");
+    BDFFnJFNK jfnk(plist, fn);
+
+    auto u = fn.Create();
+    u->PutScalar(1.);
+    auto du = fn.Create();
+    fn.UpdatePreconditioner(1., u, 1.);
+    jfnk.ApplyPreconditioner(u, du);
+    CHECK_EQUAL(1, fn.num_preconditioner_applications);
+    CHECK_EQUAL(0, fn.num_residuals);
+  }
+}
@@ -0,0 +1,132 @@
+/*
+  Copyright 2010-202x held jointly by participating institutions.
+  ATS is released under the three-clause BSD License.
+  The terms of use and "as is" disclaimer for this license are
+  provided in the top-level COPYRIGHT file.
+
+  Authors:
+*/
+
+#include <UnitTest++.h>
+
+#include "Teuchos_ParameterList.hpp"
+
+#include "bdf_fn_precon_reuse.hh"
+#include "nonlinear_test_problem.hh"
+
+using namespace Amanzi;
+
+namespace {
+
+// The policy, with each rebuild reason enabled on its own.
+struct ReuseProblem {
+  ReuseProblem() : fn(4)
+  {
+    plist.set<int>("maximum reuse count", 1000);
+    plist.set<double>("time step size tolerance", 1.e10);
+    plist.set<double>("maximum error ratio", 1.e10);
+    u = fn.Create();
+    u->PutScalar(1.);
+    du = fn.Create();
+  }
+
+  // updates the preconditioner, returning true if fn rebuilt it
+  bool update(BDFFnPreconditionerReuse& reuse, double t, double h)
+  {
+    int n_updates = fn.num_preconditioner_updates;
+    reuse.UpdatePreconditioner(t, u, h);
+    return fn.num_preconditioner_updates > n_updates;
+  }
+
+  // a nonlinear iteration of the solve ending at t_new, with error norm
+  // the max of du
+  void iterate(BDFFnPreconditionerReuse& reuse, double t_new, double norm)
+  {
+    auto f = fn.Create();
+    reuse.FunctionalResidual(t_new - 1., t_new, u, u, f);
+    du->PutScalar(norm);
+    reuse.ErrorNorm(u, du);
+  }
+
+  Testing::NonlinearTestProblem fn;
+  Teuchos::ParameterList plist;
+  Teuchos::RCP<TreeVector> u, du;
+};
+
+} // namespace
+
+
+SUITE(BDF_FN_PRECON_REUSE)
+{
+  // The first update builds, and then up to "maximum reuse count" updates in
+  // a row are skipped.
+  TEST_FIXTURE(ReuseProblem, REUSE_COUNT)
+  {
+    plist.set<int>("maximum reuse count", 2);
+    BDFFnPreconditionerReuse reuse(plist, fn);
+
+    CHECK(update(reuse, 1., 1.));
+    CHECK(!update(reuse, 2., 1.));
+    CHECK(!update(reuse, 3., 1.));
+    CHECK(update(reuse, 4., 1.));
+    CHECK(!update(reuse, 5., 1.));
+    CHECK_EQUAL(2, reuse.num_rebuilds());
+    CHECK_EQUAL(3, reuse.num_reuses());
+  }
+
+
+  // A change in time step size beyond the tolerance, relative to the size the
+  // preconditioner was built with, rebuilds.
+  TEST_FIXTURE(ReuseProblem, REUSE_TIME_STEP_SIZE)
+  {
+    plist.set<double>("time step size tolerance", 0.1);
+    BDFFnPreconditionerReuse reuse(plist, fn);
+
+    CHECK(update(reuse, 1., 1.));
+    CHECK(!update(reuse, 2.05, 1.05));
+    CHECK(!update(reuse, 3., 0.95));
+    CHECK(update(reuse, 4.2, 1.2));
+    CHECK(!update(reuse, 5.3, 1.1)); // within 0.1 of 1.2
+    CHECK(update(reuse, 6.3, 1.));
+  }
+
+
+  // A retried step, which starts before the time the preconditioner was
+  // built at, rebuilds, even with the same time step size.
+  TEST_FIXTURE(ReuseProblem, REUSE_STEP_RETRIED)
+  {
+    BDFFnPreconditionerReuse reuse(plist, fn);
+
+    CHECK(update(reuse, 2., 1.));
+    CHECK(!update(reuse, 2., 1.));
+    CHECK(update(reuse, 1.5, 1.));
+    CHECK(!update(reuse, 2.5, 1.));
+  }
+
+
+  // An error ratio above the maximum within one solve rebuilds at the next
+  // update, while the first iterate of a new solve is not compared to the
+  // last one of the previous solve.
+  TEST_FIXTURE(ReuseProblem, REUSE_SLOW_CONVERGENCE)
+  {
+    plist.set<double>("maximum error ratio", 0.5);
+    BDFFnPreconditionerReuse reuse(plist, fn);
+
+    CHECK(update(reuse, 1., 1.));
+    iterate(reuse, 1., 1.);
+    iterate(reuse, 1., 0.1);
+    iterate(reuse, 1., 0.01);
+    CHECK(!update(reuse, 1., 1.));
+
+    // a new solve, starting from a larger error
+    iterate(reuse, 2., 1.);
+    iterate(reuse, 2., 0.4);
+    CHECK(!update(reuse, 2., 1.));
+    iterate(reuse, 2., 0.3);
+    CHECK(update(reuse, 2., 1.));
+
+    // the rebuild clears the flag
+    iterate(reuse, 2., 0.1);
+    CHECK(!update(reuse, 2., 1.));
+  }
+}
@@ -0,0 +1,130 @@
+/*
+  Copyright 2010-202x held jointly by participating institutions.
+  ATS is released under the three-clause BSD License.
+  The terms of use and "as is" disclaimer for this license are
+  provided in the top-level COPYRIGHT file.
+
+  Authors:
+*/
+
+#include <UnitTest++.h>
+
+#include "Teuchos_ParameterList.hpp"
+
+#include "bdf_fn_jfnk.hh"
+#include "bdf_fn_predictor.hh"
+#include "nonlinear_test_problem.hh"
+
+using namespace Amanzi;
+
+namespace {
+
+// u(t) = 1 + t + t^2 / 2, in every cell
+double
+quadratic(double t)
+{
+  return 1. + t + 0.5 * t * t;
+}
+
+double
+firstValue(const TreeVector& u)
+{
+  return (*u.Data()->ViewComponent("cell", false))[0][0];
+}
+
+} // namespace
+
+
+SUITE(BDF_FN_PREDICTOR)
+{
+  // Second order extrapolation through three accepted solutions is exact for
+  // a quadratic in time, for steps of varying size.
+  TEST(PREDICTOR_EXTRAPOLATION)
+  {
+    Testing::NonlinearTestProblem fn(4);
+    Teuchos::ParameterList plist("predictor");
+    BDFFnPredictor predictor(plist, fn);
+
+    auto u = fn.Create();
+    for (double t : { 0., 1., 3. }) {
+      u->PutScalar(quadratic(t));
+      predictor.CommitSolution(t, u);
+    }
+
+    auto u0 = fn.Create();
+    *u0 = *u;
+    auto u_pred = fn.Create();
+    u_pred->PutScalar(-1.);
+    CHECK(predictor.ModifyPredictor(0.5, u0, u_pred));
+    CHECK_CLOSE(quadratic(3.5), firstValue(*u_pred), 1.e-12);
+  }
+
+
+  // After a reset, e.g. a spin-up jump, the old history is not extrapolated.
+  TEST(PREDICTOR_RESET)
+  {
+    Testing::NonlinearTestProblem fn(4);
+    Teuchos::ParameterList plist("predictor");
+    BDFFnPredictor predictor(plist, fn);
+
+    auto u = fn.Create();
+    for (double t : { 0., 1., 3. }) {
+      u->PutScalar(quadratic(t));
+      predictor.CommitSolution(t, u);
+    }
+    predictor.Reset();
+    u->PutScalar(5.);
+    predictor.CommitSolution(3., u);
+
+    // with one solution, the time integrator's predictor is kept
+    auto u_pred = fn.Create();
+    u_pred->PutScalar(-1.);
+    CHECK(!predictor.ModifyPredictor(0.5, u, u_pred));
+    CHECK_EQUAL(-1., firstValue(*u_pred));
+
+    u->PutScalar(6.);
+    predictor.CommitSolution(4., u);
+    CHECK(predictor.ModifyPredictor(1., u, u_pred));
+    CHECK_CLOSE(7., firstValue(*u_pred), 1.e-12);
+  }
+
+
+  // Only the nonlinear solver's residual evaluations are counted as
+  // iterations, not those of the JFNK wrapper inside the predictor.
+  TEST(PREDICTOR_COUNTS_SOLVER_ITERATIONS)
+  {
+    Testing::NonlinearTestProblem fn(10);
+    Teuchos::ParameterList jfnk_plist("JFNK");
+    BDFFnJFNK jfnk(jfnk_plist, fn);
+    Teuchos::ParameterList pred_plist("predictor");
+    BDFFnPredictor predictor(pred_plist, jfnk);
+
+    auto u_old = fn.Create();
+    u_old->PutScalar(1.);
+    predictor.CommitSolution(0., u_old);
+
+    auto u = fn.Create();
+    *u = *u_old;
+    predictor.ModifyPredictor(1., u_old, u);
+
+    auto f = fn.Create();
+    auto du = fn.Create();
+    int n_residuals = 0;
+    for (int itr = 0; itr != 20; ++itr) {
+      predictor.FunctionalResidual(0., 1., u_old, u, f);
+      n_residuals++;
+      double norm;
+      f->Norm2(&norm);
+      if (norm < 1.e-10) break;
+      predictor.UpdatePreconditioner(1., u, 1.);
+      predictor.ApplyPreconditioner(f, du);
+      u->Update(-1., *du, 1.);
+      predictor.ChangedSolution();
+    }
+    predictor.CommitSolution(1., u);
+
+    CHECK_EQUAL(1, predictor.num_steps());
+    CHECK_EQUAL(n_residuals, predictor.num_iterations());
+    CHECK(fn.num_residuals > n_residuals);
+  }
+}
@@ -0,0 +1,177 @@
+/*
+  Copyright 2010-202x held jointly by participating institutions.
+  ATS is released under the three-clause BSD License.
+  The terms of use and "as is" disclaimer for this license are
+  provided in the top-level COPYRIGHT file.
+
+  Authors:
+*/
+
+#include <UnitTest++.h>
+
+#include "Teuchos_ParameterList.hpp"
+
+#include "AmanziComm.hh"
+#include "GeometricModel.hh"
+#include "MeshFactory.hh"
+#include "State.hh"
+#include "errors.hh"
+#include "chemistry_activity_tracker.hh"
+
+using namespace Amanzi;
+
+namespace {
+
+// Two components and temperature, without saturation, on four cells per rank.
+struct ActivityProblem {
+  ActivityProblem()
+  {
+    auto comm = getDefaultComm();
+    auto gm = Teuchos::rcp(new AmanziGeometry::GeometricModel(3));
+    AmanziMesh::MeshFactory factory(comm, gm);
+    auto mesh = factory.create(0., 0., 0., 1., 1., 1., 4 * comm->NumProc(), 1, 1);
+    ncells_global = 4 * comm->NumProc();
+
+    Teuchos::ParameterList state_list("state");
+    S = Teuchos::rcp(new State(state_list));
+    S->RegisterMesh("domain", mesh, false);
+    S->require_time(Tags::NEXT);
+    S->Require<CompositeVector, CompositeVectorSpace>(tcc_key, Tags::NEXT, "test")
+      .SetMesh(mesh)
+      ->SetGhosted(false)
+      ->AddComponent("cell", AmanziMesh::CELL, 2);
+    S->Require<CompositeVector, CompositeVectorSpace>(temp_key, Tags::NEXT, "test")
+      .SetMesh(mesh)
+      ->SetGhosted(false)
+      ->AddComponent("cell", AmanziMesh::CELL, 1);
+    S->Setup();
+
+    tcc().PutScalar(1.e-3);
+    temp().PutScalar(280.);
+  }
+
+  Epetra_MultiVector& tcc()
+  {
+    return *S->GetW<CompositeVector>(tcc_key, Tags::NEXT, "test").ViewComponent("cell", false);
+  }
+  Epetra_MultiVector& temp()
+  {
+    return *S->GetW<CompositeVector>(temp_key, Tags::NEXT, "test").ViewComponent("cell", false);
+  }
+
+  ChemistryActivityTracker createTracker(Teuchos::ParameterList& plist)
+  {
+    return ChemistryActivityTracker(plist, tcc_key, temp_key, "", Tags::NEXT, "test");
+  }
+
+  Key tcc_key = "total_component_concentration";
+  Key temp_key = "temperature";
+  int ncells_global;
+  Teuchos::RCP<State> S;
+};
+
+} // namespace
+
+
+SUITE(CHEMISTRY_ACTIVITY_TRACKER)
+{
+  TEST_FIXTURE(ActivityProblem, ACTIVITY_SKIP_AND_SOLVE)
+  {
+    Teuchos::ParameterList plist("chemistry activity");
+    plist.set<double>("maximum skipped interval [s]", 100.);
+    auto tracker = createTracker(plist);
+
+    // nothing to compare to before the first solve
+    CHECK_EQUAL(ncells_global, tracker.Update(0., *S));
+    CHECK(!tracker.Skip(10.));
+    CHECK_EQUAL(0., tracker.t_start(0.));
+    tracker.Solved(10., *S);
+
+    // unchanged: skipped, and the next solve starts at the last one
+    CHECK_EQUAL(0, tracker.Update(10., *S));
+    CHECK(tracker.Skip(20.));
+    CHECK_EQUAL(1, tracker.num_skipped());
+    CHECK_EQUAL(10., tracker.t_start(20.));
+
+    // changes below the tolerances are quiescent
+    temp()[0][0] += 1.e-4;
+    tcc()[1][0] *= 1. + 1.e-10;
+    CHECK_EQUAL(0, tracker.Update(20., *S));
+    CHECK(tracker.Skip(30.));
+
+    // a change in one cell of one rank solves the whole domain
+    if (S->GetMesh("domain")->get_comm()->MyPID() == 0) tcc()[1][0] *= 1.1;
+    CHECK_EQUAL(1, tracker.Update(30., *S));
+    CHECK(!tracker.Skip(40.));
+    CHECK_EQUAL(10., tracker.t_start(30.));
+    tracker.Solved(40., *S);
+    CHECK_EQUAL(2, tracker.num_skipped());
+
+    // a temperature change activates a cell
+    temp()[0][1] += 1.;
+    CHECK_EQUAL(S->GetMesh("domain")->get_comm()->NumProc(), tracker.Update(40., *S));
+    tracker.Solved(50., *S);
+
+    // a solve is forced after the maximum skipped interval
+    CHECK_EQUAL(0, tracker.Update(140., *S));
+    CHECK(tracker.Skip(149.));
+    CHECK(!tracker.Skip(150.));
+  }
+
+
+  // A step repeated from before the last solve has no valid reference, and
+  // must be solved from its own start.
+  TEST_FIXTURE(ActivityProblem, ACTIVITY_REWIND)
+  {
+    Teuchos::ParameterList plist("chemistry activity");
+    auto tracker = createTracker(plist);
+    tracker.Update(0., *S);
+    tracker.Solved(10., *S);
+    CHECK_EQUAL(0, tracker.Update(10., *S));
+    CHECK(tracker.Skip(20.));
+
+    // the step from 10 failed, and is repeated from 5
+    CHECK_EQUAL(ncells_global, tracker.Update(5., *S));
+    CHECK(!tracker.Skip(8.));
+    CHECK_EQUAL(5., tracker.t_start(5.));
+    tracker.Solved(8., *S);
+    CHECK_EQUAL(0, tracker.Update(8., *S));
+    CHECK_EQUAL(8., tracker.t_start(12.));
+  }
+
+
+  // A failed solve over skipped time drops the reference, so that the
+  // retried step, even from the same start, covers only its own interval.
+  TEST_FIXTURE(ActivityProblem, ACTIVITY_FAILED)
+  {
+    Teuchos::ParameterList plist("chemistry activity");
+    auto tracker = createTracker(plist);
+    tracker.Update(0., *S);
+    tracker.Solved(10., *S);
+    CHECK_EQUAL(0, tracker.Update(10., *S));
+    CHECK(tracker.Skip(20.));
+
+    // chemistry is solved over [10, 30], and fails
+    tcc()[0][0] *= 2.;
+    CHECK_EQUAL(S->GetMesh("domain")->get_comm()->NumProc(), tracker.Update(20., *S));
+    CHECK(!tracker.Skip(30.));
+    CHECK_EQUAL(10., tracker.t_start(20.));
+    tracker.Failed();
+
+    // the step from 20 is retried with a smaller step size, over [20, 25]
+    CHECK_EQUAL(ncells_global, tracker.Update(20., *S));
+    CHECK(!tracker.Skip(25.));
+    CHECK_EQUAL(20., tracker.t_start(20.));
+    tracker.Solved(25., *S);
+    CHECK_EQUAL(0, tracker.Update(25., *S));
+    CHECK_EQUAL(25., tracker.t_start(30.));
+  }
+
+
+  TEST_FIXTURE(ActivityProblem, ACTIVITY_INVALID)
+  {
+    Teuchos::ParameterList plist("chemistry activity");
+    plist.set<double>("concentration relative tolerance", -1.);
+    CHECK_THROW(createTracker(plist), Errors::Message);
+  }
+}
@@ -0,0 +1,56 @@
+/*
+  Copyright 2010-202x held jointly by participating institutions.
+  ATS is released under the three-clause BSD License.
+  The terms of use and "as is" disclaimer for this license are
+  provided in the top-level COPYRIGHT file.
+
+  Authors:
+*/
+
+#include <sstream>
+
+#include <UnitTest++.h>
+
+#include "AmanziComm.hh"
+#include "GeometricModel.hh"
+#include "MeshFactory.hh"
+#include "chemistry_load_monitor.hh"
+
+using namespace Amanzi;
+
+SUITE(CHEMISTRY_LOAD_MONITOR)
+{
+  // Rank r spends (r + 1) ms on each of its cells.
+  TEST(CHEMISTRY_LOAD_COST_PER_CELL)
+  {
+    auto comm = getDefaultComm();
+    auto gm = Teuchos::rcp(new AmanziGeometry::GeometricModel(3));
+    AmanziMesh::MeshFactory factory(comm, gm);
+    auto mesh = factory.create(0., 0., 0., 1., 1., 1., 4 * comm->NumProc(), 2, 1);
+    int ncells = mesh->num_entities(AmanziMesh::CELL, AmanziMesh::Parallel_type::OWNED);
+    int rank = comm->MyPID();
+    int nprocs = comm->NumProc();
+
+    ChemistryLoadMonitor monitor(mesh);
+    double seconds = 1.e-3 * (rank + 1) * ncells;
+    monitor.Record(seconds);
+    monitor.Record(seconds);
+
+    double max_seconds, sum_seconds;
+    comm->MaxAll(&seconds, &max_seconds, 1);
+    comm->SumAll(&seconds, &sum_seconds, 1);
+    CHECK_EQUAL(2, monitor.num_steps());
+    CHECK_CLOSE(max_seconds * nprocs / sum_seconds, monitor.imbalance(), 1.e-12);
+    CHECK_CLOSE(monitor.imbalance(), monitor.cumulative_imbalance(), 1.e-12);
+    CHECK_CLOSE(2 * (max_seconds - sum_seconds / nprocs), monitor.lost_time(), 1.e-12);
+
+    CHECK_CLOSE(1.e-3 * nprocs, monitor.max_cell_cost(), 1.e-12);
+    CHECK_CLOSE(1.e-3, monitor.min_cell_cost(), 1.e-12);
+    CHECK_CLOSE(sum_seconds / (8 * nprocs), monitor.mean_cell_cost(), 1.e-12);
+    if (nprocs == 1) CHECK_EQUAL(1., monitor.imbalance());
+
+    std::stringstream os;
+    monitor.Write(os);
+    CHECK(os.str().find("cost per cell") != std::string::npos);
+  }
+}
@@ -0,0 +1,143 @@
+/*
+  Copyright 2010-202x held jointly by participating institutions.
+  ATS is released under the three-clause BSD License.
+  The terms of use and "as is" disclaimer for this license are
+  provided in the top-level COPYRIGHT file.
+
+  Authors:
+*/
+
+#include <cmath>
+
+#include <UnitTest++.h>
+
+#include "Epetra_Map.h"
+#include "Epetra_MultiVector.h"
+
+#include "AmanziComm.hh"
+#include "errors.hh"
+#include "coupling_iteration.hh"
+
+using namespace Amanzi;
+
+namespace {
+
+// The contraction G(x) = x / 2 + 1, with fixed point 2.  From x = 0, a
+// fixed point iteration evaluates G at x_k = 2 - 2^(1-k), where
+// G(x_k) - x_k = 2^-k, and so the relative residual is 2^-k / (2 - 2^-k).
+struct CouplingProblem {
+  CouplingProblem() : map(-1, 4, 0, *getDefaultComm()), x(map, 1)
+  {
+    plist.set<int>("Anderson depth", 0);
+    plist.set<double>("tolerance", 0.);
+  }
+
+  CouplingIteration::Map G()
+  {
+    return [this](const Epetra_MultiVector& x_in, Epetra_MultiVector& g) {
+      num_evaluations++;
+      if (num_evaluations == fail_at) return true;
+      g.PutScalar(1.);
+      g.Update(0.5, x_in, 1.);
+      return false;
+    };
+  }
+
+  bool solve(CouplingIteration& iteration)
+  {
+    x.PutScalar(0.);
+    return iteration.Solve(G(), x);
+  }
+
+  Teuchos::RCP<VerboseObject> vo() { return Teuchos::rcp(new VerboseObject("test", plist)); }
+
+  Teuchos::ParameterList plist;
+  Epetra_Map map;
+  Epetra_MultiVector x;
+  int num_evaluations = 0;
+  int fail_at = -1;
+};
+
+} // namespace
+
+
+SUITE(COUPLING_ITERATION)
+{
+  // Iterates until the relative residual is below the tolerance.
+  TEST_FIXTURE(CouplingProblem, COUPLING_RELATIVE_TOLERANCE)
+  {
+    plist.set<double>("tolerance", 0.05);
+    CouplingIteration iteration(plist, vo());
+
+    CHECK(!solve(iteration));
+    CHECK(iteration.converged());
+    CHECK_EQUAL(5, iteration.num_iterations());
+    CHECK_EQUAL(5, num_evaluations);
+    CHECK_CLOSE(1. / 31., iteration.residual(), 1.e-12);
+    CHECK_CLOSE(2. - 1. / 8., x[0][0], 1.e-12);
+  }
+
+
+  // Or until the norm of the change is below the absolute tolerance.
+  TEST_FIXTURE(CouplingProblem, COUPLING_ABSOLUTE_TOLERANCE)
+  {
+    plist.set<double>("absolute tolerance", 0.2 * std::sqrt(map.NumGlobalElements()));
+    CouplingIteration iteration(plist, vo());
+
+    CHECK(!solve(iteration));
+    CHECK(iteration.converged());
+    CHECK_EQUAL(4, iteration.num_iterations());
+  }
+
+
+  // Anderson mixing finds the fixed point of a linear map in one step.
+  TEST_FIXTURE(CouplingProblem, COUPLING_ACCELERATED)
+  {
+    plist.set<int>("Anderson depth", 3);
+    plist.set<double>("tolerance", 1.e-10);
+    CouplingIteration iteration(plist, vo());
+
+    CHECK(!solve(iteration));
+    CHECK(iteration.num_iterations() <= 3);
+    CHECK_CLOSE(2., x[0][0], 1.e-8);
+  }
+
+
+  // Not converging within the maximum iterations fails the step, unless
+  // asked not to, in which case the last iterate is kept.
+  TEST_FIXTURE(CouplingProblem, COUPLING_MAXIMUM_ITERATIONS)
+  {
+    plist.set<int>("maximum iterations", 3);
+    CouplingIteration iteration(plist, vo());
+    CHECK(solve(iteration));
+    CHECK(!iteration.converged());
+    CHECK_EQUAL(3, iteration.num_iterations());
+    CHECK_CLOSE(1. / 7., iteration.residual(), 1.e-12);
+
+    plist.set<bool>("fail if not converged", false);
+    CouplingIteration lenient(plist, vo());
+    CHECK(!solve(lenient));
+    CHECK(!lenient.converged());
+    CHECK_EQUAL(3, lenient.num_iterations());
+    CHECK_CLOSE(1.5, x[0][0], 1.e-12);
+  }
+
+
+  // A failed solve within G fails the step immediately.
+  TEST_FIXTURE(CouplingProblem, COUPLING_SOLVE_FAILED)
+  {
+    plist.set<int>("maximum iterations", 10);
+    fail_at = 2;
+    CouplingIteration iteration(plist, vo());
+    CHECK(solve(iteration));
+    CHECK_EQUAL(2, iteration.num_iterations());
+    CHECK_EQUAL(2, num_evaluations);
+  }
+
+
+  TEST_FIXTURE(CouplingProblem, COUPLING_INVALID)
+  {
+    plist.set<int>("maximum iterations", 0);
+    CHECK_THROW(CouplingIteration(plist, vo()), Errors::Message);
+  }
+}
@@ -0,0 +1,131 @@
+/*
+  Copyright 2010-202x held jointly by participating institutions.
+  ATS is released under the three-clause BSD License.
+  The terms of use and "as is" disclaimer for this license are
+  provided in the top-level COPYRIGHT file.
+
+  Authors:
+*/
+
+#include <UnitTest++.h>
+
+#include "Teuchos_ParameterList.hpp"
+
+#include "AmanziComm.hh"
+#include "GeometricModel.hh"
+#include "MeshFactory.hh"
+#include "State.hh"
+#include "pk_helpers.hh"
+#include "evaluation_plan.hh"
+#include "doubled_evaluator.hh"
+
+using namespace Amanzi;
+
+namespace {
+
+// Primary variables a and c, with b = 2 a and d = 2 c.
+struct PlanProblem {
+  PlanProblem()
+  {
+    auto comm = getDefaultComm();
+    auto gm = Teuchos::rcp(new AmanziGeometry::GeometricModel(3));
+    AmanziMesh::MeshFactory factory(comm, gm);
+    auto mesh = factory.create(0., 0., 0., 1., 1., 1., 4 * comm->NumProc(), 1, 1);
+
+    Teuchos::ParameterList state_list("state");
+    S = Teuchos::rcp(new State(state_list));
+    S->RegisterMesh("domain", mesh, false);
+    S->require_time(Tags::NEXT);
+    for (const auto& key : { "a", "c" }) {
+      S->Require<CompositeVector, CompositeVectorSpace>(key, Tags::NEXT, key)
+        .SetMesh(mesh)
+        ->SetGhosted(false)
+        ->AddComponent("cell", AmanziMesh::CELL, 1);
+      requireEvaluatorPrimary(key, Tags::NEXT, *S);
+    }
+    b = Testing::DoubledEvaluator::Require(*S, "b", "a", mesh);
+    d = Testing::DoubledEvaluator::Require(*S, "d", "c", mesh);
+    S->Setup();
+
+    S->set_time(Tags::NEXT, 0.);
+    set("a", 1.);
+    set("c", 3.);
+    S->InitializeEvaluators();
+  }
+
+  void set(const Key& key, double value)
+  {
+    S->GetW<CompositeVector>(key, Tags::NEXT, key).PutScalar(value);
+    S->GetRecordW(key, Tags::NEXT, key).set_initialized();
+    changedEvaluatorPrimary(key, Tags::NEXT, *S);
+  }
+
+  double get(const Key& key)
+  {
+    return (*S->Get<CompositeVector>(key, Tags::NEXT).ViewComponent("cell", false))[0][0];
+  }
+
+  Teuchos::RCP<State> S;
+  Teuchos::RCP<Testing::DoubledEvaluator> b, d;
+};
+
+} // namespace
+
+
+SUITE(EVALUATION_PLAN)
+{
+  // Updates are skipped unless a primary variable upstream of the key has
+  // changed, and changes are seen by every key downstream.
+  TEST_FIXTURE(PlanProblem, PLAN_SKIPS_UNCHANGED)
+  {
+    EvaluationPlan plan("test");
+
+    // the first update of each key is done
+    CHECK(plan.Update(*S, "b", Tags::NEXT, "test"));
+    CHECK(plan.Update(*S, "d", Tags::NEXT, "test"));
+    CHECK_EQUAL(2., get("b"));
+    CHECK_EQUAL(6., get("d"));
+    CHECK_EQUAL(2, plan.num_updated());
+    CHECK_EQUAL(0, plan.num_skipped());
+
+    // nothing has changed
+    CHECK(!plan.Update(*S, "b", Tags::NEXT, "test"));
+    CHECK(!plan.Update(*S, "d", Tags::NEXT, "test"));
+    CHECK_EQUAL(2, plan.num_updated());
+    CHECK_EQUAL(2, plan.num_skipped());
+    CHECK_EQUAL(1, b->num_evaluations);
+    CHECK_EQUAL(1, d->num_evaluations);
+
+    // a change to a only updates b
+    set("a", 5.);
+    CHECK(!plan.Update(*S, "d", Tags::NEXT, "test"));
+    CHECK(plan.Update(*S, "b", Tags::NEXT, "test"));
+    CHECK_EQUAL(10., get("b"));
+    CHECK_EQUAL(3, plan.num_updated());
+    CHECK_EQUAL(3, plan.num_skipped());
+    CHECK_EQUAL(2, b->num_evaluations);
+    CHECK_EQUAL(1, d->num_evaluations);
+
+    // a change to c, seen while updating d on behalf of another requestor,
+    // is still an update of d for this one
+    set("c", 4.);
+    CHECK(plan.Update(*S, "d", Tags::NEXT, "other"));
+    CHECK(plan.Update(*S, "d", Tags::NEXT, "test"));
+    CHECK_EQUAL(8., get("d"));
+    CHECK_EQUAL(5, plan.num_updated());
+    CHECK_EQUAL(3, plan.num_skipped());
+    CHECK_EQUAL(2, d->num_evaluations);
+  }
+
+
+  // Without a plan, the evaluator is updated directly.
+  TEST_FIXTURE(PlanProblem, PLAN_NULL)
+  {
+    Teuchos::RCP<EvaluationPlan> plan;
+    CHECK(updateEvaluator(plan, *S, "b", Tags::NEXT, "test"));
+    CHECK(!updateEvaluator(plan, *S, "b", Tags::NEXT, "test"));
+    set("a", 2.);
+    CHECK(updateEvaluator(plan, *S, "b", Tags::NEXT, "test"));
+    CHECK_EQUAL(4., get("b"));
+  }
+}
@@ -0,0 +1,152 @@
+/*
+  Copyright 2010-202x held jointly by participating institutions.
+  ATS is released under the three-clause BSD License.
+  The terms of use and "as is" disclaimer for this license are
+  provided in the top-level COPYRIGHT file.
+
+  Authors:
+*/
+
+#include <UnitTest++.h>
+
+#include "Teuchos_ConfigDefs.hpp"
+#include "Teuchos_ParameterList.hpp"
+
+#include "AmanziComm.hh"
+#include "errors.hh"
+#include "GeometricModel.hh"
+#include "MeshFactory.hh"
+#include "State.hh"
+#include "pk_helpers.hh"
+#include "parallel_evaluator_executor.hh"
+#include "doubled_evaluator.hh"
+
+using namespace Amanzi;
+
+namespace {
+
+// Primary variables a1, a2, a3, with b1 = 2 a1, b2 = 2 a2, and b3 = 2 a3, on
+// meshes one, two, and three, where three is an alias of one, as the
+// subdomains of a replicated domain set are.
+struct ExecutorProblem {
+  ExecutorProblem()
+  {
+    comm = getDefaultComm();
+    auto gm = Teuchos::rcp(new AmanziGeometry::GeometricModel(3));
+    AmanziMesh::MeshFactory factory(comm, gm);
+
+    Teuchos::ParameterList state_list("state");
+    S = Teuchos::rcp(new State(state_list));
+    S->RegisterMesh("one", factory.create(0., 0., 0., 1., 1., 1., 4 * comm->NumProc(), 1, 1));
+    S->RegisterMesh("two", factory.create(0., 0., 0., 1., 1., 1., 4 * comm->NumProc(), 1, 1));
+    S->AliasMesh("one", "three");
+    S->require_time(Tags::NEXT);
+
+    for (const auto& domain : { "one", "two", "three" }) {
+      int i = b.size() + 1;
+      Key a_key = "a" + std::to_string(i);
+      auto mesh = S->GetMesh(domain);
+      S->Require<CompositeVector, CompositeVectorSpace>(a_key, Tags::NEXT, a_key)
+        .SetMesh(mesh)
+        ->SetGhosted(false)
+        ->AddComponent("cell", AmanziMesh::CELL, 1);
+      requireEvaluatorPrimary(a_key, Tags::NEXT, *S);
+
+      Key b_key = "b" + std::to_string(i);
+      b.emplace_back(Testing::DoubledEvaluator::Require(*S, b_key, a_key, mesh));
+      keys.emplace_back(KeyTag{ b_key, Tags::NEXT });
+    }
+    S->Setup();
+
+    S->set_time(Tags::NEXT, 0.);
+    for (int i = 1; i <= 3; ++i) set("a" + std::to_string(i), i);
+    S->InitializeEvaluators();
+  }
+
+  void set(const Key& key, double value)
+  {
+    S->GetW<CompositeVector>(key, Tags::NEXT, key).PutScalar(value);
+    S->GetRecordW(key, Tags::NEXT, key).set_initialized();
+    changedEvaluatorPrimary(key, Tags::NEXT, *S);
+  }
+
+  double get(const Key& key)
+  {
+    return (*S->Get<CompositeVector>(key, Tags::NEXT).ViewComponent("cell", false))[0][0];
+  }
+
+  // threads are only supported on a single rank, with a thread-safe Teuchos
+  int numThreads()
+  {
+#ifdef HAVE_TEUCHOS_THREAD_SAFE
+    if (comm->NumProc() == 1) return 2;
+#endif
+    return 1;
+  }
+
+  Comm_ptr_type comm;
+  Teuchos::RCP<State> S;
+  std::vector<Teuchos::RCP<Testing::DoubledEvaluator>> b;
+  std::vector<KeyTag> keys;
+};
+
+} // namespace
+
+
+SUITE(PARALLEL_EVALUATOR_EXECUTOR)
+{
+  // b1 and b3 share no evaluator, but live on the same mesh, so are grouped.
+  TEST_FIXTURE(ExecutorProblem, EXECUTOR_GROUPS_BY_MESH)
+  {
+    ParallelEvaluatorExecutor executor("test", keys, 1, comm);
+    executor.Update(*S);
+    CHECK_EQUAL(2, executor.num_groups());
+
+    // keys on distinct meshes with no shared evaluator are not grouped
+    ParallelEvaluatorExecutor separate("test", { keys[0], keys[1] }, 1, comm);
+    separate.Update(*S);
+    CHECK_EQUAL(2, separate.num_groups());
+  }
+
+
+  // Groups are updated on a pool of threads, and only what changed is
+  // evaluated again.
+  TEST_FIXTURE(ExecutorProblem, EXECUTOR_UPDATE)
+  {
+    ParallelEvaluatorExecutor executor("test", keys, numThreads(), comm);
+    executor.Update(*S);
+    CHECK_EQUAL(2., get("b1"));
+    CHECK_EQUAL(4., get("b2"));
+    CHECK_EQUAL(6., get("b3"));
+    for (const auto& eval : b) CHECK_EQUAL(1, eval->num_evaluations);
+
+    set("a2", 5.);
+    set("a3", 7.);
+    executor.Update(*S);
+    CHECK_EQUAL(2., get("b1"));
+    CHECK_EQUAL(10., get("b2"));
+    CHECK_EQUAL(14., get("b3"));
+    CHECK_EQUAL(1, b[0]->num_evaluations);
+    CHECK_EQUAL(2, b[1]->num_evaluations);
+    CHECK_EQUAL(2, b[2]->num_evaluations);
+  }
+
+
+  // Exceptions thrown by evaluators, on any thread, are rethrown.
+  TEST_FIXTURE(ExecutorProblem, EXECUTOR_RETHROWS)
+  {
+    ParallelEvaluatorExecutor executor("test", keys, numThreads(), comm);
+    b[1]->throws = true;
+    CHECK_THROW(executor.Update(*S), Errors::Message);
+    CHECK_EQUAL(1, b[1]->num_evaluations);
+  }
+
+
+  TEST_FIXTURE(ExecutorProblem, EXECUTOR_INVALID)
+  {
+    CHECK_THROW(ParallelEvaluatorExecutor("test", keys, 0, comm), Errors::Message);
+    if (comm->NumProc() > 1) {
+      CHECK_THROW(ParallelEvaluatorExecutor("test", keys, 2, comm), Errors::Message);
+    }
+  }
+}
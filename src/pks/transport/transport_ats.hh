@@ -97,6 +97,10 @@ The advection-diffusion equation for component *i* in the surface may be written
     * `"transport subcycling`" ``[bool]`` **true** The code will default to
       subcycling for transport within the master PK if there is one.
 
+    * `"use evaluation plan`" ``[bool]`` **false** If true, the flux,
+      saturation, and density are only updated at the start of a step if a
+      primary or independent variable upstream of them has changed.
+
 
     Developer parameters:
 
@@ -268,6 +272,8 @@ The advection-diffusion equation for component *i* in the surface may be written
 #include "VerboseObject.hh"
 #include "Debugger.hh"
 #include "PK_PhysicalExplicit.hh"
+#include "mesh_geometry_cache.hh"
+#include "evaluation_plan.hh"
 #include "DenseVector.hh"
 
 #include <string>
@@ -496,6 +502,11 @@ class Transport_ATS : public PK_PhysicalExplicit<Epetra_Vector> {
   Teuchos::RCP<const Epetra_MultiVector> ws_, ws_prev_, phi_, mol_dens_, mol_dens_prev_;
   Teuchos::RCP<Epetra_MultiVector> flux_copy_;
 
+  Teuchos::RCP<MeshGeometryCache> mesh_geom_;
+
+  // optional, skips updates of secondary variables whose inputs are unchanged
+  Teuchos::RCP<EvaluationPlan> eval_plan_;
+
 #ifdef ALQUIMIA_ENABLED
   Teuchos::RCP<AmanziChemistry::Alquimia_PK> chem_pk_;
   Teuchos::RCP<AmanziChemistry::ChemistryEngine> chem_engine_;
@@ -78,6 +78,8 @@ Transport_ATS::Transport_ATS(Teuchos::ParameterList& pk_tree,
 
   // are we subcycling internally?
   subcycling_ = plist_->get<bool>("transport subcycling", false);
+  if (plist_->get<bool>("use evaluation plan", false))
+    eval_plan_ = Teuchos::rcp(new EvaluationPlan(name_));
   tag_flux_next_ts_ = Tag{ name() + "_flux_next_ts" }; // what is this for? --ETC
 
   // initialize io
@@ -109,6 +111,7 @@ Transport_ATS::Transport_ATS(Teuchos::ParameterList& pk_tree,
   dim = mesh_->space_dimension();
 
   db_ = Teuchos::rcp(new Debugger(mesh_, name_, *plist_));
+  mesh_geom_ = MeshGeometryCache::Get(mesh_);
 }
 
 void
@@ -695,6 +698,8 @@ Transport_ATS::InitializeFieldFromField_(const Key& field0,
 double
 Transport_ATS::StableTimeStep()
 {
+  const auto& cell_volumes = mesh_geom_->cell_volumes();
+
   S_->Get<CompositeVector>(flux_key_, Tags::NEXT).ScatterMasterToGhosted("face");
   flux_ = S_->Get<CompositeVector>(flux_key_, Tags::NEXT).ViewComponent("face", true);
 
@@ -725,7 +730,7 @@ Transport_ATS::StableTimeStep()
     double outflux = total_outflux[c];
 
     if ((outflux > 0) && ((*ws_prev_)[0][c] > 0) && ((*ws_)[0][c] > 0) && ((*phi_)[0][c] > 0)) {
-      vol = mesh_->cell_volume(c);
+      vol = cell_volumes[c];
       dt_cell = vol * (*mol_dens_)[0][c] * (*phi_)[0][c] *
                 std::min((*ws_prev_)[0][c], (*ws_)[0][c]) / outflux;
     }
@@ -812,6 +817,8 @@ Transport_ATS::get_dt()
 bool
 Transport_ATS::AdvanceStep(double t_old, double t_new, bool reinit)
 {
+  const auto& cell_volumes = mesh_geom_->cell_volumes();
+
   bool failed = false;
   double dt_MPC = t_new - t_old;
 
@@ -822,17 +829,17 @@ Transport_ATS::AdvanceStep(double t_old, double t_new, bool reinit)
                << " t1 = " << S_->get_time(tag_next_) << " h = " << dt_MPC << std::endl
                << "----------------------------------------------------------------" << std::endl;
 
-  S_->GetEvaluator(flux_key_, Tags::NEXT).Update(*S_, name_);
+  updateEvaluator(eval_plan_, *S_, flux_key_, Tags::NEXT, name_);
 
   // why are we re-assigning all of these?  The previous pointers shouldn't have changed... --ETC
   flux_ = S_->Get<CompositeVector>(flux_key_, Tags::NEXT).ViewComponent("face", true);
   // why are we copying this?  This should result in constant flux, no need to copy? --ETC
   *flux_copy_ = *flux_; // copy flux vector from S_next_ to S_;
 
-  S_->GetEvaluator(saturation_key_, Tags::NEXT).Update(*S_, name_);
+  updateEvaluator(eval_plan_, *S_, saturation_key_, Tags::NEXT, name_);
   ws_ = S_->Get<CompositeVector>(saturation_key_, Tags::NEXT).ViewComponent("cell", false);
 
-  S_->GetEvaluator(molar_density_key_, Tags::NEXT).Update(*S_, name_);
+  updateEvaluator(eval_plan_, *S_, molar_density_key_, Tags::NEXT, name_);
   mol_dens_ = S_->Get<CompositeVector>(molar_density_key_, Tags::NEXT).ViewComponent("cell", false);
 
   //if (subcycling_) S_->set_time(tag_subcycle_current_, t_old);
@@ -847,7 +854,7 @@ Transport_ATS::AdvanceStep(double t_old, double t_new, bool reinit)
     for (auto& src : srcs_) {
       if (src->name() == "alquimia source") {
         // src_factor = water_source / molar_density_liquid
-        S_->GetEvaluator(geochem_src_factor_key_, Tags::NEXT).Update(*S_, name_);
+        updateEvaluator(eval_plan_, *S_, geochem_src_factor_key_, Tags::NEXT, name_);
         auto src_factor = S_->Get<CompositeVector>(geochem_src_factor_key_, Tags::NEXT)
                             .ViewComponent("cell", false);
         Teuchos::RCP<TransportSourceFunction_Alquimia_Units> src_alq =
@@ -918,7 +925,7 @@ Transport_ATS::AdvanceStep(double t_old, double t_new, bool reinit)
   for (int c = 0; c < ncells_owned; c++) {
     double vol_phi_ws_den;
     vol_phi_ws_den =
-      mesh_->cell_volume(c) * (*phi_)[0][c] * (*ws_prev_)[0][c] * (*mol_dens_prev_)[0][c];
+      cell_volumes[c] * (*phi_)[0][c] * (*ws_prev_)[0][c] * (*mol_dens_prev_)[0][c];
     for (int i = 0; i < num_aqueous + num_gaseous; i++) {
       mass_solutes_stepstart_[i] = tcc_prev[i][c] * vol_phi_ws_den;
     }
@@ -1012,6 +1019,8 @@ Transport_ATS::AdvanceStep(double t_old, double t_new, bool reinit)
 void
 Transport_ATS ::Advance_Dispersion_Diffusion(double t_old, double t_new)
 {
+  const auto& cell_volumes = mesh_geom_->cell_volumes();
+
   double dt_MPC = t_new - t_old;
   // We define tracer as the species #0 as calculate some statistics.
   Epetra_MultiVector& tcc_next = *tcc_tmp->ViewComponent("cell", false);
@@ -1097,7 +1106,7 @@ Transport_ATS ::Advance_Dispersion_Diffusion(double t_old, double t_new)
         Epetra_MultiVector& rhs_cell = *op->rhs()->ViewComponent("cell");
         for (int c = 0; c < ncells_owned; c++) {
           double tmp =
-            mesh_->cell_volume(c) * (*ws_)[0][c] * (*phi_)[0][c] * (*mol_dens_)[0][c] / dt_MPC;
+            cell_volumes[c] * (*ws_)[0][c] * (*phi_)[0][c] * (*mol_dens_)[0][c] / dt_MPC;
           rhs_cell[0][c] = tcc_next[i][c] * tmp;
         }
       }
@@ -1222,6 +1231,8 @@ Transport_ATS::CommitStep(double t_old, double t_new, const Tag& tag_next)
 void
 Transport_ATS::AdvanceDonorUpwind(double dt_cycle)
 {
+  const auto& cell_volumes = mesh_geom_->cell_volumes();
+
   IdentifyUpwindCells();
   dt_ = dt_cycle; // overwrite the maximum stable transport step
   mass_solutes_source_.assign(num_aqueous + num_gaseous, 0.0);
@@ -1240,7 +1251,7 @@ Transport_ATS::AdvanceDonorUpwind(double dt_cycle)
 
   for (int c = 0; c < ncells_owned; c++) {
     double vol_phi_ws_den =
-      mesh_->cell_volume(c) * (*phi_)[0][c] * (*ws_current)[0][c] * (*mol_dens_current)[0][c];
+      cell_volumes[c] * (*phi_)[0][c] * (*ws_current)[0][c] * (*mol_dens_current)[0][c];
     (*conserve_qty_)[num_components + 1][c] = vol_phi_ws_den;
 
     for (int i = 0; i < num_advect; i++) {
@@ -1350,7 +1361,7 @@ Transport_ATS::AdvanceDonorUpwind(double dt_cycle)
     //double vol_phi_ws_den =
       //mesh_->cell_volume(c) * (*phi_)[0][c] * (*ws_current)[0][c] * (*mol_dens_current)[0][c];
     double water_new =
-      mesh_->cell_volume(c) * (*phi_)[0][c] * (*ws_next)[0][c] * (*mol_dens_next)[0][c];
+      cell_volumes[c] * (*phi_)[0][c] * (*ws_next)[0][c] * (*mol_dens_next)[0][c];
     double water_sink =
       (*conserve_qty_)[num_components]
                       [c]; // water at the new time + outgoing domain coupling source
@@ -1414,6 +1425,8 @@ Transport_ATS::AdvanceDonorUpwind(double dt_cycle)
 void
 Transport_ATS::AdvanceSecondOrderUpwindRK1(double dt_cycle)
 {
+  const auto& cell_volumes = mesh_geom_->cell_volumes();
+
   dt_ = dt_cycle; // overwrite the maximum stable transport step
   mass_solutes_source_.assign(num_aqueous + num_gaseous, 0.0);
 
@@ -1447,7 +1460,7 @@ Transport_ATS::AdvanceSecondOrderUpwindRK1(double dt_cycle)
   // prepopulate with initial water for better debugging
   for (int c = 0; c < ncells_owned; c++) {
     double vol_phi_ws_den_current =
-      mesh_->cell_volume(c) * (*phi_)[0][c] * (*ws_current)[0][c] * (*mol_dens_current)[0][c];
+      cell_volumes[c] * (*phi_)[0][c] * (*ws_current)[0][c] * (*mol_dens_current)[0][c];
     (*conserve_qty_)[num_components + 1][c] = vol_phi_ws_den_current;
   }
 
@@ -1463,7 +1476,7 @@ Transport_ATS::AdvanceSecondOrderUpwindRK1(double dt_cycle)
   for (int c = 0; c < ncells_owned; c++) {
     double water_old = (*conserve_qty_)[num_components + 1][c];
     double water_new =
-      mesh_->cell_volume(c) * (*phi_)[0][c] * (*ws_next)[0][c] * (*mol_dens_next)[0][c];
+      cell_volumes[c] * (*phi_)[0][c] * (*ws_next)[0][c] * (*mol_dens_next)[0][c];
     double water_sink = (*conserve_qty_)[num_components][c];
     double water_total = water_sink + water_new;
     (*conserve_qty_)[num_components][c] = water_total;
@@ -1506,6 +1519,8 @@ Transport_ATS::AdvanceSecondOrderUpwindRK1(double dt_cycle)
 void
 Transport_ATS::AdvanceSecondOrderUpwindRK2(double dt_cycle)
 {
+  const auto& cell_volumes = mesh_geom_->cell_volumes();
+
   dt_ = dt_cycle; // overwrite the maximum stable transport step
   mass_solutes_source_.assign(num_aqueous + num_gaseous, 0.0);
 
@@ -1559,7 +1574,7 @@ Transport_ATS::AdvanceSecondOrderUpwindRK2(double dt_cycle)
       tcc_next[i][c] = (tcc_next[i][c] + value) / 2;
       if (tcc_next[i][c] < 0) {
         double vol_phi_ws_den =
-          mesh_->cell_volume(c) * (*phi_)[0][c] * (*ws_next)[0][c] * (*mol_dens_next)[0][c];
+          cell_volumes[c] * (*phi_)[0][c] * (*ws_next)[0][c] * (*mol_dens_next)[0][c];
         (*solid_qty_)[i][c] += abs(tcc_next[i][c]) * vol_phi_ws_den;
         tcc_next[i][c] = 0.;
       }
@@ -1587,6 +1602,8 @@ Transport_ATS::ComputeAddSourceTerms(double tp,
                                      int n0,
                                      int n1)
 {
+  const auto& cell_volumes = mesh_geom_->cell_volumes();
+
   int num_vectors = cons_qty.NumVectors();
   int nsrcs = srcs_.size();
 
@@ -1612,7 +1629,7 @@ Transport_ATS::ComputeAddSourceTerms(double tp,
 
         int imap = i;
         if (num_vectors == 1) imap = 0;
-        double value = mesh_->cell_volume(c) * values[k];
+        double value = cell_volumes[c] * values[k];
         cons_qty[imap][c] += dtp * value;
         mass_solutes_source_[i] += value;
       }
@@ -29,6 +29,8 @@ Transport_ATS::FunctionalTimeDerivative(double t,
                                         const Epetra_Vector& component,
                                         Epetra_Vector& f_component)
 {
+  const auto& cell_volumes = mesh_geom_->cell_volumes();
+
   // distribute vector
   auto component_tmp = Teuchos::rcp(new Epetra_Vector(component));
   component_tmp->Import(component, tcc->importer("cell"), Insert);
@@ -130,10 +132,10 @@ Transport_ATS::FunctionalTimeDerivative(double t,
 
   for (int c = 0; c < ncells_owned; c++) { // calculate conservative quantatity
     double vol_phi_ws_den =
-      mesh_->cell_volume(c) * (*phi_)[0][c] * (*ws_current)[0][c] * (*mol_dens_current)[0][c];
+      cell_volumes[c] * (*phi_)[0][c] * (*ws_current)[0][c] * (*mol_dens_current)[0][c];
     if ((*ws_current)[0][c] < 1e-12)
       vol_phi_ws_den =
-        mesh_->cell_volume(c) * (*phi_)[0][c] * (*ws_next)[0][c] * (*mol_dens_next)[0][c];
+        cell_volumes[c] * (*phi_)[0][c] * (*ws_next)[0][c] * (*mol_dens_next)[0][c];
 
     if (vol_phi_ws_den > water_tolerance_) { f_component[c] /= vol_phi_ws_den; }
   }
@@ -152,10 +154,10 @@ Transport_ATS::FunctionalTimeDerivative(double t,
 
           if (c2 >= 0 && f < nfaces_owned) {
             double u = fabs((*flux_)[0][f]);
-            double vol_phi_ws_den = mesh_->cell_volume(c2) * (*phi_)[0][c2] * (*ws_current)[0][c2] *
+            double vol_phi_ws_den = cell_volumes[c2] * (*phi_)[0][c2] * (*ws_current)[0][c2] *
                                     (*mol_dens_current)[0][c2];
             if ((*ws_current)[0][c2] < 1e-12)
-              vol_phi_ws_den = mesh_->cell_volume(c2) * (*phi_)[0][c2] * (*ws_next)[0][c2] *
+              vol_phi_ws_den = cell_volumes[c2] * (*phi_)[0][c2] * (*ws_next)[0][c2] *
                                (*mol_dens_next)[0][c2];
 
             double tcc_flux = u * values[i];
@@ -13,9 +13,10 @@
 
 
 int
-main()
+main(int argc, char* argv[])
 {
   using namespace Amanzi::AmanziGeometry;
+  auto opts = readExtrudeOptions(argc, argv);
 
   std::string mesh_in = "Mesh.txt";
   std::string mesh_out = "Mesh3D_Homogeneous2mSoil.exo";
@@ -40,7 +41,7 @@ main()
 
   int nsnodes = m.coords.size();
 
-  Mesh3D m3(&m, nsoil_lay + nbedrock_lay);
+  Mesh3D m3(&m, nsoil_lay + nbedrock_lay, opts.n_threads);
   for (int ilay = 0; ilay != nsoil_lay; ++ilay) {
     m3.extrude(ref_soil_mlay_dz[ilay], hmg_soil_type);
   }
@@ -55,6 +56,6 @@ main()
   std::cout << "NNodes on 3D = " << m3.coords.size() << std::endl;
   std::cout << "Ncells on 3D = " << m3.cell2face.size() << std::endl;
 
-  writeMesh3D_exodus(m3, mesh_out);
+  writeMesh3D(m3, mesh_out, opts);
   return 0;
 }
@@ -13,9 +13,10 @@
 
 
 int
-main()
+main(int argc, char* argv[])
 {
   using namespace Amanzi::AmanziGeometry;
+  auto opts = readExtrudeOptions(argc, argv);
 
   std::string mesh_in = "Mesh.txt";
   std::string mesh_out = "Mesh3D_HomogeneousVariableSoil.exo";
@@ -43,7 +44,7 @@ main()
   std::vector<double> dzs(nsnodes, 0.0);
   std::vector<double> rem_soil = depths;
 
-  Mesh3D m3(&m, nsoil_lay + nbedrock_lay);
+  Mesh3D m3(&m, nsoil_lay + nbedrock_lay, opts.n_threads);
 
   for (int ilay = 0; ilay < nsoil_lay; ilay++) {
     for (int inode = 0; inode < nsnodes; inode++) {
@@ -75,10 +76,10 @@ main()
   std::cout << "NNodes on 3D = " << m3.coords.size() << std::endl;
   std::cout << "Ncells on 3D = " << m3.cell2face.size() << std::endl;
 
-  writeMesh3D_exodus(m3, mesh_out);
+  writeMesh3D(m3, mesh_out, opts);
 
   // also a non-squashed version?
-  Mesh3D m3_ns(&m, nsoil_lay + nbedrock_lay);
+  Mesh3D m3_ns(&m, nsoil_lay + nbedrock_lay, opts.n_threads);
 
   for (int ilay = 0; ilay < nsoil_lay; ilay++) {
     for (int inode = 0; inode < nsnodes; inode++) {
@@ -110,6 +111,6 @@ main()
   std::cout << "NNodes on 3D = " << m3_ns.coords.size() << std::endl;
   std::cout << "Ncells on 3D = " << m3_ns.cell2face.size() << std::endl;
 
-  writeMesh3D_exodus(m3_ns, mesh_out_ns);
+  writeMesh3D(m3_ns, mesh_out_ns, opts);
   return 0;
 }
@@ -17,9 +17,10 @@
 
 
 int
-main()
+main(int argc, char* argv[])
 {
   using namespace Amanzi::AmanziGeometry;
+  auto opts = readExtrudeOptions(argc, argv);
 
   std::string mesh_in = "Mesh.txt";
 
@@ -41,7 +42,7 @@ main()
     std::vector<double> dzs = { 1., 0., 0.5, 1. };
 
     // make an extruded with pinchouts, squashed
-    Mesh3D m3(&m, 1);
+    Mesh3D m3(&m, 1, opts.n_threads);
     m3.extrude(1.0, 1001, true);
     m3.extrude(dzs, 1001, true);
     m3.finish();
@@ -54,11 +55,11 @@ main()
     assert(m3.cell2face.size() == 4);
     assert(m3.face2node.size() == 16);
 
-    writeMesh3D_exodus(m3, mesh_out);
+    writeMesh3D(m3, mesh_out, opts);
 
     // also a non-squashed version
     std::cout << "Extruding: " << mesh_in << " and writing to: " << mesh_out_ns << std::endl;
-    Mesh3D m3_ns(&m, 1);
+    Mesh3D m3_ns(&m, 1, opts.n_threads);
     m3_ns.extrude(1.0, 1001, false);
     m3_ns.extrude(dzs, 1001, false);
     m3_ns.finish();
@@ -71,7 +72,7 @@ main()
     assert(m3_ns.cell2face.size() == 4);
     assert(m3_ns.face2node.size() == 16);
 
-    writeMesh3D_exodus(m3_ns, mesh_out_ns);
+    writeMesh3D(m3_ns, mesh_out_ns, opts);
   }
 
 
@@ -83,7 +84,7 @@ main()
     std::vector<double> dzs = { 0., 0., 0.5, 1. };
 
     // make an extruded with pinchouts, squashed
-    Mesh3D m3(&m, 1);
+    Mesh3D m3(&m, 1, opts.n_threads);
     m3.extrude(1.0, 1001, true);
     m3.extrude(dzs, 1001, true);
     m3.finish();
@@ -96,11 +97,11 @@ main()
     assert(m3.cell2face.size() == 4);
     assert(m3.face2node.size() == 15);
 
-    writeMesh3D_exodus(m3, mesh_out);
+    writeMesh3D(m3, mesh_out, opts);
 
     // also a non-squashed version
     std::cout << "Extruding: " << mesh_in << " and writing to: " << mesh_out_ns << std::endl;
-    Mesh3D m3_ns(&m, 1);
+    Mesh3D m3_ns(&m, 1, opts.n_threads);
     m3_ns.extrude(1.0, 1001, false);
     m3_ns.extrude(dzs, 1001, false);
     m3_ns.finish();
@@ -113,7 +114,7 @@ main()
     assert(m3_ns.cell2face.size() == 4);
     assert(m3_ns.face2node.size() == 16);
 
-    writeMesh3D_exodus(m3_ns, mesh_out_ns);
+    writeMesh3D(m3_ns, mesh_out_ns, opts);
   }
 
 
@@ -125,7 +126,7 @@ main()
     std::vector<double> dzs = { 0., 0., 0., 1. };
 
     // make an extruded with pinchouts, squashed
-    Mesh3D m3(&m, 1);
+    Mesh3D m3(&m, 1, opts.n_threads);
     m3.extrude(1.0, 1001, true);
     m3.extrude(dzs, 1001, true);
     m3.finish();
@@ -138,11 +139,11 @@ main()
     assert(m3.cell2face.size() == 3);
     assert(m3.face2node.size() == 12);
 
-    writeMesh3D_exodus(m3, mesh_out);
+    writeMesh3D(m3, mesh_out, opts);
 
     // also a non-squashed version
     std::cout << "Extruding: " << mesh_in << " and writing to: " << mesh_out_ns << std::endl;
-    Mesh3D m3_ns(&m, 1);
+    Mesh3D m3_ns(&m, 1, opts.n_threads);
     m3_ns.extrude(1.0, 1001, false);
     m3_ns.extrude(dzs, 1001, false);
     m3_ns.finish();
@@ -155,7 +156,7 @@ main()
     assert(m3_ns.cell2face.size() == 4);
     assert(m3_ns.face2node.size() == 16);
 
-    writeMesh3D_exodus(m3_ns, mesh_out_ns);
+    writeMesh3D(m3_ns, mesh_out_ns, opts);
   }
 
   {
@@ -166,7 +167,7 @@ main()
     std::vector<double> dzs = { 0., 0., 0., 0. };
 
     // make an extruded with pinchouts, squashed
-    Mesh3D m3(&m, 1);
+    Mesh3D m3(&m, 1, opts.n_threads);
     m3.extrude(1.0, 1001, true);
     m3.extrude(dzs, 1001, true);
     m3.finish();
@@ -179,11 +180,11 @@ main()
     assert(m3.cell2face.size() == 2);
     assert(m3.face2node.size() == 9);
 
-    writeMesh3D_exodus(m3, mesh_out);
+    writeMesh3D(m3, mesh_out, opts);
 
     // also a non-squashed version
     std::cout << "Extruding: " << mesh_in << " and writing to: " << mesh_out_ns << std::endl;
-    Mesh3D m3_ns(&m, 1);
+    Mesh3D m3_ns(&m, 1, opts.n_threads);
     m3_ns.extrude(1.0, 1001, false);
     m3_ns.extrude(dzs, 1001, false);
     m3_ns.finish();
@@ -196,7 +197,7 @@ main()
     assert(m3_ns.cell2face.size() == 4);
     assert(m3_ns.face2node.size() == 16);
 
-    writeMesh3D_exodus(m3_ns, mesh_out_ns);
+    writeMesh3D(m3_ns, mesh_out_ns, opts);
   }
 
   return 0;
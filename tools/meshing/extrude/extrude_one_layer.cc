@@ -13,9 +13,10 @@
 
 
 int
-main()
+main(int argc, char* argv[])
 {
   using namespace Amanzi::AmanziGeometry;
+  auto opts = readExtrudeOptions(argc, argv);
 
   std::string mesh_in = "Mesh.txt";
   std::string mesh_out = "Mesh3D_OneLayer.exo";
@@ -29,7 +30,7 @@ main()
   auto m = readMesh2D_text(mesh_in, soil_type, bedrock_type, depths);
   int nsnodes = m.coords.size();
 
-  Mesh3D m3(&m, 1);
+  Mesh3D m3(&m, 1, opts.n_threads);
   m3.extrude(0.02, 100);
   m3.finish();
 
@@ -38,6 +39,6 @@ main()
   std::cout << "NNodes on 3D = " << m3.coords.size() << std::endl;
   std::cout << "Ncells on 3D = " << m3.cell2face.size() << std::endl;
 
-  writeMesh3D_exodus(m3, mesh_out);
+  writeMesh3D(m3, mesh_out, opts);
   return 0;
 }
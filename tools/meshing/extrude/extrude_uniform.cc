@@ -13,9 +13,10 @@
 
 
 int
-main()
+main(int argc, char* argv[])
 {
   using namespace Amanzi::AmanziGeometry;
+  auto opts = readExtrudeOptions(argc, argv);
 
   std::string mesh_in = "Mesh.txt";
   std::string mesh_out = "Mesh3D_2mSoil.exo";
@@ -37,7 +38,7 @@ main()
 
   int nsnodes = m.coords.size();
 
-  Mesh3D m3(&m, nsoil_lay + nbedrock_lay);
+  Mesh3D m3(&m, nsoil_lay + nbedrock_lay, opts.n_threads);
   for (int ilay = 0; ilay != nsoil_lay; ++ilay) { m3.extrude(ref_soil_mlay_dz[ilay], soil_type); }
   for (int ilay = 0; ilay != nbedrock_lay; ++ilay) {
     m3.extrude(ref_bedrock_mlay_dz[ilay], bedrock_type);
@@ -50,6 +51,6 @@ main()
   std::cout << "NNodes on 3D = " << m3.coords.size() << std::endl;
   std::cout << "Ncells on 3D = " << m3.cell2face.size() << std::endl;
 
-  writeMesh3D_exodus(m3, mesh_out);
+  writeMesh3D(m3, mesh_out, opts);
   return 0;
 }
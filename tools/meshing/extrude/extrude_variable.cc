@@ -13,9 +13,10 @@
 #include <cfloat>
 
 int
-main()
+main(int argc, char* argv[])
 {
   using namespace Amanzi::AmanziGeometry;
+  auto opts = readExtrudeOptions(argc, argv);
 
   std::string mesh_in = "Mesh.txt";
   std::string mesh_out = "Mesh3D_VariableSoil.exo";
@@ -50,7 +51,7 @@ main()
   std::vector<double> dzs(nsnodes, 0.0);
   std::vector<double> rem_soil = depths;
 
-  Mesh3D m3(&m, nsoil_lay + nbedrock_lay);
+  Mesh3D m3(&m, nsoil_lay + nbedrock_lay, opts.n_threads);
 
   for (int ilay = 0; ilay < nsoil_lay; ilay++) {
     for (int inode = 0; inode < nsnodes; inode++) {
@@ -82,6 +83,6 @@ main()
   std::cout << "NNodes on 3D = " << m3.coords.size() << std::endl;
   std::cout << "Ncells on 3D = " << m3.cell2face.size() << std::endl;
 
-  writeMesh3D_exodus(m3, mesh_out);
+  writeMesh3D(m3, mesh_out, opts);
   return 0;
 }
@@ -0,0 +1,155 @@
+/*
+  Copyright 2010-202x held jointly by participating institutions.
+  ATS is released under the three-clause BSD License.
+  The terms of use and "as is" disclaimer for this license are
+  provided in the top-level COPYRIGHT file.
+
+  Authors:
+*/
+
+//! Flat, compressed-row connectivity and a simple threaded loop helper.
+/*
+  Connectivity stores a ragged 2D array (cell-to-face, face-to-node) as one
+  contiguous entries array plus an offsets array, so that a mesh with N
+  entities costs two allocations instead of N+1.
+
+  Rows are appended in order, either one at a time (push_row) or in bulk by
+  first growing the structure with known row sizes (append_rows) and then
+  filling the rows in parallel.
+*/
+
+#ifndef CSR_HH_
+#define CSR_HH_
+
+#include <vector>
+#include <thread>
+#include <algorithm>
+
+#include "dbc.hh"
+
+namespace Amanzi {
+namespace AmanziGeometry {
+
+struct Connectivity {
+  Connectivity() : offsets(1, 0) {}
+
+  int size() const { return offsets.size() - 1; }
+  int row_size(int i) const { return offsets[i + 1] - offsets[i]; }
+
+  int* row(int i) { return entries.data() + offsets[i]; }
+  const int* row(int i) const { return entries.data() + offsets[i]; }
+
+  // iterator-ish access, for range loops over a row
+  const int* begin(int i) const { return row(i); }
+  const int* end(int i) const { return entries.data() + offsets[i + 1]; }
+
+  void reserve(int n_rows, int n_entries)
+  {
+    offsets.reserve(n_rows + 1);
+    entries.reserve(n_entries);
+  }
+
+  template <typename It>
+  void push_row(It first, It last)
+  {
+    entries.insert(entries.end(), first, last);
+    offsets.push_back(entries.size());
+  }
+
+  // Grows by row_sizes.size() rows of the given sizes, leaving the new
+  // entries uninitialized (zero).  Returns the index of the first new row.
+  int append_rows(const std::vector<int>& row_sizes)
+  {
+    int first = size();
+    offsets.reserve(offsets.size() + row_sizes.size());
+    for (auto s : row_sizes) offsets.push_back(offsets.back() + s);
+    entries.resize(offsets.back(), 0);
+    return first;
+  }
+
+  // Moves row i to row row_map[i], in place.  Beyond the new offsets, this
+  // needs one bit per entry, so that the entries are never duplicated.
+  void permute_rows(const std::vector<int>& row_map)
+  {
+    int n = size();
+    AMANZI_ASSERT(row_map.size() == n);
+    std::vector<int> new_offsets(n + 1, 0);
+    for (int i = 0; i != n; ++i) new_offsets[row_map[i] + 1] = row_size(i);
+    for (int i = 0; i != n; ++i) new_offsets[i + 1] += new_offsets[i];
+
+    // where the entry at position p belongs
+    auto dest = [&](int p) {
+      int i = std::upper_bound(offsets.begin(), offsets.end(), p) - offsets.begin() - 1;
+      return new_offsets[row_map[i]] + (p - offsets[i]);
+    };
+
+    // follow each cycle of the permutation of entries
+    std::vector<bool> done(entries.size(), false);
+    for (int p = 0; p != entries.size(); ++p) {
+      if (done[p]) continue;
+      int carry = entries[p];
+      int q = p;
+      do {
+        q = dest(q);
+        std::swap(carry, entries[q]);
+        done[q] = true;
+      } while (q != p);
+    }
+    offsets.swap(new_offsets);
+  }
+
+  // Frees all memory.
+  void clear()
+  {
+    std::vector<int>(1, 0).swap(offsets);
+    std::vector<int>().swap(entries);
+  }
+
+  std::vector<int> offsets;
+  std::vector<int> entries;
+};
+
+
+// Exclusive prefix sum, returns the total.
+inline int
+exclusiveScan(const std::vector<int>& counts, std::vector<int>& starts)
+{
+  starts.resize(counts.size());
+  int total = 0;
+  for (int i = 0; i != counts.size(); ++i) {
+    starts[i] = total;
+    total += counts[i];
+  }
+  return total;
+}
+
+
+// Calls f(i) for i in [0,n), split into contiguous chunks over n_threads
+// threads.  f must only write to data owned by index i.
+template <typename F>
+void
+parallelFor(int n, int n_threads, const F& f)
+{
+  n_threads = std::max(1, std::min(n_threads, n / 1024 + 1));
+  if (n_threads == 1) {
+    for (int i = 0; i != n; ++i) f(i);
+    return;
+  }
+
+  std::vector<std::thread> threads;
+  threads.reserve(n_threads);
+  int chunk = (n + n_threads - 1) / n_threads;
+  for (int t = 0; t != n_threads; ++t) {
+    int start = t * chunk;
+    int stop = std::min(n, start + chunk);
+    threads.emplace_back([start, stop, &f]() {
+      for (int i = start; i < stop; ++i) f(i);
+    });
+  }
+  for (auto& th : threads) th.join();
+}
+
+} // namespace AmanziGeometry
+} // namespace Amanzi
+
+#endif
@@ -11,6 +11,7 @@
 #include <algorithm>
 #include <numeric>
 #include <fstream>
+#include <thread>
 
 #include "Mesh2D.hh"
 #include "Mesh3D.hh"
@@ -20,25 +21,34 @@
 namespace Amanzi {
 namespace AmanziGeometry {
 
-Mesh3D::Mesh3D(const Mesh2D* const m_, int n_layers)
-  : m(m_), current_layer(0), total_layers(n_layers), datum(m_->datum), cells_in_col(m->ncells, 0)
+Mesh3D::Mesh3D(const Mesh2D* const m_, int n_layers, int n_threads_)
+  : m(m_),
+    current_layer(0),
+    total_layers(n_layers),
+    n_threads(n_threads_),
+    datum(m_->datum),
+    cells_in_col(m->ncells, 0)
 {
+  if (n_threads < 1) n_threads = std::max(1, (int)std::thread::hardware_concurrency());
+
   // reserve/allocate space
   Point d(3);
   int n_nodes = m->nnodes * (n_layers + 1);
   coords.reserve(n_nodes);
 
   int n_cells = n_layers * m->ncells;
-  cell2face.reserve(n_cells);
+  cell2face.reserve(n_cells, n_cells * 5);
+  block_ids.reserve(n_cells);
+  columns.reserve(n_cells);
 
   int n_faces = n_layers * m->nfaces + (n_layers + 1) * m->ncells;
-  face2node.reserve(n_faces);
+  face2node.reserve(n_faces, n_layers * m->nfaces * 4 + (n_layers + 1) * m->ncells * 3);
 
   // copy the top surface coords
   coords.insert(coords.end(), m->coords.begin(), m->coords.end());
 
   // create the top layer of faces
-  face2node.insert(face2node.end(), m->cell2node.begin(), m->cell2node.end());
+  for (const auto& nodes : m->cell2node) face2node.push_row(nodes.begin(), nodes.end());
   up_faces.resize(face2node.size());
   std::iota(up_faces.begin(), up_faces.end(), 0);
   up_nodes.resize(coords.size());
@@ -72,80 +82,144 @@ Mesh3D::extrude(const std::vector<double>& dz,
   AMANZI_ASSERT(dz.size() == m->coords.size());
   AMANZI_ASSERT(block_ids_.size() == m->cell2node.size());
 
-  auto this_layer_sides = std::vector<int>(m->face2node.size(), -1);
   auto node_differs = [this](int n) { return this->dn_nodes[n] != this->up_nodes[n]; };
   auto node_same_horiz = [this](int n) {
     return is_equal(coords[this->dn_nodes[n]][0], coords[this->up_nodes[n]][0]) &&
            is_equal(coords[this->dn_nodes[n]][1], coords[this->up_nodes[n]][1]);
   };
+
   // shift the up-node coordinates by dz
-  for (int n = 0; n != dz.size(); ++n) {
-    if (!squash_zero_edges || dz[n] > 0.) {
-      Point nc(coords[up_nodes[n]]);
-      nc[2] -= dz[n];
-      coords.emplace_back(std::move(nc));
-      dn_nodes[n] = coords.size() - 1;
+  int n_nodes2 = dz.size();
+  std::vector<int> node_new(n_nodes2), node_start;
+  for (int n = 0; n != n_nodes2; ++n) node_new[n] = (!squash_zero_edges || dz[n] > 0.) ? 1 : 0;
+  int node0 = coords.size();
+  coords.resize(node0 + exclusiveScan(node_new, node_start));
+  parallelFor(n_nodes2, n_threads, [&](int n) {
+    if (node_new[n]) {
+      int my_n = node0 + node_start[n];
+      coords[my_n] = coords[up_nodes[n]];
+      coords[my_n][2] -= dz[n];
+      dn_nodes[n] = my_n;
     }
-  }
+  });
+
+  // A side face is needed if any of its nodes moved.  If it is needed, both
+  // of its neighboring cells are in this layer, and it is created by the
+  // lowest-numbered neighbor -- the cell that created it in the 2D mesh.
+  std::vector<char> side_needed(m->nfaces);
+  parallelFor(m->nfaces, n_threads, [&](int sf) {
+    side_needed[sf] =
+      std::any_of(m->face2node[sf].begin(), m->face2node[sf].end(), node_differs);
+  });
+  auto creates_side = [&](int c, int sf) {
+    return side_needed[sf] && m->face_cell_when_created[sf] == c;
+  };
 
-  // add cells, faces
-  for (int c = 0; c != m->ncells; ++c) {
+  // count pass: cells, faces created by each surface cell
+  std::vector<int> cell_new(m->ncells, 0), cell_n_sides(m->ncells, 0), face_new(m->ncells, 0);
+  parallelFor(m->ncells, n_threads, [&](int c) {
     if (std::any_of(m->cell2node[c].begin(), m->cell2node[c].end(), node_differs)) {
-      cells_in_col[c]++;
-
+      cell_new[c] = 1;
+      face_new[c] = 1;
+      for (auto sf : m->cell2face[c]) {
+        AMANZI_ASSERT(node_same_horiz(m->face2node[sf][0]));
+        AMANZI_ASSERT(node_same_horiz(m->face2node[sf][1]));
+        if (side_needed[sf]) {
+          cell_n_sides[c]++;
+          if (creates_side(c, sf)) face_new[c]++;
+        }
+      }
+    }
+  });
+
+  // prefix sums give each surface cell its ranges of new cells and faces
+  std::vector<int> cell_start, face_start;
+  int n_cells_new = exclusiveScan(cell_new, cell_start);
+  int n_faces_new = exclusiveScan(face_new, face_start);
+  int cell0 = cell2face.size();
+  int face0 = face2node.size();
+
+  std::vector<int> cell_sizes(n_cells_new), face_sizes(n_faces_new);
+  parallelFor(m->ncells, n_threads, [&](int c) {
+    if (cell_new[c]) {
+      cell_sizes[cell_start[c]] = 2 + cell_n_sides[c];
+      int lf = face_start[c];
+      face_sizes[lf++] = m->cell2node[c].size();
+      for (auto sf : m->cell2face[c]) {
+        if (creates_side(c, sf)) {
+          face_sizes[lf++] = 2 + node_differs(m->face2node[sf][0]) + node_differs(m->face2node[sf][1]);
+        }
+      }
+    }
+  });
+  face2node.append_rows(face_sizes);
+  cell2face.append_rows(cell_sizes);
+  block_ids.resize(cell0 + n_cells_new);
+  columns.resize(cell0 + n_cells_new);
+
+  // fill pass 1: new faces
+  std::vector<int> side_faces(m->nfaces, -1);
+  parallelFor(m->ncells, n_threads, [&](int c) {
+    if (cell_new[c]) {
       // add the bottom face
-      std::vector<int> dn_face;
-      for (auto n : m->cell2node[c]) dn_face.emplace_back(dn_nodes[n]);
-      int my_dn_f = face2node.size();
-      face2node.emplace_back(std::move(dn_face));
-      dn_faces[c] = my_dn_f;
+      int my_f = face0 + face_start[c];
+      int* nodes = face2node.row(my_f);
+      for (auto n : m->cell2node[c]) *nodes++ = dn_nodes[n];
+      dn_faces[c] = my_f++;
 
-      // push back a cell containing the up, dn faces
-      auto cell_faces = std::vector<int>{ up_faces[c], dn_faces[c] };
-      int my_c = cell2face.size();
+      // add faces for the sides as needed
+      for (auto sf : m->cell2face[c]) {
+        if (creates_side(c, sf)) {
+          int n0 = m->face2node[sf][0];
+          int n1 = m->face2node[sf][1];
+          nodes = face2node.row(my_f);
+          *nodes++ = up_nodes[n1];
+          *nodes++ = up_nodes[n0];
+          if (node_differs(n0)) *nodes++ = dn_nodes[n0];
+          if (node_differs(n1)) *nodes++ = dn_nodes[n1];
+          side_faces[sf] = my_f++;
+        }
+      }
+    }
+  });
+
+  // fill pass 2: new cells, containing the up, dn, and side faces
+  parallelFor(m->ncells, n_threads, [&](int c) {
+    if (cell_new[c]) {
+      cells_in_col[c]++;
+      int my_c = cell0 + cell_start[c];
+      int* faces = cell2face.row(my_c);
+      *faces++ = up_faces[c];
+      *faces++ = dn_faces[c];
+      for (auto sf : m->cell2face[c]) {
+        if (side_needed[sf]) *faces++ = side_faces[sf];
+      }
+      block_ids[my_c] = block_ids_[c];
+      columns[my_c] = c;
+    }
+  });
+
+  // side sets, in serial to keep the order of a serial extrusion
+  for (int c = 0; c != m->ncells; ++c) {
+    if (cell_new[c]) {
+      int my_c = cell0 + cell_start[c];
 
       // if this is the top cell, put it into the surface side set
       if (side_sets[1].first[c] < 0) side_sets[1].first[c] = my_c;
       // put this cell into the bottom side set -- will be overwritten if any lower
       side_sets[0].first[c] = my_c;
 
-      // add faces for the sides as needed
+      // check if a created side is a boundary side, and add it to the side_set if so
+      int lf = 2;
       for (auto sf : m->cell2face[c]) {
-        int my_f = this_layer_sides[sf];
-
-        AMANZI_ASSERT(node_same_horiz(m->face2node[sf][0]));
-        AMANZI_ASSERT(node_same_horiz(m->face2node[sf][1]));
-
-        if (std::any_of(m->face2node[sf].begin(), m->face2node[sf].end(), node_differs)) {
-          if (my_f < 0) {
-            // may need to create the face
-            my_f = face2node.size();
-            auto side_nodes =
-              std::vector<int>{ up_nodes[m->face2node[sf][1]], up_nodes[m->face2node[sf][0]] };
-            if (node_differs(m->face2node[sf][0]))
-              side_nodes.push_back(dn_nodes[m->face2node[sf][0]]);
-            if (node_differs(m->face2node[sf][1]))
-              side_nodes.push_back(dn_nodes[m->face2node[sf][1]]);
-            face2node.emplace_back(std::move(side_nodes));
-            cell_faces.push_back(my_f);
-            this_layer_sides[sf] = my_f;
-
-            // check if this is a boundary side, and add it to the side_set if so
-            if (m->side_face_counts[sf] == 1) {
-              side_sets[2].first.push_back(my_c);
-              side_sets[2].second.push_back(cell_faces.size() - 1);
-            }
-
-          } else {
-            // no need to create the face, but the cell still needs to know it
-            cell_faces.push_back(my_f);
+        if (side_needed[sf]) {
+          if (creates_side(c, sf) && m->side_face_counts[sf] == 1) {
+            side_sets[2].first.push_back(my_c);
+            side_sets[2].second.push_back(lf);
           }
+          lf++;
         }
       }
-
-      // finally add the cell, including a block id
-      cell2face.emplace_back(std::move(cell_faces));
-      block_ids.push_back(block_ids_[c]);
     }
   }
 
@@ -163,7 +237,7 @@ void
 Mesh3D::finish()
 {
   // flip the bottom faces for proper outward orientation
-  for (auto f : dn_faces) std::reverse(face2node[f].begin(), face2node[f].end());
+  for (auto f : dn_faces) std::reverse(face2node.row(f), face2node.row(f) + face2node.row_size(f));
 
   // move the 2d cell sets to face sets on the surface
   std::set<int> set_ids;
@@ -183,15 +257,14 @@ Mesh3D::finish()
 
   // check side sets
   std::vector<int> side_face_counts(face2node.size(), 0);
-  for (auto& c : cell2face)
-    for (auto& f : c) side_face_counts[f]++;
+  for (auto f : cell2face.entries) side_face_counts[f]++;
 
   for (int lcv_s = 0; lcv_s != side_sets.size(); ++lcv_s) {
     auto& fs = side_sets[lcv_s];
     for (int i = 0; i != side_sets[lcv_s].first.size(); ++i) {
       int c = fs.first[i];
       int fi = fs.second[i];
-      int f = cell2face[c][fi];
+      int f = cell2face.row(c)[fi];
       if (side_face_counts[f] != 1) {
         std::cout << "Face Set " << side_sets_id[lcv_s] << ": face = " << f << " (" << c << ","
                   << fi << ") has been counted " << side_face_counts[f] << " times (should be 1)!"
@@ -18,14 +18,23 @@
 
 #include "Point.hh"
 #include "Mesh2D.hh"
+#include "CSR.hh"
 
 
 namespace Amanzi {
 namespace AmanziGeometry {
 
 
+//
+// A 3D mesh extruded, layer by layer, from a 2D surface mesh.
+//
+// Connectivity is stored in flat, compressed-row form.  Each layer is
+// generated in three passes over the surface cells -- count, prefix sum, fill
+// -- so that the count and fill passes can be split across n_threads threads
+// while producing exactly the numbering of a serial extrusion.
+//
 struct Mesh3D {
-  Mesh3D(const Mesh2D* const m_, int n_layers);
+  Mesh3D(const Mesh2D* const m_, int n_layers, int n_threads_ = -1);
 
   void extrude(double dz, const std::vector<int>& cell_set, bool squash_zero_edges = true)
   {
@@ -51,15 +60,20 @@ struct Mesh3D {
                bool squash_zero_edges = true);
   void finish();
 
+  int num_cells() const { return cell2face.size(); }
+  int num_faces() const { return face2node.size(); }
+  int num_nodes() const { return coords.size(); }
+
   const Mesh2D* const m;
 
   // basic geometric/topology info
   std::vector<Point> coords;
-  std::vector<std::vector<int>> cell2face;
-  std::vector<std::vector<int>> face2node;
+  Connectivity cell2face;
+  Connectivity face2node;
 
   // labels
   std::vector<int> block_ids;
+  std::vector<int> columns; // the surface cell atop each 3D cell
   std::vector<std::pair<std::vector<int>, std::vector<int>>> side_sets;
   std::vector<int> side_sets_id;
 
@@ -73,6 +87,7 @@ struct Mesh3D {
   // other meta-data
   int current_layer;
   int total_layers;
+  int n_threads;
   Point datum;
 };
 
@@ -0,0 +1,79 @@
+/*
+  Copyright 2010-202x held jointly by participating institutions.
+  ATS is released under the three-clause BSD License.
+  The terms of use and "as is" disclaimer for this license are
+  provided in the top-level COPYRIGHT file.
+
+  Authors:
+*/
+
+//! Command line options shared by the extrude executables.
+/*
+  Usage: EXE [--threads N] [--partition N] [--column-major]
+
+    --threads N     extrude on N threads (default: one per hardware thread)
+    --partition N   also write a column-preserving partition of the mesh into
+                    N parts, to MESH_FILE.part
+    --column-major  write cells column by column, rather than layer by layer
+                    (the default)
+*/
+
+#ifndef EXTRUDE_OPTIONS_HH_
+#define EXTRUDE_OPTIONS_HH_
+
+#include <cstdlib>
+#include <iostream>
+#include <string>
+
+namespace Amanzi {
+namespace AmanziGeometry {
+
+struct ExtrudeOptions {
+  int n_threads = -1;
+  int n_parts = 0;
+  bool column_major = false;
+};
+
+
+inline void
+printExtrudeUsage(const char* exe)
+{
+  std::cerr << "Usage: " << exe << " [--threads N] [--partition N] [--column-major]" << std::endl
+            << "  --threads N     extrude on N threads (default: one per hardware thread)"
+            << std::endl
+            << "  --partition N   also write a column-preserving partition into N parts,"
+            << std::endl
+            << "                  to MESH_FILE.part" << std::endl
+            << "  --column-major  write cells column by column, rather than layer by layer"
+            << std::endl;
+}
+
+
+inline ExtrudeOptions
+readExtrudeOptions(int argc, char* argv[])
+{
+  ExtrudeOptions opts;
+  for (int i = 1; i < argc; ++i) {
+    std::string arg(argv[i]);
+    if (arg == "--column-major") {
+      opts.column_major = true;
+    } else if ((arg == "--threads" || arg == "--partition") && i + 1 < argc) {
+      int value = std::atoi(argv[++i]);
+      if (value < 1) {
+        std::cerr << arg << " requires a positive integer." << std::endl;
+        std::exit(1);
+      }
+      if (arg == "--threads") opts.n_threads = value;
+      else opts.n_parts = value;
+    } else {
+      printExtrudeUsage(argv[0]);
+      std::exit(arg == "-h" || arg == "--help" ? 0 : 1);
+    }
+  }
+  return opts;
+}
+
+} // namespace AmanziGeometry
+} // namespace Amanzi
+
+#endif
@@ -10,6 +10,8 @@
 #include <set>
 #include <vector>
 #include <algorithm>
+#include <numeric>
+#include <fstream>
 #include "exodusII.h"
 
 #include "dbc.hh"
@@ -21,7 +23,150 @@ namespace Amanzi {
 namespace AmanziGeometry {
 
 void
-writeMesh3D_exodus(const Mesh3D& m, const std::string& filename)
+blockOrdering(const Mesh3D& m,
+              std::vector<int>& blocks_id,
+              std::vector<int>& blocks_ncells,
+              std::vector<int>& cell_map,
+              bool column_major)
+{
+  std::set<int> set_ids(m.block_ids.begin(), m.block_ids.end());
+  blocks_id.assign(set_ids.begin(), set_ids.end());
+  blocks_ncells.assign(blocks_id.size(), 0);
+
+  std::vector<int> block_lcv(m.num_cells());
+  for (int i = 0; i != m.num_cells(); ++i) {
+    block_lcv[i] =
+      std::lower_bound(blocks_id.begin(), blocks_id.end(), m.block_ids[i]) - blocks_id.begin();
+    blocks_ncells[block_lcv[i]]++;
+  }
+
+  // cells are grouped by block, then either left in order of creation
+  // (layer-major) or ordered by column, top to bottom
+  std::vector<int> cell_order(m.num_cells());
+  std::iota(cell_order.begin(), cell_order.end(), 0);
+  if (column_major) {
+    std::stable_sort(cell_order.begin(), cell_order.end(), [&](int i, int j) {
+      return block_lcv[i] < block_lcv[j] ||
+             (block_lcv[i] == block_lcv[j] && m.columns[i] < m.columns[j]);
+    });
+  } else {
+    std::stable_sort(cell_order.begin(), cell_order.end(), [&](int i, int j) {
+      return block_lcv[i] < block_lcv[j];
+    });
+  }
+
+  cell_map.resize(m.num_cells());
+  for (int k = 0; k != m.num_cells(); ++k) cell_map[cell_order[k]] = k;
+}
+
+
+void
+firstTouchOrdering(const Connectivity& conn,
+                   const std::vector<int>& row_order,
+                   int n_entities,
+                   std::vector<int>& entity_map)
+{
+  entity_map.assign(n_entities, -1);
+  int next = 0;
+  for (auto r : row_order) {
+    for (auto e = conn.begin(r); e != conn.end(r); ++e) {
+      if (entity_map[*e] < 0) entity_map[*e] = next++;
+    }
+  }
+  AMANZI_ASSERT(next == n_entities);
+}
+
+
+//
+// Recursive coordinate bisection of the surface cells, by centroid, into
+// n_parts parts of (nearly) equal numbers of 3D cells.
+//
+void
+partitionColumnsRCB_(const Mesh3D& m,
+                     std::vector<int>::iterator first,
+                     std::vector<int>::iterator last,
+                     const std::vector<Point>& centroids,
+                     int part0,
+                     int n_parts,
+                     std::vector<int>& col_parts)
+{
+  if (n_parts == 1 || last - first <= 1) {
+    for (auto c = first; c != last; ++c) col_parts[*c] = part0;
+    return;
+  }
+
+  // split along the longer extent
+  double lo[2] = { 1.e80, 1.e80 }, hi[2] = { -1.e80, -1.e80 };
+  for (auto c = first; c != last; ++c) {
+    for (int i = 0; i != 2; ++i) {
+      lo[i] = std::min(lo[i], centroids[*c][i]);
+      hi[i] = std::max(hi[i], centroids[*c][i]);
+    }
+  }
+  int dim = (hi[0] - lo[0]) >= (hi[1] - lo[1]) ? 0 : 1;
+  std::sort(first, last, [&](int a, int b) { return centroids[a][dim] < centroids[b][dim]; });
+
+  // weight by number of cells in the column
+  int n_left = n_parts / 2;
+  long total = 0;
+  for (auto c = first; c != last; ++c) total += std::max(1, m.cells_in_col[*c]);
+  long target = total * n_left / n_parts;
+  long sum = 0;
+  auto mid = first;
+  while (mid != last - 1 && sum + std::max(1, m.cells_in_col[*mid]) <= target) {
+    sum += std::max(1, m.cells_in_col[*mid]);
+    ++mid;
+  }
+  if (mid == first) ++mid;
+
+  partitionColumnsRCB_(m, first, mid, centroids, part0, n_left, col_parts);
+  partitionColumnsRCB_(m, mid, last, centroids, part0 + n_left, n_parts - n_left, col_parts);
+}
+
+
+void
+writeMesh3D_partition(const Mesh3D& m,
+                      int n_parts,
+                      const std::string& filename,
+                      bool column_major)
+{
+  // partition the surface, so that whole columns land on one part
+  std::vector<Point> centroids(m.m->ncells, Point(2));
+  for (int c = 0; c != m.m->ncells; ++c) {
+    for (auto n : m.m->cell2node[c]) {
+      centroids[c][0] += m.m->coords[n][0];
+      centroids[c][1] += m.m->coords[n][1];
+    }
+    centroids[c] /= m.m->cell2node[c].size();
+  }
+  std::vector<int> cols(m.m->ncells);
+  std::iota(cols.begin(), cols.end(), 0);
+  std::vector<int> col_parts(m.m->ncells, 0);
+  partitionColumnsRCB_(m, cols.begin(), cols.end(), centroids, 0, n_parts, col_parts);
+
+  // write the part of each cell, in the element order of the exodus file
+  std::vector<int> blocks_id, blocks_ncells, cell_map;
+  blockOrdering(m, blocks_id, blocks_ncells, cell_map, column_major);
+  std::vector<int> cell_parts(m.num_cells());
+  for (int i = 0; i != m.num_cells(); ++i) cell_parts[cell_map[i]] = col_parts[m.columns[i]];
+
+  std::ofstream fid(filename);
+  for (auto p : cell_parts) fid << p << std::endl;
+  fid.close();
+
+  std::vector<int> part_ncells(n_parts, 0);
+  for (auto p : cell_parts) part_ncells[p]++;
+  std::cout << "Wrote partition of 3D Mesh into " << n_parts << " parts by column:" << std::endl
+            << "  min cells per part = "
+            << *std::min_element(part_ncells.begin(), part_ncells.end()) << std::endl
+            << "  max cells per part = "
+            << *std::max_element(part_ncells.begin(), part_ncells.end()) << std::endl
+            << std::endl;
+}
+
+
+void
+writeMesh3D_exodus(Mesh3D& m, const std::string& filename, bool column_major)
 {
   // create the exodus file
   int CPU_word_size = sizeof(float);
@@ -33,47 +178,49 @@ writeMesh3D_exodus(const Mesh3D& m, const std::string& filename)
   }
 
   // make the blocks by set
-  std::set<int> set_ids(m.block_ids.begin(), m.block_ids.end());
-  std::vector<std::vector<int>> blocks;
-  std::vector<int> blocks_ncells;
-  std::vector<int> blocks_id;
-  std::vector<std::vector<int>> block_face_counts;
-
-  int new_id = 0;
-  std::vector<int> cell_map(m.cell2face.size(), -1);
-  for (auto sid : set_ids) {
-    std::vector<int> block;
-    std::vector<int> face_counts;
-    // count things
-    int ncells = 0;
-
-    for (int i = 0; i != m.cell2face.size(); ++i) {
-      if (m.block_ids[i] == sid) {
-        ncells++;
-        block.insert(block.end(), m.cell2face[i].begin(), m.cell2face[i].end());
-        face_counts.push_back(m.cell2face[i].size());
-        cell_map[i] = new_id;
-        new_id++;
-      }
-    }
-
-    blocks.emplace_back(block);
-    blocks_ncells.push_back(ncells);
-    blocks_id.push_back(sid);
-    block_face_counts.emplace_back(face_counts);
+  std::vector<int> blocks_id, blocks_ncells, cell_map;
+  blockOrdering(m, blocks_id, blocks_ncells, cell_map, column_major);
+  std::set<int> set_ids(blocks_id.begin(), blocks_id.end());
+  int n_cells = m.num_cells();
+  int n_faces = m.num_faces();
+  int n_nodes = m.num_nodes();
+
+  // renumber faces in the order cells first touch them, and nodes in the
+  // order faces first touch them
+  std::vector<int> face_map, node_map;
+  if (column_major) {
+    std::vector<int> cell_order(n_cells);
+    for (int i = 0; i != n_cells; ++i) cell_order[cell_map[i]] = i;
+    firstTouchOrdering(m.cell2face, cell_order, n_faces, face_map);
+    std::vector<int> face_order(n_faces);
+    for (int f = 0; f != n_faces; ++f) face_order[face_map[f]] = f;
+    firstTouchOrdering(m.face2node, face_order, n_nodes, node_map);
+  } else {
+    face_map.resize(n_faces);
+    std::iota(face_map.begin(), face_map.end(), 0);
+    node_map.resize(n_nodes);
+    std::iota(node_map.begin(), node_map.end(), 0);
   }
 
+  // Reorder and renumber (1-based) the connectivity in place, so that it is
+  // written straight from the mesh: cells are then in block order, so each
+  // block is a contiguous range of rows.
+  m.cell2face.permute_rows(cell_map);
+  for (auto& f : m.cell2face.entries) f = face_map[f] + 1;
+  m.face2node.permute_rows(face_map);
+  for (auto& n : m.face2node.entries) n = node_map[n] + 1;
+  std::vector<int>().swap(face_map);
 
   // create the params
   ex_init_params params;
   sprintf(params.title, "my_mesh");
   params.num_dim = 3;
-  params.num_nodes = m.coords.size();
+  params.num_nodes = n_nodes;
   params.num_edge = 0;
   params.num_edge_blk = 0;
-  params.num_face = m.face2node.size();
+  params.num_face = n_faces;
   params.num_face_blk = 1;
-  params.num_elem = m.cell2face.size();
+  params.num_elem = n_cells;
   params.num_elem_blk = set_ids.size();
   params.num_node_maps = 0;
   params.num_edge_maps = 0;
@@ -94,9 +241,9 @@ writeMesh3D_exodus(const Mesh3D& m, const std::string& filename)
   for (int i = 0; i != 3; ++i) { coords[i].resize(m.coords.size()); }
 
   for (int n = 0; n != coords[0].size(); ++n) {
-    coords[0][n] = m.coords[n][0];
-    coords[1][n] = m.coords[n][1];
-    coords[2][n] = m.coords[n][2];
+    coords[0][node_map[n]] = m.coords[n][0];
+    coords[1][node_map[n]] = m.coords[n][1];
+    coords[2][node_map[n]] = m.coords[n][2];
   }
 
   char* coord_names[3];
@@ -114,26 +261,28 @@ writeMesh3D_exodus(const Mesh3D& m, const std::string& filename)
 
 
   // put in the face block
-  std::vector<int> facenodes;
-  std::vector<int> facenodes_counts;
-  for (auto& nodes : m.face2node) {
-    facenodes_counts.push_back(nodes.size());
-    facenodes.insert(facenodes.end(), nodes.begin(), nodes.end());
-  }
-  ierr |=
-    ex_put_block(fid, EX_FACE_BLOCK, 1, "NSIDED", m.face2node.size(), facenodes.size(), 0, 0, 0);
+  std::vector<int> facenodes_counts(n_faces);
+  for (int f = 0; f != n_faces; ++f) facenodes_counts[f] = m.face2node.row_size(f);
+  ierr |= ex_put_block(
+    fid, EX_FACE_BLOCK, 1, "NSIDED", n_faces, m.face2node.entries.size(), 0, 0, 0);
   AMANZI_ASSERT(!ierr);
 
   ierr |= ex_put_entity_count_per_polyhedra(fid, EX_FACE_BLOCK, 1, &facenodes_counts[0]);
   AMANZI_ASSERT(!ierr);
 
-  for (auto& e : facenodes) e++;
-  ierr |= ex_put_conn(fid, EX_FACE_BLOCK, 1, &facenodes[0], NULL, NULL);
+  ierr |= ex_put_conn(fid, EX_FACE_BLOCK, 1, m.face2node.entries.data(), NULL, NULL);
   AMANZI_ASSERT(!ierr);
+  m.face2node.clear();
+  std::vector<int>().swap(facenodes_counts);
 
 
   // put in the element blocks
-  for (int lcvb = 0; lcvb != blocks.size(); ++lcvb) {
+  for (int lcvb = 0, first = 0; lcvb != blocks_id.size(); ++lcvb) {
+    int last = first + blocks_ncells[lcvb];
+    std::vector<int> block_face_counts(blocks_ncells[lcvb]);
+    for (int c = first; c != last; ++c) block_face_counts[c - first] = m.cell2face.row_size(c);
+    int n_block_faces = m.cell2face.offsets[last] - m.cell2face.offsets[first];
+
     ierr |= ex_put_block(fid,
                          EX_ELEM_BLOCK,
                          blocks_id[lcvb],
@@ -141,18 +290,19 @@ writeMesh3D_exodus(const Mesh3D& m, const std::string& filename)
                          blocks_ncells[lcvb],
                          0,
                          0,
-                         blocks[lcvb].size(),
+                         n_block_faces,
                          0);
     AMANZI_ASSERT(!ierr);
 
     ierr |= ex_put_entity_count_per_polyhedra(
-      fid, EX_ELEM_BLOCK, blocks_id[lcvb], &block_face_counts[lcvb][0]);
+      fid, EX_ELEM_BLOCK, blocks_id[lcvb], &block_face_counts[0]);
     AMANZI_ASSERT(!ierr);
 
-    for (auto& e : blocks[lcvb]) e++;
-    ierr |= ex_put_conn(fid, EX_ELEM_BLOCK, blocks_id[lcvb], NULL, NULL, &blocks[lcvb][0]);
+    ierr |= ex_put_conn(fid, EX_ELEM_BLOCK, blocks_id[lcvb], NULL, NULL, m.cell2face.row(first));
     AMANZI_ASSERT(!ierr);
+    first = last;
   }
+  m.cell2face.clear();
 
 
   // add the side sets, mapping elems to the new ids
@@ -174,8 +324,8 @@ writeMesh3D_exodus(const Mesh3D& m, const std::string& filename)
 
   // debugging/nice output
   std::cout << "Wrote 3D Mesh:" << std::endl
-            << "  ncells = " << m.cell2face.size() << std::endl
-            << "  nfaces = " << m.face2node.size() << std::endl
+            << "  ncells = " << n_cells << std::endl
+            << "  nfaces = " << n_faces << std::endl
             << "  nnodes = " << m.coords.size() << std::endl
             << std::endl
             << "  side sets = " << std::endl;
@@ -188,5 +338,14 @@ writeMesh3D_exodus(const Mesh3D& m, const std::string& filename)
   std::cout << std::endl;
 }
 
+
+void
+writeMesh3D(Mesh3D& m, const std::string& filename, const ExtrudeOptions& opts)
+{
+  if (opts.n_parts > 0)
+    writeMesh3D_partition(m, opts.n_parts, filename + ".part", opts.column_major);
+  writeMesh3D_exodus(m, filename, opts.column_major);
+}
+
 } // namespace AmanziGeometry
 } // namespace Amanzi
@@ -11,13 +11,54 @@
 #define MESH_WRITER_HH_
 
 #include "Mesh3D.hh"
+#include "extrudeOptions.hh"
 
 
 namespace Amanzi {
 namespace AmanziGeometry {
 
+// The Exodus element order: cells are grouped by block id, in increasing
+// order, and within a block are either in order of creation (layer by layer)
+// or column-major (column by column, top to bottom).  cell_map gives the new
+// (0-based) element index of each cell.
 void
-writeMesh3D_exodus(const Mesh3D& m, const std::string& filename);
+blockOrdering(const Mesh3D& m,
+              std::vector<int>& blocks_id,
+              std::vector<int>& blocks_ncells,
+              std::vector<int>& cell_map,
+              bool column_major = false);
+
+// Numbers entities in the order they are first referenced by the rows of
+// conn, visited in row_order.
+void
+firstTouchOrdering(const Connectivity& conn,
+                   const std::vector<int>& row_order,
+                   int n_entities,
+                   std::vector<int>& entity_map);
+
+// Writes the mesh.  If column_major, cells are written column by column, and
+// faces and nodes are renumbered in the order they are first touched, so that
+// cells sharing a face are close in every numbering.
+//
+// To bound peak memory, the connectivity of m is reordered in place, written
+// straight from the mesh, and freed as it is written, so m cannot be written
+// twice.
+void
+writeMesh3D_exodus(Mesh3D& m, const std::string& filename, bool column_major = false);
+
+// Writes the part (rank) of each element, one per line in Exodus element
+// order, such that every column of cells is in a single part.  column_major
+// must match that used to write the mesh.
+void
+writeMesh3D_partition(const Mesh3D& m,
+                      int n_parts,
+                      const std::string& filename,
+                      bool column_major = false);
+
+// Writes the mesh as set by the command line options: the partition, if
+// requested, to filename + ".part", then the Exodus file.
+void
+writeMesh3D(Mesh3D& m, const std::string& filename, const ExtrudeOptions& opts);
 
 }
 } // namespace Amanzi
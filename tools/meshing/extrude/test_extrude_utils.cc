@@ -0,0 +1,163 @@
+/*
+  Copyright 2010-202x held jointly by participating institutions.
+  ATS is released under the three-clause BSD License.
+  The terms of use and "as is" disclaimer for this license are
+  provided in the top-level COPYRIGHT file.
+
+  Authors:
+*/
+
+// Checks the in-place row permutation of Connectivity, and that a partition
+// written by column, read back in Exodus element order, puts every column on
+// one part.  Exits nonzero on failure.
+
+#include <algorithm>
+#include <cstdio>
+#include <fstream>
+#include <iostream>
+#include <numeric>
+#include <random>
+
+#include "CSR.hh"
+#include "Mesh3D.hh"
+#include "writeMesh3D.hh"
+
+using namespace Amanzi::AmanziGeometry;
+
+namespace {
+
+int n_failures = 0;
+
+void
+check(bool pass, const std::string& what)
+{
+  if (!pass) {
+    std::cout << "FAILED: " << what << std::endl;
+    n_failures++;
+  }
+}
+
+
+// rows of varying size, row i holding 100 * i + j
+Connectivity
+createRows(int n_rows)
+{
+  Connectivity conn;
+  for (int i = 0; i != n_rows; ++i) {
+    std::vector<int> row(i % 5);
+    for (int j = 0; j != row.size(); ++j) row[j] = 100 * i + j;
+    conn.push_row(row.begin(), row.end());
+  }
+  return conn;
+}
+
+
+void
+testPermuteRows()
+{
+  int n_rows = 57;
+  Connectivity conn = createRows(n_rows);
+  Connectivity orig = conn;
+
+  std::vector<int> row_map(n_rows);
+  std::iota(row_map.begin(), row_map.end(), 0);
+  std::shuffle(row_map.begin(), row_map.end(), std::mt19937(7));
+  conn.permute_rows(row_map);
+
+  check(conn.size() == n_rows, "permute_rows keeps the number of rows");
+  check(conn.entries.size() == orig.entries.size(), "permute_rows keeps the number of entries");
+  for (int i = 0; i != n_rows; ++i) {
+    int k = row_map[i];
+    check(conn.row_size(k) == orig.row_size(i), "permute_rows moves the row size");
+    check(std::equal(orig.begin(i), orig.end(i), conn.begin(k)), "permute_rows moves the row");
+  }
+
+  // the inverse permutation restores the rows
+  std::vector<int> inverse(n_rows);
+  for (int i = 0; i != n_rows; ++i) inverse[row_map[i]] = i;
+  conn.permute_rows(inverse);
+  check(conn.offsets == orig.offsets && conn.entries == orig.entries,
+        "permute_rows by the inverse is the identity");
+}
+
+
+// an nx by ny grid of unit squares, each split into two triangles
+Mesh2D
+createSurface(int nx, int ny)
+{
+  std::vector<Point> coords;
+  for (int j = 0; j <= ny; ++j) {
+    for (int i = 0; i <= nx; ++i) {
+      Point p(2);
+      p.set(i, j);
+      coords.push_back(p);
+    }
+  }
+  std::vector<std::vector<int>> cell2node;
+  for (int j = 0; j != ny; ++j) {
+    for (int i = 0; i != nx; ++i) {
+      int n0 = j * (nx + 1) + i;
+      cell2node.push_back({ n0, n0 + 1, n0 + nx + 2 });
+      cell2node.push_back({ n0, n0 + nx + 2, n0 + nx + 1 });
+    }
+  }
+  std::vector<std::vector<int>> cell_sets;
+  return Mesh2D(coords, cell2node, cell_sets);
+}
+
+
+void
+testPartition(bool column_major)
+{
+  int n_parts = 5;
+  std::string filename = "test_extrude_utils.part";
+
+  Mesh2D m = createSurface(8, 6);
+  Mesh3D m3(&m, 4, 2);
+  std::vector<int> soil(m.ncells, 1001), bedrock(m.ncells, 101);
+  for (int i = 0; i != 3; ++i) m3.extrude(0.5, soil);
+  m3.extrude(10., bedrock);
+
+  writeMesh3D_partition(m3, n_parts, filename, column_major);
+
+  std::vector<int> parts;
+  std::ifstream fid(filename);
+  for (int p; fid >> p;) parts.push_back(p);
+  fid.close();
+  std::remove(filename.c_str());
+  check(parts.size() == m3.num_cells(), "a part is written for every cell");
+  if (parts.size() != m3.num_cells()) return;
+
+  // the file is in Exodus element order
+  std::vector<int> blocks_id, blocks_ncells, cell_map;
+  blockOrdering(m3, blocks_id, blocks_ncells, cell_map, column_major);
+
+  std::vector<int> col_part(m.ncells, -1), part_ncells(n_parts, 0);
+  for (int c = 0; c != m3.num_cells(); ++c) {
+    int p = parts[cell_map[c]];
+    check(p >= 0 && p < n_parts, "parts are in range");
+    if (p < 0 || p >= n_parts) continue;
+    part_ncells[p]++;
+    int col = m3.columns[c];
+    if (col_part[col] < 0) col_part[col] = p;
+    check(col_part[col] == p, "every column is on one part");
+  }
+  for (int p = 0; p != n_parts; ++p) {
+    check(part_ncells[p] > 0, "every part is used");
+    check(part_ncells[p] % 4 == 0, "parts hold whole columns");
+  }
+}
+
+} // namespace
+
+
+int
+main()
+{
+  testPermuteRows();
+  testPartition(false);
+  testPartition(true);
+
+  if (n_failures == 0) std::cout << "All tests passed." << std::endl;
+  return n_failures == 0 ? 0 : 1;
+}
@@ -0,0 +1,102 @@
+#!/usr/bin/env python
+"""Converts ATS HDF5 meteorological forcing to ATS binary forcing files.
+
+Usage: met_to_binary.py MY_MET_DATA.h5 [-o MY_MET_DATA.atsf]
+
+Accepts either point forcing, as written by daymet_to_ats.py (one 1D
+dataset per variable), or gridded forcing, as written by
+daymet_to_ats_box.py (one group per variable, with one 2D dataset per
+time, and x and y coordinates).  The result is read by the "gridded
+forcing" evaluator.
+
+The binary format, in little-endian byte order, is:
+
+  char[8]             magic, "ATSFRC01"
+  int64[4]            n_vars, n_times, nx, ny
+  float64[4]          x0, y0, dx, dy
+  char[64] * n_vars   variable names, NUL-padded
+  float64 * n_times   times [s]
+  float64 * n_vars * n_times * nx * ny
+                      data, by variable, then time, then forcing cell (i*ny + j)
+"""
+
+import sys
+import numpy as np
+import h5py
+
+MAGIC = b'ATSFRC01'
+NAME_LENGTH = 64
+
+
+def read_h5(filename):
+    """Reads an ATS HDF5 forcing file.
+
+    Returns times, a dictionary of (n_times, nx, ny) arrays, and the grid
+    (x0, y0, dx, dy).
+    """
+    with h5py.File(filename, 'r') as fid:
+        times = fid['time [s]'][:]
+        if 'x coordinate [m]' in fid:
+            x = fid['x coordinate [m]'][:]
+            y = fid['y coordinate [m]'][:]
+        else:
+            x = np.zeros((1,))
+            y = np.zeros((1,))
+
+        dat = dict()
+        for key in fid.keys():
+            if key in ['time [s]', 'x coordinate [m]', 'y coordinate [m]']:
+                continue
+            if isinstance(fid[key], h5py.Group):
+                grp = fid[key]
+                dat[key] = np.array([grp[str(i)][:] for i in range(len(times))])
+            else:
+                dat[key] = fid[key][:].reshape((len(times), 1, 1))
+            assert(dat[key].shape == (len(times), len(x), len(y)))
+
+    # Daymet, among others, orders y from north to south; the binary grid is
+    # increasing in both coordinates, so reverse any decreasing axis
+    if len(x) > 1 and x[1] < x[0]:
+        x = x[::-1]
+        for key in dat:
+            dat[key] = dat[key][:, ::-1, :]
+    if len(y) > 1 and y[1] < y[0]:
+        y = y[::-1]
+        for key in dat:
+            dat[key] = dat[key][:, :, ::-1]
+
+    dx = x[1] - x[0] if len(x) > 1 else 0.
+    dy = y[1] - y[0] if len(y) > 1 else 0.
+    return times, dat, (x[0], y[0], dx, dy)
+
+
+def write_binary(times, dat, grid, filename):
+    """Writes an ATS binary forcing file."""
+    keys = sorted(dat.keys())
+    nt, nx, ny = dat[keys[0]].shape
+    with open(filename, 'wb') as fid:
+        fid.write(MAGIC)
+        fid.write(np.array([len(keys), nt, nx, ny], '<i8').tobytes())
+        fid.write(np.array(grid, '<f8').tobytes())
+        for key in keys:
+            name = key.encode('utf-8')
+            if len(name) > NAME_LENGTH:
+                raise RuntimeError('Variable name "{}" is too long.'.format(key))
+            fid.write(name.ljust(NAME_LENGTH, b'\0'))
+        fid.write(np.asarray(times, '<f8').tobytes())
+        for key in keys:
+            fid.write(np.ascontiguousarray(dat[key], '<f8').tobytes())
+
+
+if __name__ == "__main__":
+    import argparse
+    parser = argparse.ArgumentParser(__doc__)
+    parser.add_argument('infile', type=str, help='ATS HDF5 forcing file.')
+    parser.add_argument('-o', '--outfile', type=str, help='Output binary filename.')
+    args = parser.parse_args()
+
+    if args.outfile is None:
+        args.outfile = args.infile.rsplit('.', 1)[0] + '.atsf'
+    times, dat, grid = read_h5(args.infile)
+    write_binary(times, dat, grid, args.outfile)
+    sys.exit(0)